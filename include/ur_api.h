@@ -221,6 +221,10 @@ typedef enum ur_function_t {
     UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP = 218,                             ///< Enumerator for ::urCommandBufferGetInfoExp
     UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP = 219,                     ///< Enumerator for ::urCommandBufferCommandGetInfoExp
     UR_FUNCTION_DEVICE_GET_SELECTED = 220,                                     ///< Enumerator for ::urDeviceGetSelected
+    UR_FUNCTION_KERNEL_CLONE_EXP = 221,                                        ///< Enumerator for ::urKernelCloneExp
+    UR_FUNCTION_USM_EXPORT_EXP = 222,                                          ///< Enumerator for ::urUSMExportExp
+    UR_FUNCTION_USM_IMPORT_HANDLE_EXP = 223,                                   ///< Enumerator for ::urUSMImportHandleExp
+    UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP = 224,                                 ///< Enumerator for ::urProgramBuildAsyncExp
     /// @cond
     UR_FUNCTION_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -277,6 +281,8 @@ typedef enum ur_structure_type_t {
     UR_STRUCTURE_TYPE_EXP_FILE_DESCRIPTOR = 0x2003,                          ///< ::ur_exp_file_descriptor_t
     UR_STRUCTURE_TYPE_EXP_WIN32_HANDLE = 0x2004,                             ///< ::ur_exp_win32_handle_t
     UR_STRUCTURE_TYPE_EXP_SAMPLER_ADDR_MODES = 0x2005,                       ///< ::ur_exp_sampler_addr_modes_t
+    UR_STRUCTURE_TYPE_EXP_QUEUE_EXECUTOR_PROPERTIES = 0x3000,                ///< ::ur_exp_queue_executor_properties_t
+    UR_STRUCTURE_TYPE_EXP_USM_EXPORT_DESC = 0x4000,                          ///< ::ur_exp_usm_export_desc_t
     /// @cond
     UR_STRUCTURE_TYPE_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -4680,17 +4686,20 @@ urKernelSetArgLocal(
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Get Kernel object information
 typedef enum ur_kernel_info_t {
-    UR_KERNEL_INFO_FUNCTION_NAME = 0,   ///< [char[]] Return null-terminated kernel function name.
-    UR_KERNEL_INFO_NUM_ARGS = 1,        ///< [size_t] Return Kernel number of arguments.
-    UR_KERNEL_INFO_REFERENCE_COUNT = 2, ///< [uint32_t] Reference count of the kernel object.
-                                        ///< The reference count returned should be considered immediately stale.
-                                        ///< It is unsuitable for general use in applications. This feature is
-                                        ///< provided for identifying memory leaks.
-    UR_KERNEL_INFO_CONTEXT = 3,         ///< [::ur_context_handle_t] Return Context object associated with Kernel.
-    UR_KERNEL_INFO_PROGRAM = 4,         ///< [::ur_program_handle_t] Return Program object associated with Kernel.
-    UR_KERNEL_INFO_ATTRIBUTES = 5,      ///< [char[]] Return null-terminated kernel attributes string.
-    UR_KERNEL_INFO_NUM_REGS = 6,        ///< [uint32_t] Return the number of registers used by the compiled kernel
-                                        ///< (device specific).
+    UR_KERNEL_INFO_FUNCTION_NAME = 0,    ///< [char[]] Return null-terminated kernel function name.
+    UR_KERNEL_INFO_NUM_ARGS = 1,         ///< [size_t] Return Kernel number of arguments.
+    UR_KERNEL_INFO_REFERENCE_COUNT = 2,  ///< [uint32_t] Reference count of the kernel object.
+                                         ///< The reference count returned should be considered immediately stale.
+                                         ///< It is unsuitable for general use in applications. This feature is
+                                         ///< provided for identifying memory leaks.
+    UR_KERNEL_INFO_CONTEXT = 3,          ///< [::ur_context_handle_t] Return Context object associated with Kernel.
+    UR_KERNEL_INFO_PROGRAM = 4,          ///< [::ur_program_handle_t] Return Program object associated with Kernel.
+    UR_KERNEL_INFO_ATTRIBUTES = 5,       ///< [char[]] Return null-terminated kernel attributes string.
+    UR_KERNEL_INFO_NUM_REGS = 6,         ///< [uint32_t] Return the number of registers used by the compiled kernel
+                                         ///< (device specific).
+    UR_KERNEL_INFO_VARIANT_EXP = 0x1000, ///< [char[]] Return null-terminated name of the variant of the kernel
+                                         ///< selected for the device, or an empty string if the kernel has a single
+                                         ///< implementation.
     /// @cond
     UR_KERNEL_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -4767,7 +4776,7 @@ typedef enum ur_kernel_exec_info_t {
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hKernel`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_KERNEL_INFO_NUM_REGS < propName`
+///         + `::UR_KERNEL_INFO_VARIANT_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -5591,17 +5600,21 @@ typedef enum ur_event_info_t {
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Profiling query information type
 typedef enum ur_profiling_info_t {
-    UR_PROFILING_INFO_COMMAND_QUEUED = 0,   ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
-                                            ///< when the event is enqueued
-    UR_PROFILING_INFO_COMMAND_SUBMIT = 1,   ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
-                                            ///< when the event is submitted
-    UR_PROFILING_INFO_COMMAND_START = 2,    ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
-                                            ///< when the event starts execution
-    UR_PROFILING_INFO_COMMAND_END = 3,      ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
-                                            ///< when the event has finished execution
-    UR_PROFILING_INFO_COMMAND_COMPLETE = 4, ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
-                                            ///< when the event and any child events enqueued by this event on the
-                                            ///< device have finished execution
+    UR_PROFILING_INFO_COMMAND_QUEUED = 0,         ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
+                                                  ///< when the event is enqueued
+    UR_PROFILING_INFO_COMMAND_SUBMIT = 1,         ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
+                                                  ///< when the event is submitted
+    UR_PROFILING_INFO_COMMAND_START = 2,          ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
+                                                  ///< when the event starts execution
+    UR_PROFILING_INFO_COMMAND_END = 3,            ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
+                                                  ///< when the event has finished execution
+    UR_PROFILING_INFO_COMMAND_COMPLETE = 4,       ///< [uint64_t] A 64-bit value of current device counter in nanoseconds
+                                                  ///< when the event and any child events enqueued by this event on the
+                                                  ///< device have finished execution
+    UR_PROFILING_INFO_CYCLES_EXP = 0x1000,        ///< [uint64_t] Number of core cycles spent executing the command
+    UR_PROFILING_INFO_INSTRUCTIONS_EXP = 0x1001,  ///< [uint64_t] Number of instructions retired executing the command
+    UR_PROFILING_INFO_LLC_MISSES_EXP = 0x1002,    ///< [uint64_t] Number of last level cache misses executing the command
+    UR_PROFILING_INFO_BRANCH_MISSES_EXP = 0x1003, ///< [uint64_t] Number of mispredicted branches executing the command
     /// @cond
     UR_PROFILING_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -5661,7 +5674,7 @@ urEventGetInfo(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hEvent`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_PROFILING_INFO_COMMAND_COMPLETE < propName`
+///         + `::UR_PROFILING_INFO_BRANCH_MISSES_EXP < propName`
 ///     - ::UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE
 ///         + If `hEvent`s associated queue was not created with `UR_QUEUE_FLAG_PROFILING_ENABLE`.
 ///     - ::UR_RESULT_ERROR_INVALID_VALUE
@@ -8741,6 +8754,71 @@ urKernelSuggestMaxCooperativeGroupCountExp(
     uint32_t *pGroupCountRet        ///< [out] pointer to maximum number of groups
 );
 
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for Kernel Cloning
+#if !defined(__GNUC__)
+#pragma region kernel clone(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+#ifndef UR_KERNEL_CLONE_EXTENSION_STRING_EXP
+/// @brief The extension string which defines support for kernel cloning
+///        which is returned when querying device extensions.
+#define UR_KERNEL_CLONE_EXTENSION_STRING_EXP "ur_exp_kernel_clone"
+#endif // UR_KERNEL_CLONE_EXTENSION_STRING_EXP
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Create a copy of a kernel object
+///
+/// @details
+///     - The clone refers to the same program and kernel function as hKernel
+///       and starts with the arguments and execution info currently set on
+///       hKernel.
+///     - Arguments set on either kernel after this call do not affect the other
+///       one.
+///     - Adapters may share the argument storage of both kernels until either
+///       of them is modified, which makes cloning much cheaper than creating
+///       the kernel again with ::urKernelCreate.
+///     - The application may call this function from simultaneous threads, as
+///       long as the arguments of hKernel are not modified at the same time.
+///     - The clone must be released with ::urKernelRelease.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hKernel`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phKernelClone`
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support cloning kernels and the loader doesn't intercept calls.
+UR_APIEXPORT ur_result_t UR_APICALL
+urKernelCloneExp(
+    ur_kernel_handle_t hKernel,       ///< [in] handle of the kernel object to clone
+    ur_kernel_handle_t *phKernelClone ///< [out] pointer to handle of the cloned kernel object
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for Kernel Variants
+#if !defined(__GNUC__)
+#pragma region kernel variants(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+#ifndef UR_KERNEL_VARIANTS_EXTENSION_STRING_EXP
+/// @brief The extension string which defines support for querying the variant of
+///        a kernel selected by the adapter which is returned when querying device
+///        extensions.
+#define UR_KERNEL_VARIANTS_EXTENSION_STRING_EXP "ur_exp_kernel_variants"
+#endif // UR_KERNEL_VARIANTS_EXTENSION_STRING_EXP
+
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
@@ -8866,6 +8944,252 @@ urProgramLinkExp(
     ur_program_handle_t *phProgram         ///< [out] pointer to handle of program object created.
 );
 
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for Hardware Performance Counters
+#if !defined(__GNUC__)
+#pragma region profiling counters(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+#ifndef UR_PROFILING_COUNTERS_EXTENSION_STRING_EXP
+/// @brief The extension string which defines support for querying hardware
+///        performance counters of commands which is returned when querying device
+///        extensions.
+#define UR_PROFILING_COUNTERS_EXTENSION_STRING_EXP "ur_exp_profiling_counters"
+#endif // UR_PROFILING_COUNTERS_EXTENSION_STRING_EXP
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for Asynchronous Program Builds
+#if !defined(__GNUC__)
+#pragma region program build async(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+#ifndef UR_PROGRAM_BUILD_ASYNC_EXTENSION_STRING_EXP
+/// @brief The extension string which defines native support for asynchronous
+///        program builds which is returned when querying device extensions.
+#define UR_PROGRAM_BUILD_ASYNC_EXTENSION_STRING_EXP "ur_exp_program_build_async"
+#endif // UR_PROGRAM_BUILD_ASYNC_EXTENSION_STRING_EXP
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback notifying the application that an asynchronous program build
+///        has finished.
+typedef void (*ur_exp_program_build_callback_t)(
+    ur_result_t result, ///< [in] result of the build, as ::urProgramBuild would have returned it
+    void *pUserData     ///< [in][out] pointer to user data passed to ::urProgramBuildAsyncExp
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Starts building a program without waiting for the build to finish.
+///
+/// @details
+///     - Builds hProgram like ::urProgramBuild, but returns before the build
+///       has finished. pfnNotify is called exactly once when it finishes, from
+///       an arbitrary thread, possibly before this function returns.
+///     - If this function returns an error, the build was not started and
+///       pfnNotify is not called.
+///     - pOptions is copied before this function returns.
+///     - The application must not use hProgram, except to release it, until
+///       pfnNotify has been called.
+///     - Adapters which do not support this function natively, see
+///       ::UR_PROGRAM_BUILD_ASYNC_EXTENSION_STRING_EXP, may have it emulated by
+///       the loader, which then runs ::urProgramBuild on a bounded pool of
+///       compile threads.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hProgram`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pfnNotify`
+///     - ::UR_RESULT_ERROR_INVALID_PROGRAM
+///         + If `hProgram` isn't a valid program object.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urProgramBuildAsyncExp(
+    ur_context_handle_t hContext,              ///< [in] handle of the context object
+    ur_program_handle_t hProgram,              ///< [in] handle of the program object
+    const char *pOptions,                      ///< [in][optional] string of build options
+    ur_exp_program_build_callback_t pfnNotify, ///< [in] callback called once the build has finished
+    void *pUserData                            ///< [in][out][optional] pointer to data to be passed to pfnNotify
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for External Executors
+#if !defined(__GNUC__)
+#pragma region queue executor(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+#ifndef UR_QUEUE_EXECUTOR_EXTENSION_STRING_EXP
+/// @brief The extension string which defines support for running queue commands
+///        on an application-provided executor which is returned when querying
+///        device extensions.
+#define UR_QUEUE_EXECUTOR_EXTENSION_STRING_EXP "ur_exp_queue_executor"
+#endif // UR_QUEUE_EXECUTOR_EXTENSION_STRING_EXP
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Task created by an adapter, to be run once by an external executor.
+typedef void (*ur_exp_executor_task_t)(
+    void *pTaskData ///< [in][out] pointer to data passed to the submit callback along with the
+                    ///< task
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback submitting a task to an application-provided executor.
+typedef void (*ur_exp_executor_submit_callback_t)(
+    void *pUserData,                ///< [in][out] pointer to user data given in
+                                    ///< ::ur_exp_queue_executor_properties_t
+    ur_exp_executor_task_t pfnTask, ///< [in] task to run
+    void *pTaskData                 ///< [in][out] pointer to data to pass to pfnTask
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Queue properties for running commands on an external executor
+///
+/// @details
+///     - Specify these properties in ::urQueueCreate via
+///       ::ur_queue_properties_t as part of a `pNext` chain.
+///     - The adapter calls pfnSubmit instead of using threads of its own. It
+///       may call it from any thread enqueuing commands to the queue, several
+///       times per command.
+///     - Each submitted task must be run exactly once, on any thread and at any
+///       time. Adapters must not rely on tasks running before an enqueue
+///       returns for forward progress, so executors that run tasks inline or
+///       defer them are both valid.
+typedef struct ur_exp_queue_executor_properties_t {
+    ur_structure_type_t stype;                   ///< [in] type of this structure, must be
+                                                 ///< ::UR_STRUCTURE_TYPE_EXP_QUEUE_EXECUTOR_PROPERTIES
+    void *pNext;                                 ///< [in,out][optional] pointer to extension-specific structure
+    ur_exp_executor_submit_callback_t pfnSubmit; ///< [in] callback submitting a task to the executor
+    void *pUserData;                             ///< [in][out][optional] pointer to data passed to pfnSubmit
+    uint32_t concurrencyHint;                    ///< [in] number of tasks the executor can run in parallel, 0 if unknown
+
+} ur_exp_queue_executor_properties_t;
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for Sharing USM Between Processes
+#if !defined(__GNUC__)
+#pragma region usm export(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+#ifndef UR_USM_EXPORT_EXTENSION_STRING_EXP
+/// @brief The extension string which defines support for exporting USM
+///        allocations to other processes which is returned when querying device
+///        extensions.
+#define UR_USM_EXPORT_EXTENSION_STRING_EXP "ur_exp_usm_export"
+#endif // UR_USM_EXPORT_EXTENSION_STRING_EXP
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Types of OS handles USM allocations are exported as
+typedef enum ur_exp_usm_export_type_t {
+    UR_EXP_USM_EXPORT_TYPE_FD = 0, ///< File descriptor which can be mapped with mmap, passed to other
+                                   ///< processes over a UNIX domain socket or with pidfd_getfd
+    /// @cond
+    UR_EXP_USM_EXPORT_TYPE_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_usm_export_type_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief USM allocation descriptor for allocations which can be exported
+///
+/// @details
+///     - Specify these properties in ::urUSMHostAlloc, ::urUSMDeviceAlloc and
+///       ::urUSMSharedAlloc via ::ur_usm_desc_t as part of a `pNext` chain.
+typedef struct ur_exp_usm_export_desc_t {
+    ur_structure_type_t stype;           ///< [in] type of this structure, must be
+                                         ///< ::UR_STRUCTURE_TYPE_EXP_USM_EXPORT_DESC
+    const void *pNext;                   ///< [in][optional] pointer to extension-specific structure
+    ur_exp_usm_export_type_t exportType; ///< [in] type of OS handle the allocation will be exported as
+
+} ur_exp_usm_export_desc_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get an OS handle other processes can import a USM allocation with
+///
+/// @details
+///     - pMem must be the start of an allocation made with a
+///       ::ur_exp_usm_export_desc_t of the same `exportType`.
+///     - The handle is owned by the allocation and stays valid until pMem is
+///       freed. Applications pass a duplicate of it to other processes.
+///     - The memory stays allocated until pMem is freed and all the processes
+///       which imported it have freed their imports.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///         + `NULL == phOsHandle`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `::UR_EXP_USM_EXPORT_TYPE_FD < exportType`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If pMem was not allocated as exportable as `exportType`.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support exporting allocations.
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMExportExp(
+    ur_context_handle_t hContext,        ///< [in] handle of the context object
+    void *pMem,                          ///< [in] pointer to the start of the USM allocation
+    ur_exp_usm_export_type_t exportType, ///< [in] type of OS handle to return
+    ur_native_handle_t *phOsHandle       ///< [out] OS handle of the allocation
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Map a USM allocation exported by another process into a context
+///
+/// @details
+///     - The returned pointer can be used like a USM host allocation of `size`
+///       bytes in hContext, and must be freed with ::urUSMFree.
+///     - hOsHandle isn't consumed, the application may close it once this
+///       function returns.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `::UR_EXP_USM_EXPORT_TYPE_FD < exportType`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + `size == 0`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If hOsHandle isn't a handle of `exportType` of at least `size` bytes.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support importing allocations.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMImportHandleExp(
+    ur_context_handle_t hContext,        ///< [in] handle of the context object
+    ur_exp_usm_export_type_t exportType, ///< [in] type of hOsHandle
+    ur_native_handle_t hOsHandle,        ///< [in][nocheck] OS handle returned by ::urUSMExportExp in the exporting
+                                         ///< process
+    size_t size,                         ///< [in] size in bytes of the exported allocation
+    void **ppMem                         ///< [out] pointer to the imported memory
+);
+
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
@@ -9517,6 +9841,18 @@ typedef struct ur_program_create_with_native_handle_params_t {
     ur_program_handle_t **pphProgram;
 } ur_program_create_with_native_handle_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urProgramBuildAsyncExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_program_build_async_exp_params_t {
+    ur_context_handle_t *phContext;
+    ur_program_handle_t *phProgram;
+    const char **ppOptions;
+    ur_exp_program_build_callback_t *ppfnNotify;
+    void **ppUserData;
+} ur_program_build_async_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urKernelCreate
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -9691,6 +10027,15 @@ typedef struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t {
     uint32_t **ppGroupCountRet;
 } ur_kernel_suggest_max_cooperative_group_count_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urKernelCloneExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_kernel_clone_exp_params_t {
+    ur_kernel_handle_t *phKernel;
+    ur_kernel_handle_t **pphKernelClone;
+} ur_kernel_clone_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urQueueGetInfo
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -10750,6 +11095,29 @@ typedef struct ur_usm_pitched_alloc_exp_params_t {
     size_t **ppResultPitch;
 } ur_usm_pitched_alloc_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMExportExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_export_exp_params_t {
+    ur_context_handle_t *phContext;
+    void **ppMem;
+    ur_exp_usm_export_type_t *pexportType;
+    ur_native_handle_t **pphOsHandle;
+} ur_usm_export_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMImportHandleExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_import_handle_exp_params_t {
+    ur_context_handle_t *phContext;
+    ur_exp_usm_export_type_t *pexportType;
+    ur_native_handle_t *phOsHandle;
+    size_t *psize;
+    void ***pppMem;
+} ur_usm_import_handle_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urUSMImportExp
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -435,12 +435,22 @@ typedef ur_result_t(UR_APICALL *ur_pfnProgramLinkExp_t)(
     const char *,
     ur_program_handle_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urProgramBuildAsyncExp
+typedef ur_result_t(UR_APICALL *ur_pfnProgramBuildAsyncExp_t)(
+    ur_context_handle_t,
+    ur_program_handle_t,
+    const char *,
+    ur_exp_program_build_callback_t,
+    void *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of ProgramExp functions pointers
 typedef struct ur_program_exp_dditable_t {
     ur_pfnProgramBuildExp_t pfnBuildExp;
     ur_pfnProgramCompileExp_t pfnCompileExp;
     ur_pfnProgramLinkExp_t pfnLinkExp;
+    ur_pfnProgramBuildAsyncExp_t pfnBuildAsyncExp;
 } ur_program_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -631,10 +641,17 @@ typedef ur_result_t(UR_APICALL *ur_pfnKernelSuggestMaxCooperativeGroupCountExp_t
     size_t,
     uint32_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urKernelCloneExp
+typedef ur_result_t(UR_APICALL *ur_pfnKernelCloneExp_t)(
+    ur_kernel_handle_t,
+    ur_kernel_handle_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of KernelExp functions pointers
 typedef struct ur_kernel_exp_dditable_t {
     ur_pfnKernelSuggestMaxCooperativeGroupCountExp_t pfnSuggestMaxCooperativeGroupCountExp;
+    ur_pfnKernelCloneExp_t pfnCloneExp;
 } ur_kernel_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1780,6 +1797,23 @@ typedef ur_result_t(UR_APICALL *ur_pfnUSMPitchedAllocExp_t)(
     void **,
     size_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urUSMExportExp
+typedef ur_result_t(UR_APICALL *ur_pfnUSMExportExp_t)(
+    ur_context_handle_t,
+    void *,
+    ur_exp_usm_export_type_t,
+    ur_native_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urUSMImportHandleExp
+typedef ur_result_t(UR_APICALL *ur_pfnUSMImportHandleExp_t)(
+    ur_context_handle_t,
+    ur_exp_usm_export_type_t,
+    ur_native_handle_t,
+    size_t,
+    void **);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function-pointer for urUSMImportExp
 typedef ur_result_t(UR_APICALL *ur_pfnUSMImportExp_t)(
@@ -1797,6 +1831,8 @@ typedef ur_result_t(UR_APICALL *ur_pfnUSMReleaseExp_t)(
 /// @brief Table of USMExp functions pointers
 typedef struct ur_usm_exp_dditable_t {
     ur_pfnUSMPitchedAllocExp_t pfnPitchedAllocExp;
+    ur_pfnUSMExportExp_t pfnExportExp;
+    ur_pfnUSMImportHandleExp_t pfnImportHandleExp;
     ur_pfnUSMImportExp_t pfnImportExp;
     ur_pfnUSMReleaseExp_t pfnReleaseExp;
 } ur_usm_exp_dditable_t;
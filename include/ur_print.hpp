@@ -334,6 +334,9 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_command_buffer_update_value_arg_desc_t params);
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_command_buffer_update_exec_info_desc_t params);
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_command_buffer_update_kernel_launch_desc_t params);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_queue_executor_properties_t params);
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_usm_export_type_t value);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_usm_export_desc_t params);
 inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_info_t value);
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -912,6 +915,18 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_function_t value) {
     case UR_FUNCTION_DEVICE_GET_SELECTED:
         os << "UR_FUNCTION_DEVICE_GET_SELECTED";
         break;
+    case UR_FUNCTION_KERNEL_CLONE_EXP:
+        os << "UR_FUNCTION_KERNEL_CLONE_EXP";
+        break;
+    case UR_FUNCTION_USM_EXPORT_EXP:
+        os << "UR_FUNCTION_USM_EXPORT_EXP";
+        break;
+    case UR_FUNCTION_USM_IMPORT_HANDLE_EXP:
+        os << "UR_FUNCTION_USM_IMPORT_HANDLE_EXP";
+        break;
+    case UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP:
+        os << "UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -1065,6 +1080,12 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_structure_type_t value
     case UR_STRUCTURE_TYPE_EXP_SAMPLER_ADDR_MODES:
         os << "UR_STRUCTURE_TYPE_EXP_SAMPLER_ADDR_MODES";
         break;
+    case UR_STRUCTURE_TYPE_EXP_QUEUE_EXECUTOR_PROPERTIES:
+        os << "UR_STRUCTURE_TYPE_EXP_QUEUE_EXECUTOR_PROPERTIES";
+        break;
+    case UR_STRUCTURE_TYPE_EXP_USM_EXPORT_DESC:
+        os << "UR_STRUCTURE_TYPE_EXP_USM_EXPORT_DESC";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -1316,6 +1337,16 @@ inline ur_result_t printStruct(std::ostream &os, const void *ptr) {
         const ur_exp_sampler_addr_modes_t *pstruct = (const ur_exp_sampler_addr_modes_t *)ptr;
         printPtr(os, pstruct);
     } break;
+
+    case UR_STRUCTURE_TYPE_EXP_QUEUE_EXECUTOR_PROPERTIES: {
+        const ur_exp_queue_executor_properties_t *pstruct = (const ur_exp_queue_executor_properties_t *)ptr;
+        printPtr(os, pstruct);
+    } break;
+
+    case UR_STRUCTURE_TYPE_EXP_USM_EXPORT_DESC: {
+        const ur_exp_usm_export_desc_t *pstruct = (const ur_exp_usm_export_desc_t *)ptr;
+        printPtr(os, pstruct);
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -7621,6 +7652,9 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_kernel_info_t value) {
     case UR_KERNEL_INFO_NUM_REGS:
         os << "UR_KERNEL_INFO_NUM_REGS";
         break;
+    case UR_KERNEL_INFO_VARIANT_EXP:
+        os << "UR_KERNEL_INFO_VARIANT_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -7709,6 +7743,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_info
 
         os << ")";
     } break;
+    case UR_KERNEL_INFO_VARIANT_EXP: {
+
+        const char *tptr = (const char *)ptr;
+        printPtr(os, tptr);
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -8804,6 +8843,18 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_profiling_info_t value
     case UR_PROFILING_INFO_COMMAND_COMPLETE:
         os << "UR_PROFILING_INFO_COMMAND_COMPLETE";
         break;
+    case UR_PROFILING_INFO_CYCLES_EXP:
+        os << "UR_PROFILING_INFO_CYCLES_EXP";
+        break;
+    case UR_PROFILING_INFO_INSTRUCTIONS_EXP:
+        os << "UR_PROFILING_INFO_INSTRUCTIONS_EXP";
+        break;
+    case UR_PROFILING_INFO_LLC_MISSES_EXP:
+        os << "UR_PROFILING_INFO_LLC_MISSES_EXP";
+        break;
+    case UR_PROFILING_INFO_BRANCH_MISSES_EXP:
+        os << "UR_PROFILING_INFO_BRANCH_MISSES_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -8880,6 +8931,54 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_profiling_i
 
         os << ")";
     } break;
+    case UR_PROFILING_INFO_CYCLES_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_PROFILING_INFO_INSTRUCTIONS_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_PROFILING_INFO_LLC_MISSES_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_PROFILING_INFO_BRANCH_MISSES_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -9675,6 +9774,83 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
     return os;
 }
 ///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_queue_executor_properties_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_queue_executor_properties_t params) {
+    os << "(struct ur_exp_queue_executor_properties_t){";
+
+    os << ".stype = ";
+
+    os << (params.stype);
+
+    os << ", ";
+    os << ".pNext = ";
+
+    ur::details::printStruct(os,
+                             (params.pNext));
+
+    os << ", ";
+    os << ".pfnSubmit = ";
+
+    os << reinterpret_cast<void *>(
+        (params.pfnSubmit));
+
+    os << ", ";
+    os << ".pUserData = ";
+
+    ur::details::printPtr(os,
+                          (params.pUserData));
+
+    os << ", ";
+    os << ".concurrencyHint = ";
+
+    os << (params.concurrencyHint);
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_usm_export_type_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_usm_export_type_t value) {
+    switch (value) {
+    case UR_EXP_USM_EXPORT_TYPE_FD:
+        os << "UR_EXP_USM_EXPORT_TYPE_FD";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_usm_export_desc_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_usm_export_desc_t params) {
+    os << "(struct ur_exp_usm_export_desc_t){";
+
+    os << ".stype = ";
+
+    os << (params.stype);
+
+    os << ", ";
+    os << ".pNext = ";
+
+    ur::details::printStruct(os,
+                             (params.pNext));
+
+    os << ", ";
+    os << ".exportType = ";
+
+    os << (params.exportType);
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_exp_peer_info_t type
 /// @returns
 ///     std::ostream &
@@ -10947,6 +11123,44 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_program_build_async_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_build_async_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".hProgram = ";
+
+    ur::details::printPtr(os,
+                          *(params->phProgram));
+
+    os << ", ";
+    os << ".pOptions = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppOptions));
+
+    os << ", ";
+    os << ".pfnNotify = ";
+
+    os << reinterpret_cast<void *>(
+        *(params->ppfnNotify));
+
+    os << ", ";
+    os << ".pUserData = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppUserData));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_kernel_create_params_t type
 /// @returns
@@ -11421,6 +11635,26 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_kernel_clone_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_clone_exp_params_t *params) {
+
+    os << ".hKernel = ";
+
+    ur::details::printPtr(os,
+                          *(params->phKernel));
+
+    os << ", ";
+    os << ".phKernelClone = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphKernelClone));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_queue_get_info_params_t type
 /// @returns
@@ -14908,6 +15142,73 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_export_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_export_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".pMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppMem));
+
+    os << ", ";
+    os << ".exportType = ";
+
+    os << *(params->pexportType);
+
+    os << ", ";
+    os << ".phOsHandle = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphOsHandle));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_import_handle_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_import_handle_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".exportType = ";
+
+    os << *(params->pexportType);
+
+    os << ", ";
+    os << ".hOsHandle = ";
+
+    ur::details::printPtr(os,
+                          *(params->phOsHandle));
+
+    os << ", ";
+    os << ".size = ";
+
+    os << *(params->psize);
+
+    os << ", ";
+    os << ".ppMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppMem));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_usm_import_exp_params_t type
 /// @returns
@@ -16721,6 +17022,9 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE: {
         os << (const struct ur_program_create_with_native_handle_params_t *)params;
     } break;
+    case UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP: {
+        os << (const struct ur_program_build_async_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_KERNEL_CREATE: {
         os << (const struct ur_kernel_create_params_t *)params;
     } break;
@@ -16769,6 +17073,9 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP: {
         os << (const struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_KERNEL_CLONE_EXP: {
+        os << (const struct ur_kernel_clone_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_QUEUE_GET_INFO: {
         os << (const struct ur_queue_get_info_params_t *)params;
     } break;
@@ -17024,6 +17331,12 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_USM_PITCHED_ALLOC_EXP: {
         os << (const struct ur_usm_pitched_alloc_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_USM_EXPORT_EXP: {
+        os << (const struct ur_usm_export_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_USM_IMPORT_HANDLE_EXP: {
+        os << (const struct ur_usm_import_handle_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_USM_IMPORT_EXP: {
         os << (const struct ur_usm_import_exp_params_t *)params;
     } break;
@@ -287,6 +287,102 @@ def _mako_tracing_layer_cpp(path, namespace, tags, version, specs, meta):
         specs=specs,
         meta=meta)
 
+"""
+    generates c/c++ files from the specification documents
+"""
+def _mako_event_graph_layer_cpp(path, namespace, tags, version, specs, meta):
+    dstpath = os.path.join(path, "event_graph")
+    os.makedirs(dstpath, exist_ok=True)
+
+    template = "evgddi.cpp.mako"
+    fin = os.path.join(templates_dir, template)
+
+    name = "%s_evgddi"%(namespace)
+    filename = "%s.cpp"%(name)
+    fout = os.path.join(dstpath, filename)
+
+    print("Generating %s..."%fout)
+    return util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta)
+
+"""
+    generates c/c++ files from the specification documents
+"""
+def _mako_batching_layer_cpp(path, namespace, tags, version, specs, meta):
+    dstpath = os.path.join(path, "batching")
+    os.makedirs(dstpath, exist_ok=True)
+
+    template = "batddi.cpp.mako"
+    fin = os.path.join(templates_dir, template)
+
+    name = "%s_batddi"%(namespace)
+    filename = "%s.cpp"%(name)
+    fout = os.path.join(dstpath, filename)
+
+    print("Generating %s..."%fout)
+    return util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta)
+
+"""
+    generates c/c++ files from the specification documents
+"""
+def _mako_stats_layer_cpp(path, namespace, tags, version, specs, meta):
+    dstpath = os.path.join(path, "stats")
+    os.makedirs(dstpath, exist_ok=True)
+
+    template = "staddi.cpp.mako"
+    fin = os.path.join(templates_dir, template)
+
+    name = "%s_staddi"%(namespace)
+    filename = "%s.cpp"%(name)
+    fout = os.path.join(dstpath, filename)
+
+    print("Generating %s..."%fout)
+    return util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta)
+
+"""
+    generates c/c++ files from the specification documents
+"""
+def _mako_usdt_layer_cpp(path, namespace, tags, version, specs, meta):
+    dstpath = os.path.join(path, "usdt")
+    os.makedirs(dstpath, exist_ok=True)
+
+    template = "usdtddi.cpp.mako"
+    fin = os.path.join(templates_dir, template)
+
+    name = "%s_usdtddi"%(namespace)
+    filename = "%s.cpp"%(name)
+    fout = os.path.join(dstpath, filename)
+
+    print("Generating %s..."%fout)
+    return util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta)
+
 """
     generates c/c++ files from the specification documents
 """
@@ -406,6 +502,22 @@ def generate_layers(path, section, namespace, tags, version, specs, meta):
     loc += _mako_tracing_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
     print("TRACING Generated %s lines of code.\n"%loc)
 
+    loc = 0
+    loc += _mako_event_graph_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
+    print("EVENT GRAPH Generated %s lines of code.\n"%loc)
+
+    loc = 0
+    loc += _mako_stats_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
+    print("STATS Generated %s lines of code.\n"%loc)
+
+    loc = 0
+    loc += _mako_usdt_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
+    print("USDT Generated %s lines of code.\n"%loc)
+
+    loc = 0
+    loc += _mako_batching_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
+    print("BATCHING Generated %s lines of code.\n"%loc)
+
 """
 Entry-point:
     generates common utilities for unified_runtime
@@ -0,0 +1,204 @@
+<%!
+import re
+from templates import helper as th
+
+def param_names(obj):
+    return [p['name'] for p in obj.get('params', [])]
+
+def is_queue_command(obj):
+    names = param_names(obj)
+    return 'hQueue' in names and 'phEvent' in names
+
+# Commands without an output event which are recorded on batched queues.
+deferred_commands = {
+    'urEnqueueKernelLaunch': 'recordKernelLaunch',
+    'urEnqueueMemBufferCopy': 'recordMemBufferCopy',
+    'urEnqueueMemBufferFill': 'recordMemBufferFill',
+    'urEnqueueUSMFill': 'recordUSMFill',
+    'urEnqueueUSMMemcpy': 'recordUSMMemcpy',
+}
+
+# Functions which may observe the results of recorded commands.
+sync_functions = ['urEventWait', 'urEventGetInfo', 'urUSMFree']
+
+# Functions which change the arguments of recorded kernel launches.
+kernel_setters = [
+    'urKernelSetArgValue', 'urKernelSetArgLocal', 'urKernelSetArgPointer',
+    'urKernelSetArgMemObj', 'urKernelSetArgSampler', 'urKernelSetExecInfo',
+    'urKernelSetSpecializationConstants',
+]
+
+queue_functions = ['urQueueCreate', 'urQueueRelease', 'urQueueFinish', 'urQueueFlush']
+
+def is_intercepted(name, obj):
+    return (is_queue_command(obj) or name in sync_functions or
+            name in kernel_setters or name in queue_functions)
+
+def flush_call(name):
+    if name in kernel_setters:
+        return 'context.flushKernel( hKernel, "%s" )' % name
+    if name == 'urEventWait':
+        return 'context.flushEvents( numEvents, phEventWaitList, "%s" )' % name
+    if name == 'urEventGetInfo':
+        return 'context.flushEvents( 1, &hEvent, "%s" )' % name
+    if name == 'urUSMFree':
+        return 'context.flushPointer( hContext, pMem, "%s" )' % name
+    if name == 'urQueueCreate':
+        return None
+    if name == 'urQueueRelease':
+        return 'context.removeQueue( hQueue )'
+    return 'context.flush( hQueue, "%s" )' % name
+
+def after_call(name):
+    if name == 'urQueueCreate':
+        return 'context.addQueue( hContext, hDevice, pProperties, *phQueue )'
+    if name == 'urQueueFinish':
+        return 'context.finished( hQueue )'
+    return None
+%><%
+    n=namespace
+    N=n.upper()
+    x=tags['$x']
+    X=x.upper()
+%>/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ${name}.cpp
+ *
+ */
+
+#include "${x}_batching_layer.hpp"
+
+namespace ur_batching_layer
+{
+    %for obj in th.get_adapter_functions(specs):
+    <%
+        fname = th.make_func_name(n, tags, obj)
+    %>
+    %if is_intercepted(fname, obj):
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
+    %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+    %endif
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${th.make_func_name(n, tags, obj)}(
+        %for line in th.make_param_lines(n, tags, obj):
+        ${line}
+        %endfor
+        )
+    {
+        auto ${th.make_pfn_name(n, tags, obj)} = context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
+            return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        %if fname in deferred_commands:
+        if( nullptr == phEvent && ${'!blocking && ' if fname == 'urEnqueueUSMMemcpy' else ''}context.isBatched( hQueue ) )
+            return context.${deferred_commands[fname]}( ${", ".join(p for p in th.make_param_lines(n, tags, obj, format=["name"]) if p != 'phEvent')} );
+
+        %endif
+        %if flush_call(fname):
+        ${x}_result_t result = ${flush_call(fname)};
+        if( ${X}_RESULT_SUCCESS != result )
+            return result;
+
+        result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        %else:
+        ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        %endif
+        %if after_call(fname):
+
+        if( ${X}_RESULT_SUCCESS == result )
+            ${after_call(fname)};
+        %endif
+
+        return result;
+    }
+    %if 'condition' in obj:
+    #endif // ${th.subt(n, tags, obj['condition'])}
+    %endif
+
+    %endif
+    %endfor
+    %for tbl in th.get_pfntables(specs, meta, n, tags):
+    %if any(is_intercepted(th.make_func_name(n, tags, obj), obj) for obj in tbl['functions']):
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Exported function for filling application's ${tbl['name']} table
+    ///        with current process' addresses
+    ///
+    /// @returns
+    ///     - ::${X}_RESULT_SUCCESS
+    ///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+    ///     - ::${X}_RESULT_ERROR_UNSUPPORTED_VERSION
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${tbl['export']['name']}(
+        %for line in th.make_param_lines(n, tags, tbl['export']):
+        ${line}
+        %endfor
+        )
+    {
+        auto& dditable = ur_batching_layer::context.${n}DdiTable.${tbl['name']};
+
+        if( nullptr == pDdiTable )
+            return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+
+        if (UR_MAJOR_VERSION(ur_batching_layer::context.version) != UR_MAJOR_VERSION(version) ||
+            UR_MINOR_VERSION(ur_batching_layer::context.version) > UR_MINOR_VERSION(version))
+            return ${X}_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+        ${x}_result_t result = ${X}_RESULT_SUCCESS;
+
+        %for obj in tbl['functions']:
+        %if is_intercepted(th.make_func_name(n, tags, obj), obj):
+        %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+        %endif
+        dditable.${th.append_ws(th.make_pfn_name(n, tags, obj), 43)} = pDdiTable->${th.make_pfn_name(n, tags, obj)};
+        pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = ur_batching_layer::${th.make_func_name(n, tags, obj)};
+        %if 'condition' in obj:
+    #else
+        dditable.${th.append_ws(th.make_pfn_name(n, tags, obj), 43)} = nullptr;
+        pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = nullptr;
+    #endif
+        %endif
+
+        %endif
+        %endfor
+        return result;
+    }
+    %endif
+    %endfor
+
+    ${x}_result_t
+    context_t::init(ur_dditable_t *dditable,
+                    const std::set<std::string> &enabledLayerNames,
+                    codeloc_data) {
+        ${x}_result_t result = ${X}_RESULT_SUCCESS;
+
+        if(!enabledLayerNames.count(name)) {
+            return result;
+        }
+
+        // The layer submits recorded commands directly, keep the complete
+        // table of the layers below.
+        ur_batching_layer::context.${n}DdiTable = *dditable;
+        ur_batching_layer::context.enabled = true;
+
+    %for tbl in th.get_pfntables(specs, meta, n, tags):
+    %if any(is_intercepted(th.make_func_name(n, tags, obj), obj) for obj in tbl['functions']):
+        if( ${X}_RESULT_SUCCESS == result )
+        {
+            result = ur_batching_layer::${tbl['export']['name']}( ${X}_API_VERSION_CURRENT, &dditable->${tbl['name']} );
+        }
+
+    %endif
+    %endfor
+        return result;
+    }
+} /* namespace ur_batching_layer */
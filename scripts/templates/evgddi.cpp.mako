@@ -0,0 +1,176 @@
+<%!
+import re
+from templates import helper as th
+
+def param_names(obj):
+    return [p['name'] for p in obj.get('params', [])]
+
+def is_queue_command(obj):
+    names = param_names(obj)
+    return 'hQueue' in names and 'phEvent' in names
+
+def is_queue_lifetime(obj):
+    return obj['class'] == '$xQueue' and obj['name'] in ('Retain', 'Release')
+
+def is_intercepted(obj):
+    return is_queue_command(obj) or is_queue_lifetime(obj)
+%><%
+    n=namespace
+    N=n.upper()
+    x=tags['$x']
+    X=x.upper()
+%>/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ${name}.cpp
+ *
+ */
+
+#include "${x}_event_graph_layer.hpp"
+
+namespace ur_event_graph_layer
+{
+    %for obj in th.get_adapter_functions(specs):
+    %if is_queue_lifetime(obj):
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${th.make_func_name(n, tags, obj)}(
+        %for line in th.make_param_lines(n, tags, obj):
+        ${line}
+        %endfor
+        )
+    {
+        auto ${th.make_pfn_name(n, tags, obj)} = context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
+            return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
+        if( ${X}_RESULT_SUCCESS == result )
+        %if obj['name'] == 'Retain':
+            context.queueRetained( hQueue );
+        %else:
+            context.queueReleased( hQueue );
+        %endif
+
+        return result;
+    }
+
+    %elif is_queue_command(obj):
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
+    %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+    %endif
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${th.make_func_name(n, tags, obj)}(
+        %for line in th.make_param_lines(n, tags, obj):
+        ${line}
+        %endfor
+        )
+    {
+        auto ${th.make_pfn_name(n, tags, obj)} = context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
+            return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
+        if( ${X}_RESULT_SUCCESS == result )
+        %if 'phEventWaitList' in param_names(obj):
+            context.recordCommand( ${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", hQueue, numEventsInWaitList, phEventWaitList, phEvent );
+        %else:
+            context.recordCommand( ${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", hQueue, 0, nullptr, phEvent );
+        %endif
+
+        return result;
+    }
+    %if 'condition' in obj:
+    #endif // ${th.subt(n, tags, obj['condition'])}
+    %endif
+
+    %endif
+    %endfor
+    %for tbl in th.get_pfntables(specs, meta, n, tags):
+    %if any(is_intercepted(obj) for obj in tbl['functions']):
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Exported function for filling application's ${tbl['name']} table
+    ///        with current process' addresses
+    ///
+    /// @returns
+    ///     - ::${X}_RESULT_SUCCESS
+    ///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+    ///     - ::${X}_RESULT_ERROR_UNSUPPORTED_VERSION
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${tbl['export']['name']}(
+        %for line in th.make_param_lines(n, tags, tbl['export']):
+        ${line}
+        %endfor
+        )
+    {
+        auto& dditable = ur_event_graph_layer::context.${n}DdiTable.${tbl['name']};
+
+        if( nullptr == pDdiTable )
+            return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+
+        if (UR_MAJOR_VERSION(ur_event_graph_layer::context.version) != UR_MAJOR_VERSION(version) ||
+            UR_MINOR_VERSION(ur_event_graph_layer::context.version) > UR_MINOR_VERSION(version))
+            return ${X}_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+        ${x}_result_t result = ${X}_RESULT_SUCCESS;
+
+        %for obj in tbl['functions']:
+        %if is_intercepted(obj):
+        %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+        %endif
+        dditable.${th.append_ws(th.make_pfn_name(n, tags, obj), 43)} = pDdiTable->${th.make_pfn_name(n, tags, obj)};
+        pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = ur_event_graph_layer::${th.make_func_name(n, tags, obj)};
+        %if 'condition' in obj:
+    #else
+        dditable.${th.append_ws(th.make_pfn_name(n, tags, obj), 43)} = nullptr;
+        pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = nullptr;
+    #endif
+        %endif
+
+        %endif
+        %endfor
+        return result;
+    }
+    %endif
+    %endfor
+
+    ${x}_result_t
+    context_t::init(ur_dditable_t *dditable,
+                    const std::set<std::string> &enabledLayerNames,
+                    codeloc_data) {
+        ${x}_result_t result = ${X}_RESULT_SUCCESS;
+
+        if(!enabledLayerNames.count(name)) {
+            return result;
+        }
+
+        // The layer queries events and queues directly, keep the complete
+        // table of the layers below.
+        ur_event_graph_layer::context.${n}DdiTable = *dditable;
+        ur_event_graph_layer::context.enabled = true;
+
+    %for tbl in th.get_pfntables(specs, meta, n, tags):
+    %if any(is_intercepted(obj) for obj in tbl['functions']):
+        if( ${X}_RESULT_SUCCESS == result )
+        {
+            result = ur_event_graph_layer::${tbl['export']['name']}( ${X}_API_VERSION_CURRENT, &dditable->${tbl['name']} );
+        }
+
+    %endif
+    %endfor
+        return result;
+    }
+} /* namespace ur_event_graph_layer */
@@ -1509,7 +1509,7 @@ def _get_create_get_retain_release_functions(specs, namespace, tags):
             if re.match(r"function", obj['type']):
                 funcs.append(make_func_name(namespace, tags, obj))
 
-    create_suffixes = r"(Create[A-Za-z]*){1}$"
+    create_suffixes = r"(Create[A-Za-z]*|CloneExp){1}$"
     get_suffixes = r"(Get){1}$"
     retain_suffixes = r"(Retain){1}$"
     release_suffixes = r"(Release){1}$"
@@ -1562,3 +1562,13 @@ def get_handle_create_get_retain_release_functions(specs, namespace, tags):
         records.append(record)
 
     return records
+
+
+"""
+Public:
+    returns a list of all functions creating, getting, retaining or releasing
+    handles
+"""
+def get_create_get_retain_release_functions(specs, namespace, tags):
+    funcs = _get_create_get_retain_release_functions(specs, namespace, tags)
+    return funcs['create'] + funcs['get'] + funcs['retain'] + funcs['release']
@@ -7,6 +7,12 @@ from templates import helper as th
 
     x=tags['$x']
     X=x.upper()
+
+    # functions the loader emulates for adapters which don't implement them
+    emulated=[x + 'KernelCloneExp', x + 'ProgramBuildAsyncExp']
+
+    # kernel functions which update the state recorded for emulating KernelCloneExp
+    kernel_clone_re=r"\w+Kernel(SetArg\w+|SetExecInfo|SetSpecializationConstants|Retain|Release|CloneExp)$"
 %>/*
  *
  * Copyright (C) 2022-2023 Intel Corporation
@@ -18,8 +24,10 @@ from templates import helper as th
  * @file ${name}.cpp
  *
  */
+#include "${x}_kernel_clone.hpp"
 #include "${x}_lib_loader.hpp"
 #include "${x}_loader.hpp"
+#include "${x}_program_build_async.hpp"
 
 namespace ur_loader
 {
@@ -134,8 +142,15 @@ namespace ur_loader
         // extract platform's function pointer table
         auto dditable = reinterpret_cast<${item['obj']}*>( ${item['pointer']}${item['name']} )->dditable;
         auto ${th.make_pfn_name(n, tags, obj)} = dditable->${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        %if th.make_func_name(n, tags, obj) not in emulated:
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNINITIALIZED;
+        %endif
+        %if re.match(kernel_clone_re, th.make_func_name(n, tags, obj)):
+
+        // keep the loader object, which holds the state recorded for emulating ${x}KernelCloneExp
+        auto pKernelObject = reinterpret_cast<${x}_kernel_object_t*>( hKernel );
+        %endif
 
         <%break%>
         %endif
@@ -259,6 +274,22 @@ namespace ur_loader
         %endif
 
         // forward to device-platform
+        %if th.make_func_name(n, tags, obj) == x + 'KernelCloneExp':
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
+            // emulate the clone with the arguments recorded by the loader
+            result = kernel_clone::${th.make_func_name(n, tags, obj)}( pKernelObject, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"])[1:])} );
+        } else
+        %elif th.make_func_name(n, tags, obj) == x + 'KernelRelease':
+        if( nullptr == dditable->${n}.KernelExp.pfnCloneExp ) {
+            // release and drop the arguments recorded for ${x}KernelCloneExp
+            result = kernel_clone::${th.make_func_name(n, tags, obj)}( pKernelObject );
+        } else
+        %elif th.make_func_name(n, tags, obj) == x + 'ProgramBuildAsyncExp':
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
+            // build on the loader's compile threads
+            result = program_build_async::${th.make_func_name(n, tags, obj)}( dditable, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        } else
+        %endif
         %if add_local:
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name", "local"], replacements=param_replacements))} );
         %else:
@@ -268,6 +299,17 @@ namespace ur_loader
         del param_replacements
         del add_local
         %>
+        %if re.match(r"\w+KernelSet(Arg\w+|ExecInfo|SpecializationConstants)$", th.make_func_name(n, tags, obj)):
+
+        // record the arguments for emulating ${x}KernelCloneExp
+        if( ${X}_RESULT_SUCCESS == result && nullptr == dditable->${n}.KernelExp.pfnCloneExp )
+            result = kernel_clone::${th.make_func_name(n, tags, obj)}( pKernelObject, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"])[1:])} );
+        %elif th.make_func_name(n, tags, obj) == x + 'KernelRetain':
+
+        // count the references to the arguments recorded for ${x}KernelCloneExp
+        if( ${X}_RESULT_SUCCESS == result && nullptr == dditable->${n}.KernelExp.pfnCloneExp )
+            kernel_clone::retain( pKernelObject );
+        %endif
         %for i, item in enumerate(epilogue):
         %if 0 == i:
         if( ${X}_RESULT_SUCCESS != result )
@@ -322,9 +364,50 @@ namespace ur_loader
         %endif
 
         %endfor
+        %if re.match(r"\w+Kernel(Create|CreateWithNativeHandle)$", th.make_func_name(n, tags, obj)):
+        // count the references to the arguments recorded for ${x}KernelCloneExp
+        if( ${X}_RESULT_SUCCESS == result && nullptr == dditable->${n}.KernelExp.pfnCloneExp )
+            kernel_clone::retain( reinterpret_cast<${x}_kernel_object_t*>( *phKernel ) );
+
+        %endif
         %endif
         return result;
     }
+    %if th.make_func_name(n, tags, obj) == x + 'ProgramBuildAsyncExp':
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Emulation of ${th.make_func_name(n, tags, obj)} installed in the DDI table of the
+    ///        only platform, when the loader doesn't intercept its calls
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${th.make_func_name(n, tags, obj)}Direct(
+        %for line in th.make_param_lines(n, tags, obj):
+        ${line}
+        %endfor
+        )
+    {
+        // build on the loader's compile threads
+        return program_build_async::${th.make_func_name(n, tags, obj)}( &context->platforms.front().dditable, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    }
+    %elif th.make_func_name(n, tags, obj) == x + 'KernelCloneExp':
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Fallback for ${th.make_func_name(n, tags, obj)} installed in the DDI table of the
+    ///        only platform, when the loader doesn't intercept its calls
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${th.make_func_name(n, tags, obj)}Direct(
+        %for line in th.make_param_lines(n, tags, obj):
+        ${line}
+        %endfor
+        )
+    {
+        // the emulation replays the arguments recorded in the loader's kernel
+        // objects, which only exist when the loader intercepts calls
+        %for param in th.make_param_lines(n, tags, obj, format=["name"]):
+        std::ignore = ${param};
+        %endfor
+        return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    %endif
     %if 'condition' in obj:
     #endif // ${th.subt(n, tags, obj['condition'])}
     %endif
@@ -394,6 +477,12 @@ ${tbl['export']['name']}(
         {
             // return pointers directly to platform's DDIs
             *pDdiTable = ur_loader::context->platforms.front().dditable.${n}.${tbl['name']};
+            %for obj in tbl['functions']:
+            %if th.make_func_name(n, tags, obj) in emulated:
+            if( nullptr == pDdiTable->${th.make_pfn_name(n, tags, obj)} )
+                pDdiTable->${th.make_pfn_name(n, tags, obj)} = ur_loader::${th.make_func_name(n, tags, obj)}Direct;
+            %endif
+            %endfor
         }
     }
 
@@ -21,6 +21,7 @@ from templates import helper as th
 #ifndef UR_LOADER_LDRDDI_H
 #define UR_LOADER_LDRDDI_H 1
 
+#include "${x}_kernel_clone.hpp"
 #include "${x}_object.hpp"
 #include "${x}_singleton.hpp"
 
@@ -33,7 +34,13 @@ namespace ur_loader
         _handle_t = th.subt(n, tags, obj['name'])
         _object_t = re.sub(r"(\w+)_handle_t", r"\1_object_t", _handle_t)
         _factory_t = re.sub(r"(\w+)_handle_t", r"\1_factory_t", _handle_t)
-    %>using ${th.append_ws(_object_t, 35)} = object_t < ${_handle_t} >;
+    %>
+    %if _object_t == x + '_kernel_object_t':
+    ## kernel objects also hold the state recorded for emulating ${x}KernelCloneExp
+    using ${th.append_ws(_object_t, 35)} = kernel_clone::kernel_object_t;
+    %else:
+    using ${th.append_ws(_object_t, 35)} = object_t < ${_handle_t} >;
+    %endif
     using ${th.append_ws(_factory_t, 35)} = singleton_factory_t < ${_object_t}, ${_handle_t} >;
 
     %endif
@@ -9,6 +9,7 @@ from templates import helper as th
     X=x.upper()
 
     handle_create_get_retain_release_funcs=th.get_handle_create_get_retain_release_functions(specs, n, tags)
+    create_get_retain_release_funcs=th.get_create_get_retain_release_functions(specs, n, tags)
 %>/*
  *
  * Copyright (C) 2023-2024 Intel Corporation
@@ -34,6 +35,11 @@ namespace ur_validation_layer
         sorted_param_checks = sorted(param_checks, key=lambda pair: False if pair[0] in first_errors else True)
 
         tracked_params = list(filter(lambda p: any(th.subt(n, tags, p['type']) in [hf['handle'], hf['handle'] + "*"] for hf in handle_create_get_retain_release_funcs), obj['params']))
+
+        ## calls managing handles are always validated, other calls are sampled per function table
+        sampled = func_name not in create_get_retain_release_funcs
+        sampling_family = re.sub(r"Exp$", "", th.get_table_name(n, tags, obj)).lower()
+        if_sampled = "validate && " if sampled else ""
     %>
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
@@ -53,7 +59,12 @@ namespace ur_validation_layer
             return ${X}_RESULT_ERROR_UNINITIALIZED;
         }
 
-        if( context.enableParameterValidation )
+        %if sampled:
+        static auto &sampler = context.getSampler("${sampling_family}");
+        const bool validate = sampler.sample();
+
+        %endif
+        if( ${if_sampled}context.enableParameterValidation )
         {
             %for key, values in sorted_param_checks:
             %for val in values:
@@ -80,7 +91,7 @@ namespace ur_validation_layer
                 is_related_create_get_retain_release_func = any(func_name in funcs for funcs in tp_input_handle_funcs.values())
             %>
             %if tp_input_handle_funcs and not is_related_create_get_retain_release_func:
-            if (context.enableLifetimeValidation && !refCountContext.isReferenceValid(${tp['name']})) {
+            if (${if_sampled}context.enableLifetimeValidation && !refCountContext.isReferenceValid(${tp['name']})) {
                 refCountContext.logInvalidReference(${tp['name']});
             }
             %endif
@@ -93,7 +104,7 @@ namespace ur_validation_layer
             tp_handle_funcs = next((hf for hf in handle_create_get_retain_release_funcs if th.subt(n, tags, tp['type']) in [hf['handle'], hf['handle'] + "*"]), None)
             is_handle_to_adapter = ("_adapter_handle_t" in tp['type'])
         %>
-        %if func_name in tp_handle_funcs['create']:
+        %if func_name in tp_handle_funcs['create'] and "[out]" in tp['desc']:
         if( context.enableLeakChecking && result == UR_RESULT_SUCCESS )
         {
             refCountContext.createRefCount(*${tp['name']});
@@ -211,6 +222,8 @@ namespace ur_validation_layer
     ${x}_result_t context_t::tearDown() {
         ${x}_result_t result = ${X}_RESULT_SUCCESS;
 
+        logSamplingCounters();
+
         if (enableLeakChecking) {
             refCountContext.logInvalidReferences();
             refCountContext.clear();
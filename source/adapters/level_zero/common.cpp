@@ -75,6 +75,9 @@ void urPrint(const char *Format, ...) {
 usm::DisjointPoolAllConfigs DisjointPoolConfigInstance =
     InitializeDisjointPoolConfig();
 
+std::unique_ptr<usm::DisjointPoolTuner> DisjointPoolTunerInstance =
+    InitializeDisjointPoolTuner(DisjointPoolConfigInstance);
+
 // This function will ensure compatibility with both Linux and Windows for
 // setting environment variables.
 bool setEnvVar(const char *name, const char *value) {
@@ -24,6 +24,7 @@
 #include <zes_api.h>
 
 #include <umf_pools/disjoint_pool_config_parser.hpp>
+#include <umf_pools/disjoint_pool_tuner.hpp>
 
 struct _ur_platform_handle_t;
 
@@ -400,6 +401,8 @@ struct MemAllocRecord : _ur_object {
 };
 
 extern usm::DisjointPoolAllConfigs DisjointPoolConfigInstance;
+// Non-null when adaptive tuning of the USM pools is enabled.
+extern std::unique_ptr<usm::DisjointPoolTuner> DisjointPoolTunerInstance;
 extern const bool UseUSMAllocator;
 
 // Controls support of the indirect access kernels and deferred memory release.
@@ -178,12 +178,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextSetExtendedDeleter(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-ur_result_t ur_context_handle_t_::initialize() {
-
-  // Helper lambda to create various USM allocators for a device.
+void ur_context_handle_t_::createUSMPools(
+    const usm::DisjointPoolAllConfigs &PoolConfigs) {
+  // Helper lambda to create the pooling USM allocators for a device.
   // Note that the CCS devices and their respective subdevices share a
   // common ze_device_handle and therefore, also share USM allocators.
-  auto createUSMAllocators = [this](ur_device_handle_t Device) {
+  auto createUSMAllocators = [this, &PoolConfigs](ur_device_handle_t Device) {
     auto MemProvider = umf::memoryProviderMakeUnique<L0DeviceMemoryProvider>(
                            reinterpret_cast<ur_context_handle_t>(this), Device)
                            .second;
@@ -191,7 +191,7 @@ ur_result_t ur_context_handle_t_::initialize() {
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
         std::make_tuple(umf::poolMakeUniqueFromOps(
                             &UMF_DISJOINT_POOL_OPS, std::move(MemProvider),
-                            &DisjointPoolConfigInstance
+                            &PoolConfigs
                                  .Configs[usm::DisjointPoolMemType::Device])
                             .second));
 
@@ -202,7 +202,7 @@ ur_result_t ur_context_handle_t_::initialize() {
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
         std::make_tuple(umf::poolMakeUniqueFromOps(
                             &UMF_DISJOINT_POOL_OPS, std::move(MemProvider),
-                            &DisjointPoolConfigInstance
+                            &PoolConfigs
                                  .Configs[usm::DisjointPoolMemType::Shared])
                             .second));
 
@@ -214,13 +214,87 @@ ur_result_t ur_context_handle_t_::initialize() {
         std::make_tuple(
             umf::poolMakeUniqueFromOps(
                 &UMF_DISJOINT_POOL_OPS, std::move(MemProvider),
-                &DisjointPoolConfigInstance
-                     .Configs[usm::DisjointPoolMemType::SharedReadOnly])
+                &PoolConfigs.Configs[usm::DisjointPoolMemType::SharedReadOnly])
                 .second));
+  };
 
-    MemProvider = umf::memoryProviderMakeUnique<L0DeviceMemoryProvider>(
-                      reinterpret_cast<ur_context_handle_t>(this), Device)
-                      .second;
+  // Recursive helper to call createUSMAllocators for all sub-devices
+  std::function<void(ur_device_handle_t)> createUSMAllocatorsRecursive;
+  createUSMAllocatorsRecursive =
+      [createUSMAllocators,
+       &createUSMAllocatorsRecursive](ur_device_handle_t Device) -> void {
+    createUSMAllocators(Device);
+    for (auto &SubDevice : Device->SubDevices)
+      createUSMAllocatorsRecursive(SubDevice);
+  };
+
+  // Create USM pool for each pair (device, context).
+  //
+  for (auto &Device : Devices) {
+    createUSMAllocatorsRecursive(Device);
+  }
+  // Create USM pool for host. Device and Shared USM allocations
+  // are device-specific. Host allocations are not device-dependent therefore
+  // we don't need a map with device as key.
+  auto MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
+                         reinterpret_cast<ur_context_handle_t>(this), nullptr)
+                         .second;
+  HostMemPool =
+      umf::poolMakeUniqueFromOps(
+          &UMF_DISJOINT_POOL_OPS, std::move(MemProvider),
+          &PoolConfigs.Configs[usm::DisjointPoolMemType::Host])
+          .second;
+
+  // We may allocate memory to this root device so create allocators.
+  if (SingleRootDevice &&
+      DeviceMemPools.find(SingleRootDevice->ZeDevice) == DeviceMemPools.end()) {
+    createUSMAllocators(SingleRootDevice);
+  }
+}
+
+std::shared_lock<ur_shared_mutex> ur_context_handle_t_::retuneUSMPools() {
+  if (!DisjointPoolTunerInstance) {
+    return {};
+  }
+
+  auto RetuneCount = DisjointPoolTunerInstance->getRetuneCount();
+  if (RetuneCount != MemPoolsRetuneCount.load(std::memory_order_acquire)) {
+    std::scoped_lock<ur_shared_mutex> Lock(MemPoolsMutex);
+    if (RetuneCount != MemPoolsRetuneCount.load(std::memory_order_relaxed)) {
+      // UMF pools can't be reconfigured, so allocate from new ones and keep
+      // the old ones for the memory still allocated from them.
+      for (auto *Pools :
+           {&DeviceMemPools, &SharedMemPools, &SharedReadOnlyMemPools}) {
+        for (auto &[ZeDevice, Pool] : *Pools) {
+          std::ignore = ZeDevice;
+          RetiredMemPools.push_back(std::move(Pool));
+        }
+        Pools->clear();
+      }
+      RetiredMemPools.push_back(std::move(HostMemPool));
+      createUSMPools(DisjointPoolTunerInstance->getConfigs());
+      MemPoolsRetuneCount.store(RetuneCount, std::memory_order_release);
+    }
+  }
+  return std::shared_lock<ur_shared_mutex>(MemPoolsMutex);
+}
+
+ur_result_t ur_context_handle_t_::initialize() {
+
+  // Pools copy their configuration on creation, so take the latest tuned one.
+  // A retune made meanwhile is picked up by the next retuneUSMPools.
+  usm::DisjointPoolAllConfigs PoolConfigs = DisjointPoolConfigInstance;
+  if (DisjointPoolTunerInstance) {
+    MemPoolsRetuneCount = DisjointPoolTunerInstance->getRetuneCount();
+    PoolConfigs = DisjointPoolTunerInstance->getConfigs();
+  }
+  createUSMPools(PoolConfigs);
+
+  // Helper lambda to create the allocation-tracking proxy pools for a device.
+  auto createUSMProxyAllocators = [this](ur_device_handle_t Device) {
+    auto MemProvider = umf::memoryProviderMakeUnique<L0DeviceMemoryProvider>(
+                           reinterpret_cast<ur_context_handle_t>(this), Device)
+                           .second;
     DeviceMemProxyPools.emplace(
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
         std::make_tuple(
@@ -243,43 +317,29 @@ ur_result_t ur_context_handle_t_::initialize() {
             umf::poolMakeUnique<USMProxyPool>(std::move(MemProvider)).second));
   };
 
-  // Recursive helper to call createUSMAllocators for all sub-devices
-  std::function<void(ur_device_handle_t)> createUSMAllocatorsRecursive;
-  createUSMAllocatorsRecursive =
-      [createUSMAllocators,
-       &createUSMAllocatorsRecursive](ur_device_handle_t Device) -> void {
-    createUSMAllocators(Device);
+  std::function<void(ur_device_handle_t)> createUSMProxyAllocatorsRecursive;
+  createUSMProxyAllocatorsRecursive =
+      [createUSMProxyAllocators,
+       &createUSMProxyAllocatorsRecursive](ur_device_handle_t Device) -> void {
+    createUSMProxyAllocators(Device);
     for (auto &SubDevice : Device->SubDevices)
-      createUSMAllocatorsRecursive(SubDevice);
+      createUSMProxyAllocatorsRecursive(SubDevice);
   };
 
-  // Create USM pool for each pair (device, context).
-  //
   for (auto &Device : Devices) {
-    createUSMAllocatorsRecursive(Device);
+    createUSMProxyAllocatorsRecursive(Device);
   }
-  // Create USM pool for host. Device and Shared USM allocations
-  // are device-specific. Host allocations are not device-dependent therefore
-  // we don't need a map with device as key.
+
   auto MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
                          reinterpret_cast<ur_context_handle_t>(this), nullptr)
                          .second;
-  HostMemPool =
-      umf::poolMakeUniqueFromOps(
-          &UMF_DISJOINT_POOL_OPS, std::move(MemProvider),
-          &DisjointPoolConfigInstance.Configs[usm::DisjointPoolMemType::Host])
-          .second;
-
-  MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
-                    reinterpret_cast<ur_context_handle_t>(this), nullptr)
-                    .second;
   HostMemProxyPool =
       umf::poolMakeUnique<USMProxyPool>(std::move(MemProvider)).second;
 
-  // We may allocate memory to this root device so create allocators.
   if (SingleRootDevice &&
-      DeviceMemPools.find(SingleRootDevice->ZeDevice) == DeviceMemPools.end()) {
-    createUSMAllocators(SingleRootDevice);
+      DeviceMemProxyPools.find(SingleRootDevice->ZeDevice) ==
+          DeviceMemProxyPools.end()) {
+    createUSMProxyAllocators(SingleRootDevice);
   }
 
   // Create the immediate command list to be used for initializations.
@@ -106,6 +106,16 @@ struct ur_context_handle_t_ : _ur_object {
   // Store the host memory pool. It does not depend on any device.
   umf::pool_unique_handle_t HostMemPool;
 
+  // Pools replaced by retuneUSMPools. They stay alive until the context is
+  // destroyed, as umfPoolByPtr routes the frees of their allocations to them.
+  std::vector<umf::pool_unique_handle_t> RetiredMemPools;
+  // Retune count of DisjointPoolTunerInstance the pools above were created
+  // with.
+  std::atomic<size_t> MemPoolsRetuneCount{0};
+  // Held exclusively to replace the pools above, and shared to look them up,
+  // when adaptive tuning of the USM pools is enabled.
+  ur_shared_mutex MemPoolsMutex;
+
   // Allocation-tracking proxy pools for direct allocations. No pooling used.
   std::unordered_map<ze_device_handle_t, umf::pool_unique_handle_t>
       DeviceMemProxyPools;
@@ -173,6 +183,15 @@ struct ur_context_handle_t_ : _ur_object {
   // Initialize the PI context.
   ur_result_t initialize();
 
+  // Creates the pooling USM allocators of each device and of the host.
+  void createUSMPools(const usm::DisjointPoolAllConfigs &PoolConfigs);
+
+  // Replaces the pooling USM allocators with ones using the latest tuned
+  // configuration if the pools were retuned since they were created, and
+  // returns a lock keeping them in place while they are looked up. The lock
+  // is empty if adaptive tuning is disabled.
+  std::shared_lock<ur_shared_mutex> retuneUSMPools();
+
   // If context contains one device then return this device.
   // If context contains sub-devices of the same device, then return this parent
   // device. Return nullptr if context consists of several devices which are not
@@ -72,6 +72,24 @@ usm::DisjointPoolAllConfigs InitializeDisjointPoolConfig() {
   return usm::parseDisjointPoolConfig(PoolConfigVal, PoolTrace);
 }
 
+// UR_L0_USM_ALLOCATOR_ADAPTIVE enables adaptive tuning of the USM pools, see
+// usm::parseDisjointPoolTunerConfig for the format of the value.
+//
+// UMF pools can't be reconfigured, so after a retune a context allocates from
+// new pools using the tuned MaxPoolableSize and Capacity, see
+// ur_context_handle_t_::retuneUSMPools. Pools created with urUSMPoolCreate
+// keep the configuration they were created with.
+std::unique_ptr<usm::DisjointPoolTuner>
+InitializeDisjointPoolTuner(const usm::DisjointPoolAllConfigs &Configs) {
+  const char *PoolTunerVal = std::getenv("UR_L0_USM_ALLOCATOR_ADAPTIVE");
+  if (PoolTunerVal == nullptr) {
+    return nullptr;
+  }
+
+  return std::make_unique<usm::DisjointPoolTuner>(
+      Configs, usm::parseDisjointPoolTunerConfig(PoolTunerVal));
+}
+
 enum class USMAllocationForceResidencyType {
   // Do not force memory residency at allocation time.
   None = 0,
@@ -345,6 +363,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMHostAlloc(
   } else if (Pool) {
     hPoolInternal = Pool->HostMemPool.get();
   } else {
+    auto PoolsLock = Context->retuneUSMPools();
     hPoolInternal = Context->HostMemPool.get();
   }
 
@@ -354,6 +373,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMHostAlloc(
     return umf2urResult(umfRet);
   }
 
+  if (DisjointPoolTunerInstance) {
+    DisjointPoolTunerInstance->recordAlloc(usm::DisjointPoolMemType::Host,
+                                           *RetMem, Size);
+  }
+
   if (IndirectAccessTrackingEnabled) {
     // Keep track of all memory allocations in the context
     Context->MemAllocs.emplace(std::piecewise_construct,
@@ -420,6 +444,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMDeviceAlloc(
   } else if (Pool) {
     hPoolInternal = Pool->DeviceMemPools[Device].get();
   } else {
+    auto PoolsLock = Context->retuneUSMPools();
     auto It = Context->DeviceMemPools.find(Device->ZeDevice);
     if (It == Context->DeviceMemPools.end())
       return UR_RESULT_ERROR_INVALID_VALUE;
@@ -433,6 +458,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMDeviceAlloc(
     return umf2urResult(umfRet);
   }
 
+  if (DisjointPoolTunerInstance) {
+    DisjointPoolTunerInstance->recordAlloc(usm::DisjointPoolMemType::Device,
+                                           *RetMem, Size);
+  }
+
   if (IndirectAccessTrackingEnabled) {
     // Keep track of all memory allocations in the context
     Context->MemAllocs.emplace(std::piecewise_construct,
@@ -524,6 +554,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMSharedAlloc(
                         ? Pool->SharedReadOnlyMemPools[Device].get()
                         : Pool->SharedMemPools[Device].get();
   } else {
+    auto PoolsLock = Context->retuneUSMPools();
     auto &Allocator = (DeviceReadOnly ? Context->SharedReadOnlyMemPools
                                       : Context->SharedMemPools);
     auto It = Allocator.find(Device->ZeDevice);
@@ -539,6 +570,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMSharedAlloc(
     return umf2urResult(umfRet);
   }
 
+  if (DisjointPoolTunerInstance) {
+    DisjointPoolTunerInstance->recordAlloc(
+        DeviceReadOnly ? usm::DisjointPoolMemType::SharedReadOnly
+                       : usm::DisjointPoolMemType::Shared,
+        *RetMem, Size);
+  }
+
   if (IndirectAccessTrackingEnabled) {
     // Keep track of all memory allocations in the context
     Context->MemAllocs.emplace(std::piecewise_construct,
@@ -807,6 +845,10 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
   zeroInit = static_cast<uint32_t>(PoolDesc->flags &
                                    UR_USM_POOL_FLAG_ZERO_INITIALIZE_BLOCK);
 
+  if (DisjointPoolTunerInstance) {
+    DisjointPoolTunerInstance->applyTunedSettings(DisjointPoolConfigs);
+  }
+
   void *pNext = const_cast<void *>(PoolDesc->pNext);
   while (pNext != nullptr) {
     const ur_base_desc_t *BaseDesc =
@@ -1015,6 +1057,10 @@ ur_result_t USMFreeHelper(ur_context_handle_t Context, void *Ptr,
     return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
   }
 
+  if (DisjointPoolTunerInstance) {
+    DisjointPoolTunerInstance->recordFree(Ptr);
+  }
+
   auto umfRet = umfPoolFree(hPool, Ptr);
   if (IndirectAccessTrackingEnabled)
     UR_CALL(ContextReleaseHelper(Context));
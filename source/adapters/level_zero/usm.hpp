@@ -14,10 +14,14 @@
 #include <umf_helpers.hpp>
 
 usm::DisjointPoolAllConfigs InitializeDisjointPoolConfig();
+std::unique_ptr<usm::DisjointPoolTuner>
+InitializeDisjointPoolTuner(const usm::DisjointPoolAllConfigs &Configs);
 
 struct ur_usm_pool_handle_t_ : _ur_object {
   bool zeroInit;
 
+  // Each pool has its own MaxPoolSize limit, the constructor applies the
+  // tuned settings on top when adaptive tuning is enabled.
   usm::DisjointPoolAllConfigs DisjointPoolConfigs =
       InitializeDisjointPoolConfig();
 
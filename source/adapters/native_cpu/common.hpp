@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "logger/ur_logger.hpp"
 #include "ur/ur.hpp"
 
 constexpr size_t MaxMessageSize = 256;
@@ -25,11 +26,26 @@ extern thread_local char ErrorMessage[MaxMessageSize];
   }                                                                            \
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+namespace native_cpu {
+// Logger of CONTINUE_NO_IMPLEMENTATION, it reports the messages left
+// suppressed by the rate limits of the call sites when it is destroyed.
+inline logger::Logger &noImplementationLogger() {
+  static logger::Logger Logger(
+      logger::Level::WARN,
+      std::make_unique<logger::StderrSink>("native_cpu", true));
+  return Logger;
+}
+} // namespace native_cpu
+
+// Reported at most logger::RateLimit::DEFAULT_BURST times per second, as
+// callers carry on and may hit it on every call.
 #define CONTINUE_NO_IMPLEMENTATION                                             \
   if (PrintTrace) {                                                            \
-    std::cerr << "Warning : Not Implemented : " << __FUNCTION__                \
-              << " - File : " << __FILE__;                                     \
-    std::cerr << " / Line : " << __LINE__ << std::endl;                        \
+    UR_LOG_RATE_LIMITED(native_cpu::noImplementationLogger(),                  \
+                        logger::Level::WARN,                                   \
+                        "Warning : Not Implemented : {} - File : {} / Line : " \
+                        "{}",                                                  \
+                        __FUNCTION__, __FILE__, __LINE__);                     \
   }                                                                            \
   return UR_RESULT_SUCCESS;
 
@@ -18,14 +18,14 @@
 #include "context.hpp"
 
 UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
-    [[maybe_unused]] uint32_t DeviceCount, const ur_device_handle_t *phDevices,
+    uint32_t DeviceCount, const ur_device_handle_t *phDevices,
     const ur_context_properties_t *pProperties,
     ur_context_handle_t *phContext) {
   std::ignore = pProperties;
-  assert(DeviceCount == 1);
+  UR_ASSERT(DeviceCount > 0, UR_RESULT_ERROR_INVALID_SIZE);
 
   // TODO: Proper error checking.
-  auto ctx = new ur_context_handle_t_(*phDevices);
+  auto ctx = new ur_context_handle_t_(DeviceCount, phDevices);
   *phContext = ctx;
   return UR_RESULT_SUCCESS;
 }
@@ -49,11 +49,11 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
 
   switch (propName) {
   case UR_CONTEXT_INFO_NUM_DEVICES:
-    return returnValue(1);
+    return returnValue(static_cast<uint32_t>(hContext->Devices.size()));
   case UR_CONTEXT_INFO_DEVICES:
-    return returnValue(hContext->_device);
+    return returnValue(hContext->Devices.data(), hContext->Devices.size());
   case UR_CONTEXT_INFO_REFERENCE_COUNT:
-    return returnValue(nullptr);
+    return returnValue(hContext->getReferenceCount());
   case UR_CONTEXT_INFO_USM_MEMCPY2D_SUPPORT:
     return returnValue(true);
   case UR_CONTEXT_INFO_USM_FILL2D_SUPPORT:
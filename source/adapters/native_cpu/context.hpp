@@ -10,13 +10,42 @@
 
 #pragma once
 
+#include <vector>
+
+#include <umf_helpers.hpp>
 #include <ur_api.h>
 
 #include "common.hpp"
 #include "device.hpp"
+#include "event.hpp"
+#include "scheduler.hpp"
+
+namespace native_cpu {
+// Creates the pool serving the USM allocations of a context, backed by huge
+// pages where possible. Returns an empty handle when UMF fails to create it
+// or on platforms without the host memory provider, USM allocations then
+// fall back to malloc.
+umf::pool_unique_handle_t createHostMemPool();
+
+// Queues with a scheduler track the USM allocations made while they exist,
+// see usmAccess.
+void retainUSMTracking();
+void releaseUSMTracking();
+
+// Returns a read-write access to the USM allocation Ptr points into, or to
+// all memory if Ptr is not in a tracked USM allocation.
+mem_access_t usmAccess(const void *Ptr);
+} // namespace native_cpu
 
 struct ur_context_handle_t_ : RefCounted {
-  ur_context_handle_t_(ur_device_handle_t_ *phDevices) : _device{phDevices} {}
+  ur_context_handle_t_(uint32_t NumDevices, const ur_device_handle_t *phDevices)
+      : _device{phDevices[0]}, Devices(phDevices, phDevices + NumDevices),
+        HostMemPool(native_cpu::createHostMemPool()) {}
 
+  // All the devices of a context share the host memory, _device is the first
+  // of them.
   ur_device_handle_t _device;
+  std::vector<ur_device_handle_t> Devices;
+  native_cpu::event_pool EventPool;
+  umf::pool_unique_handle_t HostMemPool;
 };
@@ -11,6 +11,319 @@
 #include <ur_api.h>
 
 #include "platform.hpp"
+#include "program.hpp"
+#include "ur_util.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <cpuid.h>
+#define NATIVE_CPU_X86
+#endif
+
+namespace native_cpu {
+
+#if defined(__linux__)
+template <typename T> static bool readSysValue(const std::string &Path, T &Val) {
+  std::ifstream File(Path);
+  return static_cast<bool>(File >> Val);
+}
+
+static void queryCaches(host_info &Info) {
+  uint32_t LastLevel = 0;
+  for (int Index = 0;; Index++) {
+    const std::string Dir =
+        "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(Index);
+    uint32_t Level = 0;
+    std::string Type, Size;
+    if (!readSysValue(Dir + "/level", Level) ||
+        !readSysValue(Dir + "/type", Type) ||
+        !readSysValue(Dir + "/size", Size)) {
+      break;
+    }
+    if (Type == "Instruction") {
+      continue;
+    }
+    // Sizes are given like "48K" or "2048K".
+    const uint64_t Bytes = ur_parse_size(Size).value_or(0);
+    if (Level == 1) {
+      Info.L1DataCacheSize = Bytes;
+      uint32_t LineSize = 0;
+      if (readSysValue(Dir + "/coherency_line_size", LineSize) && LineSize) {
+        Info.CacheLineSize = LineSize;
+      }
+    } else if (Level == 2) {
+      Info.L2CacheSize = Bytes;
+    }
+    if (Level >= LastLevel) {
+      LastLevel = Level;
+      Info.LastLevelCacheSize = Bytes;
+    }
+  }
+
+  // Fall back to glibc, which reads the same information from CPUID.
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  auto Fallback = [](uint64_t &Val, int Name) {
+    const long Res = sysconf(Name);
+    if (Val == 0 && Res > 0) {
+      Val = static_cast<uint64_t>(Res);
+    }
+  };
+  Fallback(Info.L1DataCacheSize, _SC_LEVEL1_DCACHE_SIZE);
+  Fallback(Info.L2CacheSize, _SC_LEVEL2_CACHE_SIZE);
+  Fallback(Info.LastLevelCacheSize, _SC_LEVEL3_CACHE_SIZE);
+  Fallback(Info.LastLevelCacheSize, _SC_LEVEL2_CACHE_SIZE);
+#endif
+}
+
+static uint64_t queryMemTotal() {
+  std::ifstream MemInfo("/proc/meminfo");
+  std::string Key;
+  uint64_t KiB = 0;
+  while (MemInfo >> Key >> KiB) {
+    if (Key == "MemTotal:") {
+      return KiB << 10;
+    }
+    MemInfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+  const long Pages = sysconf(_SC_PHYS_PAGES);
+  const long PageSize = sysconf(_SC_PAGESIZE);
+  if (Pages > 0 && PageSize > 0) {
+    return static_cast<uint64_t>(Pages) * static_cast<uint64_t>(PageSize);
+  }
+  return 0;
+}
+
+// Number of CPUs in the affinity mask of the process, e.g. restricted by a
+// container cpuset or taskset. 0 if unknown.
+static uint32_t queryAffinityCPUs() {
+  // The mask may be larger than a cpu_set_t on big machines.
+  for (int NumCPUs = CPU_SETSIZE; NumCPUs <= (1 << 16); NumCPUs *= 2) {
+    cpu_set_t *Set = CPU_ALLOC(NumCPUs);
+    if (!Set) {
+      return 0;
+    }
+    const size_t Size = CPU_ALLOC_SIZE(NumCPUs);
+    CPU_ZERO_S(Size, Set);
+    const bool Ok = sched_getaffinity(0, Size, Set) == 0;
+    const int Count = Ok ? CPU_COUNT_S(Size, Set) : 0;
+    CPU_FREE(Set);
+    if (Ok) {
+      return static_cast<uint32_t>(Count);
+    }
+    if (errno != EINVAL) {
+      return 0;
+    }
+  }
+  return 0;
+}
+
+// Rounds a CPU bandwidth quota up to whole CPUs, 0 if unlimited.
+static uint32_t quotaToCPUs(int64_t Quota, int64_t Period) {
+  if (Quota <= 0 || Period <= 0) {
+    return 0;
+  }
+  return static_cast<uint32_t>((Quota + Period - 1) / Period);
+}
+
+// Lowest CPU bandwidth limit of the cgroup of the process and its ancestors,
+// in whole CPUs. 0 if there is no limit or no cgroup file system.
+static uint32_t queryCgroupCPULimit() {
+  // Lines of /proc/self/cgroup look like "0::/path" for cgroup v2 and
+  // "4:cpu,cpuacct:/path" for cgroup v1.
+  std::ifstream Cgroups("/proc/self/cgroup");
+  std::string Line, V2Path, V1Path;
+  while (std::getline(Cgroups, Line)) {
+    const auto First = Line.find(':');
+    const auto Second = Line.find(':', First + 1);
+    if (First == std::string::npos || Second == std::string::npos) {
+      continue;
+    }
+    const std::string Controllers = Line.substr(First + 1, Second - First - 1);
+    const std::string Path = Line.substr(Second + 1);
+    if (Controllers.empty()) {
+      V2Path = Path;
+    } else if (("," + Controllers + ",").find(",cpu,") != std::string::npos) {
+      V1Path = Path;
+    }
+  }
+
+  uint32_t Limit = 0;
+  auto applyLimit = [&Limit](uint32_t CPUs) {
+    if (CPUs && (!Limit || CPUs < Limit)) {
+      Limit = CPUs;
+    }
+  };
+  // Inside a container the cgroup namespace usually makes the path "/", and
+  // limits set on ancestors apply too, so walk up to the mount root.
+  auto forEachLevel = [](std::string Path, auto &&Fn) {
+    while (true) {
+      Fn(Path == "/" ? std::string() : Path);
+      if (Path.empty() || Path == "/") {
+        break;
+      }
+      Path = Path.substr(0, Path.rfind('/'));
+    }
+  };
+
+  if (!V2Path.empty() || V1Path.empty()) {
+    forEachLevel(V2Path, [&](const std::string &Dir) {
+      // "max 100000" when unlimited, "<quota> <period>" otherwise.
+      std::ifstream CpuMax("/sys/fs/cgroup" + Dir + "/cpu.max");
+      std::string Quota;
+      int64_t Period = 0;
+      if (CpuMax >> Quota >> Period && Quota != "max") {
+        try {
+          applyLimit(quotaToCPUs(std::stoll(Quota), Period));
+        } catch (...) {
+        }
+      }
+    });
+  }
+  if (!V1Path.empty()) {
+    for (const char *Mount :
+         {"/sys/fs/cgroup/cpu,cpuacct", "/sys/fs/cgroup/cpu"}) {
+      forEachLevel(V1Path, [&](const std::string &Dir) {
+        int64_t Quota = 0, Period = 0;
+        if (readSysValue(Mount + Dir + "/cpu.cfs_quota_us", Quota) &&
+            readSysValue(Mount + Dir + "/cpu.cfs_period_us", Period)) {
+          applyLimit(quotaToCPUs(Quota, Period));
+        }
+      });
+    }
+  }
+  return Limit;
+}
+
+static uint32_t queryMaxClockMHz() {
+  uint64_t KHz = 0;
+  if (readSysValue("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq",
+                   KHz)) {
+    return static_cast<uint32_t>(KHz / 1000);
+  }
+  // Without cpufreq (e.g. in most VMs) use the frequency the kernel measured
+  // at boot.
+  std::ifstream CpuInfo("/proc/cpuinfo");
+  std::string Line;
+  while (std::getline(CpuInfo, Line)) {
+    if (Line.rfind("cpu MHz", 0) == 0) {
+      auto Colon = Line.find(':');
+      if (Colon != std::string::npos) {
+        try {
+          return static_cast<uint32_t>(std::stod(Line.substr(Colon + 1)));
+        } catch (...) {
+        }
+      }
+      break;
+    }
+  }
+  return 0;
+}
+#endif
+
+#if defined(NATIVE_CPU_X86)
+static void queryX86(host_info &Info) {
+  unsigned Eax, Ebx, Ecx, Edx;
+  if (__get_cpuid(0, &Eax, &Ebx, &Ecx, &Edx)) {
+    char Vendor[13] = {};
+    memcpy(Vendor, &Ebx, 4);
+    memcpy(Vendor + 4, &Edx, 4);
+    memcpy(Vendor + 8, &Ecx, 4);
+    if (strcmp(Vendor, "GenuineIntel") == 0) {
+      Info.VendorId = 0x8086;
+    } else if (strcmp(Vendor, "AuthenticAMD") == 0) {
+      Info.VendorId = 0x1022;
+    }
+  }
+
+  // __builtin_cpu_supports also checks that the OS saves the wider register
+  // state, which a plain CPUID feature bit does not tell.
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    Info.VectorBytesFP = 64;
+    Info.VectorBytesInt = __builtin_cpu_supports("avx512bw") ? 64 : 32;
+  } else if (__builtin_cpu_supports("avx2")) {
+    Info.VectorBytesFP = 32;
+    Info.VectorBytesInt = 32;
+  } else if (__builtin_cpu_supports("avx")) {
+    Info.VectorBytesFP = 32;
+    Info.VectorBytesInt = 16;
+  } else if (__builtin_cpu_supports("sse2")) {
+    Info.VectorBytesFP = 16;
+    Info.VectorBytesInt = 16;
+  }
+
+  auto Bit = [](bool Supported, uint64_t Feature) {
+    return Supported ? Feature : 0;
+  };
+  Info.ISAFeatures =
+      Bit(__builtin_cpu_supports("sse4.2"), NATIVECPU_ISA_SSE4_2) |
+      Bit(__builtin_cpu_supports("avx"), NATIVECPU_ISA_AVX) |
+      Bit(__builtin_cpu_supports("avx2"), NATIVECPU_ISA_AVX2) |
+      Bit(__builtin_cpu_supports("fma"), NATIVECPU_ISA_FMA) |
+      Bit(__builtin_cpu_supports("avx512f"), NATIVECPU_ISA_AVX512F) |
+      Bit(__builtin_cpu_supports("avx512bw"), NATIVECPU_ISA_AVX512BW) |
+      Bit(__builtin_cpu_supports("avx512dq"), NATIVECPU_ISA_AVX512DQ) |
+      Bit(__builtin_cpu_supports("avx512vl"), NATIVECPU_ISA_AVX512VL);
+}
+#endif
+
+host_info queryHostInfo() {
+  host_info Info;
+
+  Info.NumThreads = std::max(1u, std::thread::hardware_concurrency());
+#if defined(__linux__)
+  const long Online = sysconf(_SC_NPROCESSORS_ONLN);
+  if (Online > 0) {
+    Info.NumThreads = static_cast<uint32_t>(Online);
+  }
+  // Don't size for more CPUs than a container or taskset gives us.
+  if (const uint32_t Allowed = queryAffinityCPUs()) {
+    Info.NumThreads = std::min(Info.NumThreads, Allowed);
+  }
+  if (const uint32_t Quota = queryCgroupCPULimit()) {
+    Info.NumThreads = std::min(Info.NumThreads, Quota);
+  }
+  queryCaches(Info);
+  Info.GlobalMemSize = queryMemTotal();
+  Info.MaxClockMHz = queryMaxClockMHz();
+#endif
+
+  if (auto Threads = ur_getenv("UR_NATIVE_CPU_NUM_THREADS")) {
+    const auto Value = ur_parse_uint(*Threads);
+    if (Value && *Value > 0 &&
+        *Value <= std::numeric_limits<uint32_t>::max()) {
+      Info.NumThreads = static_cast<uint32_t>(*Value);
+    } else if (!Threads->empty()) {
+      std::cerr << "Ignoring invalid UR_NATIVE_CPU_NUM_THREADS value: "
+                << *Threads << ", using " << Info.NumThreads << std::endl;
+    }
+  }
+
+#if defined(NATIVE_CPU_X86)
+  queryX86(Info);
+#elif defined(__ARM_NEON)
+  Info.VectorBytesFP = 16;
+  Info.VectorBytesInt = 16;
+  Info.ISAFeatures = NATIVECPU_ISA_NEON;
+#endif
+
+  return Info;
+}
+
+} // namespace native_cpu
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
                                                 ur_device_type_t DeviceType,
@@ -64,7 +377,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_TYPE:
     return ReturnValue(UR_DEVICE_TYPE_CPU);
   case UR_DEVICE_INFO_PARENT_DEVICE:
-    return ReturnValue(nullptr);
+    return ReturnValue(hDevice->Parent);
   case UR_DEVICE_INFO_PLATFORM:
     return ReturnValue(hDevice->Platform);
   case UR_DEVICE_INFO_NAME:
@@ -92,7 +405,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     // TODO : Populate return string accordingly - e.g. cl_khr_fp16,
     // cl_khr_fp64, cl_khr_int64_base_atomics,
     // cl_khr_int64_extended_atomics
-    return ReturnValue("cl_khr_fp64 ");
+    return ReturnValue("cl_khr_fp64 " UR_KERNEL_CLONE_EXTENSION_STRING_EXP
+                       " " UR_KERNEL_VARIANTS_EXTENSION_STRING_EXP
+                       " " UR_QUEUE_EXECUTOR_EXTENSION_STRING_EXP
+                       " " UR_PROFILING_COUNTERS_EXTENSION_STRING_EXP
+                       " " UR_USM_EXPORT_EXTENSION_STRING_EXP
+                       " " UR_PROGRAM_BUILD_ASYNC_EXTENSION_STRING_EXP);
   case UR_DEVICE_INFO_VERSION:
     return ReturnValue("0.1");
   case UR_DEVICE_INFO_COMPILER_AVAILABLE:
@@ -100,19 +418,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_LINKER_AVAILABLE:
     return ReturnValue(bool{false});
   case UR_DEVICE_INFO_MAX_COMPUTE_UNITS:
-    return ReturnValue(uint32_t{256});
+    return ReturnValue(hDevice->HostInfo.NumThreads);
   case UR_DEVICE_INFO_PARTITION_MAX_SUB_DEVICES:
-    return ReturnValue(uint32_t{0});
-  case UR_DEVICE_INFO_SUPPORTED_PARTITIONS:
-    // TODO: Ensure this property is tested correctly
-    // Taken from CUDA ur adapter
-    if (pPropSizeRet) {
-      *pPropSizeRet = 0;
-    }
-    return UR_RESULT_SUCCESS;
+    return ReturnValue(hDevice->HostInfo.NumThreads);
+  case UR_DEVICE_INFO_SUPPORTED_PARTITIONS: {
+    // Sub-devices split the threads of the device between them.
+    const ur_device_partition_t Partitions[] = {UR_DEVICE_PARTITION_EQUALLY,
+                                                UR_DEVICE_PARTITION_BY_COUNTS};
+    return ReturnValue(Partitions, std::size(Partitions));
+  }
   case UR_DEVICE_INFO_VENDOR_ID:
-    // '0x8086' : 'Intel HD graphics vendor ID'
-    return ReturnValue(uint32_t{0x8086});
+    // PCI vendor ID of the CPU vendor, 0 if unknown.
+    return ReturnValue(hDevice->HostInfo.VendorId);
   case UR_DEVICE_INFO_MAX_WORK_GROUP_SIZE:
     return ReturnValue(size_t{256});
   case UR_DEVICE_INFO_MEM_BASE_ADDR_ALIGN:
@@ -140,7 +457,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_MAX_WORK_ITEM_DIMENSIONS:
     return ReturnValue(uint32_t{3});
   case UR_DEVICE_INFO_PARTITION_TYPE:
-    return ReturnValue(ur_device_partition_property_t{});
+    return ReturnValue(hDevice->Partition);
   case UR_EXT_DEVICE_INFO_OPENCL_C_VERSION:
     return ReturnValue("");
   case UR_DEVICE_INFO_QUEUE_PROPERTIES:
@@ -154,20 +471,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(MaxGroupSize);
   }
   case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_CHAR:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_SHORT:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_INT:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_LONG:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_FLOAT:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_DOUBLE:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_HALF:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_CHAR:
+    return ReturnValue(hDevice->HostInfo.vectorWidthInt(sizeof(int8_t)));
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_SHORT:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_SHORT:
+    return ReturnValue(hDevice->HostInfo.vectorWidthInt(sizeof(int16_t)));
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_INT:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_INT:
+    return ReturnValue(hDevice->HostInfo.vectorWidthInt(sizeof(int32_t)));
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_LONG:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_LONG:
+    return ReturnValue(hDevice->HostInfo.vectorWidthInt(sizeof(int64_t)));
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_FLOAT:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_FLOAT:
+    return ReturnValue(hDevice->HostInfo.vectorWidthFP(sizeof(float)));
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_DOUBLE:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_DOUBLE:
+    return ReturnValue(hDevice->HostInfo.vectorWidthFP(sizeof(double)));
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_HALF:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_HALF:
-    return ReturnValue(uint32_t{1});
+    // fp16 is not supported, see UR_DEVICE_INFO_HALF_FP_CONFIG.
+    return ReturnValue(uint32_t{0});
 
   // Imported from level_zero
   case UR_DEVICE_INFO_USM_HOST_SUPPORT:
@@ -190,7 +514,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(
         uint32_t{sizeof(void *) * std::numeric_limits<unsigned char>::digits});
   case UR_DEVICE_INFO_MAX_CLOCK_FREQUENCY:
-    return ReturnValue(uint32_t{1000});
+    return ReturnValue(hDevice->HostInfo.MaxClockMHz);
   case UR_DEVICE_INFO_ENDIAN_LITTLE:
     return ReturnValue(bool{true});
   case UR_DEVICE_INFO_AVAILABLE:
@@ -208,20 +532,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_GLOBAL_MEM_CACHE_TYPE:
     return ReturnValue(UR_DEVICE_MEM_CACHE_TYPE_READ_WRITE_CACHE);
   case UR_DEVICE_INFO_GLOBAL_MEM_CACHELINE_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint32_t{64});
+    return ReturnValue(hDevice->HostInfo.CacheLineSize);
   case UR_DEVICE_INFO_GLOBAL_MEM_CACHE_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{0});
+    return ReturnValue(hDevice->HostInfo.LastLevelCacheSize);
   case UR_DEVICE_INFO_GLOBAL_MEM_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{0});
+    return ReturnValue(hDevice->HostInfo.GlobalMemSize);
   case UR_DEVICE_INFO_LOCAL_MEM_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{0});
+    // Local memory is plain host memory, report the size that stays in a
+    // core's private cache so that tiles are sized to fit there.
+    return ReturnValue(hDevice->HostInfo.L2CacheSize
+                           ? hDevice->HostInfo.L2CacheSize
+                           : hDevice->HostInfo.L1DataCacheSize);
   case UR_DEVICE_INFO_MAX_CONSTANT_BUFFER_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{0});
+    return ReturnValue(hDevice->HostInfo.maxConstantBufferSize());
   case UR_DEVICE_INFO_MAX_CONSTANT_ARGS:
     // TODO : CHECK
     return ReturnValue(uint32_t{64});
@@ -244,8 +567,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_PARTITION_AFFINITY_DOMAIN:
     return ReturnValue(ur_device_affinity_domain_flags_t{0});
   case UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{0});
+    return ReturnValue(hDevice->HostInfo.maxMemAllocSize());
   case UR_DEVICE_INFO_EXECUTION_CAPABILITIES:
     // TODO : CHECK
     return ReturnValue(ur_device_exec_capability_flags_t{
@@ -336,13 +658,80 @@ UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
     ur_device_handle_t hDevice,
     const ur_device_partition_properties_t *pProperties, uint32_t NumDevices,
     ur_device_handle_t *phSubDevices, uint32_t *pNumDevicesRet) {
-  std::ignore = hDevice;
-  std::ignore = NumDevices;
-  std::ignore = pProperties;
-  std::ignore = phSubDevices;
-  std::ignore = pNumDevicesRet;
+  UR_ASSERT(pProperties && pProperties->PropCount > 0,
+            UR_RESULT_ERROR_INVALID_VALUE);
 
-  DIE_NO_IMPLEMENTATION;
+  // Threads of each sub-device, the sub-devices together may not use more
+  // threads than the device has.
+  const uint32_t MaxThreads = hDevice->HostInfo.NumThreads;
+  const auto &First = pProperties->pProperties[0];
+  std::vector<ur_device_partition_property_t> Partitions;
+  switch (First.type) {
+  case UR_DEVICE_PARTITION_EQUALLY: {
+    const uint32_t Threads = First.value.equally;
+    UR_ASSERT(Threads > 0 && Threads <= MaxThreads,
+              UR_RESULT_ERROR_INVALID_VALUE);
+    Partitions.assign(MaxThreads / Threads, First);
+    break;
+  }
+  case UR_DEVICE_PARTITION_BY_COUNTS: {
+    uint32_t Total = 0;
+    for (size_t I = 0; I < pProperties->PropCount; I++) {
+      const auto &Property = pProperties->pProperties[I];
+      UR_ASSERT(Property.type == UR_DEVICE_PARTITION_BY_COUNTS &&
+                    Property.value.count > 0,
+                UR_RESULT_ERROR_INVALID_VALUE);
+      Total += Property.value.count;
+      Partitions.push_back(Property);
+    }
+    UR_ASSERT(Total <= MaxThreads, UR_RESULT_ERROR_INVALID_VALUE);
+    break;
+  }
+  default:
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  if (pNumDevicesRet) {
+    *pNumDevicesRet = static_cast<uint32_t>(Partitions.size());
+  }
+  if (!phSubDevices) {
+    return UR_RESULT_SUCCESS;
+  }
+  UR_ASSERT(NumDevices <= Partitions.size(), UR_RESULT_ERROR_INVALID_VALUE);
+
+  // Number of threads of a sub-device, for either partition type.
+  auto threadsOf = [](const ur_device_partition_property_t &Partition) {
+    return Partition.type == UR_DEVICE_PARTITION_EQUALLY
+               ? Partition.value.equally
+               : Partition.value.count;
+  };
+  auto samePartition = [&](const ur_device_partition_property_t &A,
+                           const ur_device_partition_property_t &B) {
+    return A.type == B.type && threadsOf(A) == threadsOf(B);
+  };
+
+  std::lock_guard<std::mutex> Lock(hDevice->SubDevicesMutex);
+  auto &Partitionings = hDevice->Partitionings;
+  auto It = std::find_if(
+      Partitionings.begin(), Partitionings.end(), [&](const auto &Previous) {
+        return std::equal(Partitions.begin(), Partitions.end(),
+                          Previous.Partitions.begin(),
+                          Previous.Partitions.end(), samePartition);
+      });
+  if (It == Partitionings.end()) {
+    ur_device_handle_t_::partitioning_t Partitioning;
+    Partitioning.Partitions = Partitions;
+    for (const auto &Partition : Partitions) {
+      Partitioning.SubDevices.push_back(std::make_unique<ur_device_handle_t_>(
+          hDevice, Partition, threadsOf(Partition)));
+    }
+    Partitionings.push_back(std::move(Partitioning));
+    It = std::prev(Partitionings.end());
+  }
+  for (uint32_t I = 0; I < NumDevices; I++) {
+    phSubDevices[I] = It->SubDevices[I].get();
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
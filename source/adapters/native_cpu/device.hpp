@@ -10,10 +10,88 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <ur/ur.hpp>
 
+namespace native_cpu {
+
+// Properties of the host CPU. They are queried once when the device is
+// created and never change afterwards, so urDeviceGetInfo can answer from
+// here without touching sysfs again.
+struct host_info {
+  uint32_t VendorId = 0;
+  // Execution width: the online CPUs, limited by the affinity mask and the
+  // cgroup CPU quota of the process, unless set with
+  // UR_NATIVE_CPU_NUM_THREADS.
+  uint32_t NumThreads = 1;
+  // 0 if the maximum frequency could not be determined.
+  uint32_t MaxClockMHz = 0;
+  uint32_t CacheLineSize = 64;
+  uint64_t L1DataCacheSize = 0;
+  uint64_t L2CacheSize = 0;
+  uint64_t LastLevelCacheSize = 0;
+  uint64_t GlobalMemSize = 0;
+  // Width in bytes of the widest vector registers usable for floating point
+  // and integer arithmetic, these differ on AVX-only CPUs.
+  uint32_t VectorBytesFP = 0;
+  uint32_t VectorBytesInt = 0;
+  // nativecpu_isa_feature bits, used to pick kernel variants.
+  uint64_t ISAFeatures = 0;
+
+  uint32_t vectorWidthFP(size_t ElemSize) const {
+    return std::max(uint32_t(1), uint32_t(VectorBytesFP / ElemSize));
+  }
+  uint32_t vectorWidthInt(size_t ElemSize) const {
+    return std::max(uint32_t(1), uint32_t(VectorBytesInt / ElemSize));
+  }
+  // A single allocation may use a quarter of the memory, the least OpenCL
+  // allows, the rest is left to the host.
+  uint64_t maxMemAllocSize() const { return GlobalMemSize / 4; }
+  // Constant buffers are kept small enough to stay in the last level cache,
+  // with the 64KiB OpenCL minimum as a floor.
+  uint64_t maxConstantBufferSize() const {
+    return std::min(maxMemAllocSize(),
+                    std::max(uint64_t(64 * 1024), LastLevelCacheSize));
+  }
+};
+
+host_info queryHostInfo();
+
+inline host_info withThreads(host_info Info, uint32_t NumThreads) {
+  Info.NumThreads = NumThreads;
+  return Info;
+}
+
+} // namespace native_cpu
+
 struct ur_device_handle_t_ {
-  ur_device_handle_t_(ur_platform_handle_t ArgPlt) : Platform(ArgPlt) {}
+  ur_device_handle_t_(ur_platform_handle_t ArgPlt)
+      : Platform(ArgPlt), HostInfo(native_cpu::queryHostInfo()) {}
+
+  // Sub-device running on NumThreads of the threads of its parent.
+  ur_device_handle_t_(ur_device_handle_t_ *Parent,
+                      ur_device_partition_property_t Partition,
+                      uint32_t NumThreads)
+      : Platform(Parent->Platform),
+        HostInfo(native_cpu::withThreads(Parent->HostInfo, NumThreads)),
+        Parent(Parent), Partition(Partition) {}
 
   ur_platform_handle_t Platform;
+  const native_cpu::host_info HostInfo;
+  ur_device_handle_t_ *const Parent = nullptr;
+  const ur_device_partition_property_t Partition{};
+
+  // Sub-devices are owned by their parent, root devices are never freed.
+  // Repeating a partitioning returns the sub-devices it created the first
+  // time.
+  struct partitioning_t {
+    std::vector<ur_device_partition_property_t> Partitions;
+    std::vector<std::unique_ptr<ur_device_handle_t_>> SubDevices;
+  };
+  std::mutex SubDevicesMutex;
+  std::vector<partitioning_t> Partitionings;
 };
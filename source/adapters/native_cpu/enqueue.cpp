@@ -8,13 +8,20 @@
 //
 //===----------------------------------------------------------------------===//
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <vector>
 
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "event.hpp"
 #include "kernel.hpp"
 #include "memory.hpp"
+#include "queue.hpp"
 
 namespace native_cpu {
 struct NDRDescT {
@@ -38,6 +45,249 @@ struct NDRDescT {
     }
   }
 };
+
+static void runWorkGroup(const ur_kernel_handle_t_ &Kernel,
+                         const NativeCPUArgDesc *Args, const NDRDescT &ndr,
+                         state &State, size_t g0, size_t g1, size_t g2) {
+#ifdef NATIVECPU_USE_OCK
+  std::ignore = ndr;
+  State.update(g0, g1, g2);
+  Kernel._subhandler(Args, &State);
+#else
+  for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
+    for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
+      for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
+        State.update(g0, g1, g2, local0, local1, local2);
+        Kernel._subhandler(Args, &State);
+      }
+    }
+  }
+#endif
+}
+
+// Work-groups of a kernel launch split into chunks, which are claimed by the
+// enqueuing thread and by the tasks submitted to the queue's executor. The
+// enqueuing thread keeps claiming chunks itself, so the launch completes even
+// if the executor runs no task before it. Tasks which only run once all the
+// chunks have been claimed do nothing but drop their reference, the last
+// reference deletes the launch.
+class parallel_launch {
+public:
+  // Number of chunks per thread, to balance work-groups of uneven cost.
+  static constexpr size_t ChunksPerThread = 4;
+
+  parallel_launch(const ur_kernel_handle_t_ &Kernel,
+                  const NativeCPUArgDesc *Args, const NDRDescT &ndr,
+                  const state &State, size_t NumThreads, bool CountWorkers)
+      : Kernel(Kernel), Args(Args), NDR(ndr), InitialState(State),
+        CountWorkers(CountWorkers) {
+    for (unsigned I = 0; I < 3; I++) {
+      NumGroups[I] = ndr.GlobalSize[I] / ndr.LocalSize[I];
+    }
+    TotalGroups = NumGroups[0] * NumGroups[1] * NumGroups[2];
+    size_t MaxChunks = std::min(TotalGroups, NumThreads * ChunksPerThread);
+    GroupsPerChunk = (TotalGroups + MaxChunks - 1) / MaxChunks;
+    NumChunks = (TotalGroups + GroupsPerChunk - 1) / GroupsPerChunk;
+  }
+
+  size_t getNumChunks() const { return NumChunks; }
+
+  void retain() { RefCount.fetch_add(1, std::memory_order_relaxed); }
+
+  void release() {
+    if (RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+  // Runs chunks until none are left to claim. Workers are the threads other
+  // than the enqueuing one.
+  void work(bool Worker) {
+    perf_counts Before;
+    bool Counting = Worker && CountWorkers;
+    bool CountsValid = Counting && readPerfCounts(Before);
+    state State(InitialState);
+    size_t Ran = 0;
+    for (size_t Chunk = NextChunk.fetch_add(1); Chunk < NumChunks;
+         Chunk = NextChunk.fetch_add(1), Ran++) {
+      size_t End = std::min(TotalGroups, (Chunk + 1) * GroupsPerChunk);
+      for (size_t Group = Chunk * GroupsPerChunk; Group < End; Group++) {
+        size_t g0 = Group % NumGroups[0];
+        size_t g1 = Group / NumGroups[0] % NumGroups[1];
+        size_t g2 = Group / NumGroups[0] / NumGroups[1];
+        runWorkGroup(Kernel, Args, NDR, State, g0, g1, g2);
+      }
+    }
+    if (Ran) {
+      perf_counts After;
+      CountsValid = CountsValid && readPerfCounts(After);
+      std::lock_guard<std::mutex> Lock(Mutex);
+      if (Counting) {
+        WorkerCounts += After - Before;
+        WorkerCountsValid = WorkerCountsValid && CountsValid;
+      }
+      Finished += Ran;
+      if (Finished == NumChunks) {
+        Done.notify_all();
+      }
+    }
+  }
+
+  // Blocks until the chunks claimed by other threads have finished, then
+  // reports their counters to the command measured on this thread.
+  void wait() {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    Done.wait(Lock, [this] { return Finished == NumChunks; });
+    if (CountWorkers) {
+      addWorkerCounts(WorkerCounts, WorkerCountsValid);
+    }
+  }
+
+  static void runTask(void *pTaskData) {
+    auto *Launch = static_cast<parallel_launch *>(pTaskData);
+    Launch->work(true);
+    Launch->release();
+  }
+
+private:
+  ~parallel_launch() = default;
+
+  const ur_kernel_handle_t_ &Kernel;
+  const NativeCPUArgDesc *Args;
+  const NDRDescT NDR;
+  const state InitialState;
+  const bool CountWorkers;
+  size_t NumGroups[3];
+  size_t TotalGroups;
+  size_t GroupsPerChunk;
+  size_t NumChunks;
+
+  std::atomic<uint32_t> RefCount{1};
+  std::atomic<size_t> NextChunk{0};
+  std::mutex Mutex;
+  std::condition_variable Done;
+  size_t Finished = 0;
+  perf_counts WorkerCounts;
+  bool WorkerCountsValid = true;
+};
+
+// Runs all the work-groups of a launch, split across the threads of the
+// queue's executor if Parallel is set.
+static void launchKernel(ur_queue_handle_t hQueue,
+                         const ur_kernel_handle_t_ &Kernel,
+                         const NativeCPUArgDesc *Args, const NDRDescT &ndr,
+                         bool Parallel) {
+  state State(ndr.GlobalSize[0], ndr.GlobalSize[1], ndr.GlobalSize[2],
+              ndr.LocalSize[0], ndr.LocalSize[1], ndr.LocalSize[2],
+              ndr.GlobalOffset[0], ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
+
+  if (Parallel) {
+    auto *Launch =
+        new parallel_launch(Kernel, Args, ndr, State,
+                            hQueue->ExecutorConcurrency, hQueue->Profiling);
+    // The calling thread takes a share of the chunks itself.
+    size_t NumThreads = std::min<size_t>(hQueue->ExecutorConcurrency,
+                                         Launch->getNumChunks());
+    for (size_t I = 1; I < NumThreads; I++) {
+      Launch->retain();
+      hQueue->ExecutorSubmit(hQueue->ExecutorUserData,
+                             parallel_launch::runTask, Launch);
+    }
+    Launch->work(false);
+    Launch->wait();
+    Launch->release();
+    return;
+  }
+
+  auto numWG0 = ndr.GlobalSize[0] / ndr.LocalSize[0];
+  auto numWG1 = ndr.GlobalSize[1] / ndr.LocalSize[1];
+  auto numWG2 = ndr.GlobalSize[2] / ndr.LocalSize[2];
+  for (unsigned g2 = 0; g2 < numWG2; g2++) {
+    for (unsigned g1 = 0; g1 < numWG1; g1++) {
+      for (unsigned g0 = 0; g0 < numWG0; g0++) {
+        runWorkGroup(Kernel, Args, ndr, State, g0, g1, g2);
+      }
+    }
+  }
+}
+
+// Runs a command on the calling thread once its wait list is complete.
+template <typename RunT>
+static ur_result_t runCommand(ur_queue_handle_t hQueue, ur_command_t Command,
+                              uint32_t NumEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList,
+                              ur_event_handle_t *phEvent, RunT &&Run) {
+  command_profile Profile;
+  Profile.QueuedNs = hQueue->Profiling ? getTimestamp() : 0;
+  waitForEvents(NumEventsInWaitList, phEventWaitList);
+  command_timer Timer(hQueue->Profiling);
+  Run();
+  Timer.stop(Profile);
+  setCompletedEvent(hQueue, Command, phEvent, &Profile);
+  return UR_RESULT_SUCCESS;
+}
+
+// Runs a command accessing memory of the memory objects it depends on.
+// Queues with a scheduler run it once its dependencies are complete, others
+// right away. Only the former call GetDeps, which fills in the accesses and
+// memory objects of the command.
+template <typename GetDepsT, typename RunT>
+static ur_result_t
+enqueueCommand(ur_queue_handle_t hQueue, ur_command_t Command,
+               GetDepsT &&GetDeps, bool Blocking, uint32_t NumEventsInWaitList,
+               const ur_event_handle_t *phEventWaitList,
+               ur_event_handle_t *phEvent, RunT &&Run) {
+  if (hQueue->Scheduler) {
+    std::vector<mem_access_t> Accesses;
+    std::vector<ur_mem_handle_t> Mems;
+    GetDeps(Accesses, Mems);
+    // The command may run after the memory objects are released by the
+    // application, so it keeps them alive until it has run.
+    for (auto hMem : Mems) {
+      urMemRetain(hMem);
+    }
+    hQueue->Scheduler->enqueue(
+        Command, std::move(Accesses),
+        [Run = std::forward<RunT>(Run), Mems = std::move(Mems)] {
+          Run();
+          for (auto hMem : Mems) {
+            urMemRelease(hMem);
+          }
+        },
+        Blocking, NumEventsInWaitList, phEventWaitList, phEvent);
+    return UR_RESULT_SUCCESS;
+  }
+  return runCommand(hQueue, Command, NumEventsInWaitList, phEventWaitList,
+                    phEvent, std::forward<RunT>(Run));
+}
+
+// Runs a command accessing the given memory, of the memory objects Mems.
+template <typename RunT>
+static ur_result_t
+enqueueCommand(ur_queue_handle_t hQueue, ur_command_t Command,
+               std::initializer_list<mem_access_t> Accesses,
+               std::initializer_list<ur_mem_handle_t> Mems, bool Blocking,
+               uint32_t NumEventsInWaitList,
+               const ur_event_handle_t *phEventWaitList,
+               ur_event_handle_t *phEvent, RunT &&Run) {
+  return enqueueCommand(
+      hQueue, Command,
+      [Accesses, Mems](std::vector<mem_access_t> &AccessesOut,
+                       std::vector<ur_mem_handle_t> &MemsOut) {
+        AccessesOut.assign(Accesses);
+        MemsOut.assign(Mems);
+      },
+      Blocking, NumEventsInWaitList, phEventWaitList, phEvent,
+      std::forward<RunT>(Run));
+}
+
+// Commands which always run on the enqueuing thread first wait for the
+// scheduled commands of the queue, as their accesses aren't tracked.
+static void drainQueue(ur_queue_handle_t hQueue) {
+  if (hQueue->Scheduler) {
+    hQueue->Scheduler->waitAll();
+  }
+}
 } // namespace native_cpu
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
@@ -45,10 +295,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
@@ -60,78 +306,88 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
   }
 
   // TODO: add proper error checking
-  // TODO: add proper event dep management
   native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
                            pLocalWorkSize);
-  hKernel->handleLocalArgs();
 
-  native_cpu::state state(ndr.GlobalSize[0], ndr.GlobalSize[1],
-                          ndr.GlobalSize[2], ndr.LocalSize[0], ndr.LocalSize[1],
-                          ndr.LocalSize[2], ndr.GlobalOffset[0],
-                          ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
+  // Work-groups of kernels with local arguments share the kernel's local
+  // memory pool, so they can only run one at a time, and only while no
+  // other launch of the kernel runs.
+  if (!hKernel->getArgs().LocalArgInfo.empty()) {
+    native_cpu::drainQueue(hQueue);
+    return native_cpu::runCommand(
+        hQueue, UR_COMMAND_KERNEL_LAUNCH, numEventsInWaitList, phEventWaitList,
+        phEvent, [hQueue, hKernel, &ndr] {
+          hKernel->handleLocalArgs();
+          native_cpu::launchKernel(hQueue, *hKernel,
+                                   hKernel->getArgs().Descs.data(), ndr, false);
+        });
+  }
 
-  auto numWG0 = ndr.GlobalSize[0] / ndr.LocalSize[0];
-  auto numWG1 = ndr.GlobalSize[1] / ndr.LocalSize[1];
-  auto numWG2 = ndr.GlobalSize[2] / ndr.LocalSize[2];
-  for (unsigned g2 = 0; g2 < numWG2; g2++) {
-    for (unsigned g1 = 0; g1 < numWG1; g1++) {
-      for (unsigned g0 = 0; g0 < numWG0; g0++) {
-#ifdef NATIVECPU_USE_OCK
-        state.update(g0, g1, g2);
-        hKernel->_subhandler(hKernel->_args.data(), &state);
-#else
-        for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
-          for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
-            for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
-              state.update(g0, g1, g2, local0, local1, local2);
-              hKernel->_subhandler(hKernel->_args.data(), &state);
-            }
+  // The launch keeps the arguments as they are now, and the kernel alive, in
+  // case it runs after the call returns.
+  auto Args = hKernel->shareArgs();
+  bool Parallel = hQueue->ExecutorSubmit && hQueue->ExecutorConcurrency > 1;
+  hKernel->incrementReferenceCount();
+  return native_cpu::enqueueCommand(
+      hQueue, UR_COMMAND_KERNEL_LAUNCH,
+      [&Args](std::vector<native_cpu::mem_access_t> &Accesses,
+              std::vector<ur_mem_handle_t> &Mems) {
+        for (auto &Access : Args->Accesses) {
+          if (!Access.empty()) {
+            Accesses.push_back(Access);
           }
         }
-#endif
-      }
-    }
-  }
-  // TODO: we should avoid calling clear here by avoiding using push_back
-  // in setKernelArgs.
-  hKernel->_args.clear();
-  hKernel->_localArgInfo.clear();
-  return UR_RESULT_SUCCESS;
+        for (auto hMem : Args->Mems) {
+          if (hMem) {
+            Mems.push_back(hMem);
+          }
+        }
+      },
+      false, numEventsInWaitList, phEventWaitList, phEvent,
+      [hQueue, hKernel, Args, ndr, Parallel] {
+        native_cpu::launchKernel(hQueue, *hKernel, Args->Descs.data(), ndr,
+                                 Parallel);
+        decrementOrDelete(hKernel);
+      });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  // Without a wait list the command waits for all the previous commands,
+  // which the conflicting access orders it after.
+  return native_cpu::enqueueCommand(
+      hQueue, UR_COMMAND_EVENTS_WAIT,
+      {numEventsInWaitList ? native_cpu::mem_access_t()
+                           : native_cpu::mem_access_t::all()},
+      {}, false, numEventsInWaitList, phEventWaitList, phEvent, [] {});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  // The barrier conflicts with every command, so it runs after the previous
+  // ones and before the following ones.
+  return native_cpu::enqueueCommand(
+      hQueue, UR_COMMAND_EVENTS_WAIT_WITH_BARRIER,
+      {native_cpu::mem_access_t::all()}, {}, false, numEventsInWaitList,
+      phEventWaitList, phEvent, [] {});
 }
 
 template <bool IsRead>
 static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
-    ur_queue_handle_t, ur_mem_handle_t Buff, bool,
+    ur_queue_handle_t hQueue, ur_command_t Command, ur_mem_handle_t Buff, bool,
     ur_rect_offset_t BufferOffset, ur_rect_offset_t HostOffset,
     ur_rect_region_t region, size_t BufferRowPitch, size_t BufferSlicePitch,
     size_t HostRowPitch, size_t HostSlicePitch,
     typename std::conditional<IsRead, void *, const void *>::type DstMem,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
-  // TODO: events, blocking, check other constraints, performance optimizations
+    uint32_t NumEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  // TODO: blocking, check other constraints, performance optimizations
   //       More sharing with level_zero where possible
 
+  native_cpu::drainQueue(hQueue);
+  native_cpu::waitForEvents(NumEventsInWaitList, phEventWaitList);
   if (BufferRowPitch == 0)
     BufferRowPitch = region.width;
   if (BufferSlicePitch == 0)
@@ -155,32 +411,34 @@ static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
         else
           buff_mem = ur_cast<const int8_t *>(DstMem)[host_origin];
       }
+  native_cpu::setCompletedEvent(hQueue, Command, phEvent);
   return UR_RESULT_SUCCESS;
 }
 
-static inline ur_result_t doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr,
-                                      const void *SrcPtr, size_t Size,
-                                      uint32_t numEventsInWaitList,
-                                      const ur_event_handle_t *EventWaitList,
-                                      ur_event_handle_t *Event) {
-  // todo: non-blocking, events, UR integration
-  std::ignore = EventWaitList;
-  std::ignore = Event;
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  if (SrcPtr != DstPtr && Size)
-    memmove(DstPtr, SrcPtr, Size);
-  return UR_RESULT_SUCCESS;
+static inline ur_result_t
+doCopy_impl(ur_queue_handle_t hQueue, ur_command_t Command,
+            std::initializer_list<ur_mem_handle_t> Mems, bool Blocking,
+            void *DstPtr, const void *SrcPtr, size_t Size,
+            uint32_t numEventsInWaitList,
+            const ur_event_handle_t *EventWaitList, ur_event_handle_t *Event) {
+  return native_cpu::enqueueCommand(
+      hQueue, Command,
+      {native_cpu::mem_access_t(SrcPtr, Size, false),
+       native_cpu::mem_access_t(DstPtr, Size, true)},
+      Mems, Blocking, numEventsInWaitList, EventWaitList, Event,
+      [DstPtr, SrcPtr, Size] {
+        if (SrcPtr != DstPtr && Size)
+          memmove(DstPtr, SrcPtr, Size);
+      });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
     size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingRead;
-
   void *FromPtr = /*Src*/ hBuffer->_mem + offset;
-  return doCopy_impl(hQueue, pDst, FromPtr, size, numEventsInWaitList,
+  return doCopy_impl(hQueue, UR_COMMAND_MEM_BUFFER_READ, {hBuffer},
+                     blockingRead, pDst, FromPtr, size, numEventsInWaitList,
                      phEventWaitList, phEvent);
 }
 
@@ -188,10 +446,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingWrite;
-
   void *ToPtr = hBuffer->_mem + offset;
-  return doCopy_impl(hQueue, ToPtr, pSrc, size, numEventsInWaitList,
+  return doCopy_impl(hQueue, UR_COMMAND_MEM_BUFFER_WRITE, {hBuffer},
+                     blockingWrite, ToPtr, pSrc, size, numEventsInWaitList,
                      phEventWaitList, phEvent);
 }
 
@@ -203,9 +460,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
   return enqueueMemBufferReadWriteRect_impl<true /*read*/>(
-      hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
-      bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      hQueue, UR_COMMAND_MEM_BUFFER_READ_RECT, hBuffer, blockingRead,
+      bufferOrigin, hostOrigin, region, bufferRowPitch, bufferSlicePitch,
+      hostRowPitch, hostSlicePitch, pDst, numEventsInWaitList, phEventWaitList,
+      phEvent);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
@@ -216,9 +474,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
   return enqueueMemBufferReadWriteRect_impl<false /*write*/>(
-      hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
-      bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      hQueue, UR_COMMAND_MEM_BUFFER_WRITE_RECT, hBuffer, blockingWrite,
+      bufferOrigin, hostOrigin, region, bufferRowPitch, bufferSlicePitch,
+      hostRowPitch, hostSlicePitch, pSrc, numEventsInWaitList, phEventWaitList,
+      phEvent);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
@@ -228,8 +487,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     ur_event_handle_t *phEvent) {
   const void *SrcPtr = hBufferSrc->_mem + srcOffset;
   void *DstPtr = hBufferDst->_mem + dstOffset;
-  return doCopy_impl(hQueue, DstPtr, SrcPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+  return doCopy_impl(hQueue, UR_COMMAND_MEM_BUFFER_COPY,
+                     {hBufferSrc, hBufferDst}, false, DstPtr, SrcPtr, size,
+                     numEventsInWaitList, phEventWaitList, phEvent);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
@@ -240,10 +500,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
   return enqueueMemBufferReadWriteRect_impl<true /*read*/>(
-      hQueue, hBufferSrc, false /*todo: check blocking*/, srcOrigin,
-      /*HostOffset*/ dstOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch,
-      dstSlicePitch, hBufferDst->_mem, numEventsInWaitList, phEventWaitList,
-      phEvent);
+      hQueue, UR_COMMAND_MEM_BUFFER_COPY_RECT, hBufferSrc,
+      false /*todo: check blocking*/, srcOrigin, /*HostOffset*/ dstOrigin,
+      region, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+      hBufferDst->_mem, numEventsInWaitList, phEventWaitList, phEvent);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
@@ -251,22 +511,35 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
     size_t patternSize, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   // TODO: error checking
-  // TODO: handle async
   void *startingPtr = hBuffer->_mem + offset;
-  unsigned steps = size / patternSize;
-  for (unsigned i = 0; i < steps; i++) {
-    memcpy(static_cast<int8_t *>(startingPtr) + i * patternSize, pPattern,
-           patternSize);
+  auto Fill = [startingPtr, size](const int8_t *Pattern, size_t PatternSize) {
+    unsigned steps = size / PatternSize;
+    for (unsigned i = 0; i < steps; i++) {
+      memcpy(static_cast<int8_t *>(startingPtr) + i * PatternSize, Pattern,
+             PatternSize);
+    }
+  };
+  auto Bytes = static_cast<const int8_t *>(pPattern);
+  // Without a scheduler the command runs before the call returns, the
+  // pattern can be used in place.
+  if (!hQueue->Scheduler) {
+    return native_cpu::enqueueCommand(
+        hQueue, UR_COMMAND_MEM_BUFFER_FILL, {}, {}, false,
+        numEventsInWaitList, phEventWaitList, phEvent,
+        [Fill, Bytes, patternSize] { Fill(Bytes, patternSize); });
   }
-
-  return UR_RESULT_SUCCESS;
+  // The pattern may be gone by the time the command runs.
+  std::vector<int8_t> Pattern(Bytes, Bytes + patternSize);
+  return native_cpu::enqueueCommand(
+      hQueue, UR_COMMAND_MEM_BUFFER_FILL,
+      {native_cpu::mem_access_t(startingPtr, size, true)}, {hBuffer}, false,
+      numEventsInWaitList, phEventWaitList, phEvent,
+      [Fill, Pattern = std::move(Pattern)] {
+        Fill(Pattern.data(), Pattern.size());
+      });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
@@ -333,16 +606,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
     ur_map_flags_t mapFlags, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent, void **ppRetMap) {
-  std::ignore = hQueue;
   std::ignore = blockingMap;
   std::ignore = mapFlags;
   std::ignore = size;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
+  native_cpu::drainQueue(hQueue);
+  native_cpu::waitForEvents(numEventsInWaitList, phEventWaitList);
   *ppRetMap = hBuffer->_mem + offset;
 
+  native_cpu::setCompletedEvent(hQueue, UR_COMMAND_MEM_BUFFER_MAP, phEvent);
   return UR_RESULT_SUCCESS;
 }
 
@@ -350,13 +622,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
     ur_queue_handle_t hQueue, ur_mem_handle_t hMem, void *pMappedPtr,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
   std::ignore = hMem;
   std::ignore = pMappedPtr;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
+  native_cpu::drainQueue(hQueue);
+  native_cpu::waitForEvents(numEventsInWaitList, phEventWaitList);
+  native_cpu::setCompletedEvent(hQueue, UR_COMMAND_MEM_UNMAP, phEvent);
   return UR_RESULT_SUCCESS;
 }
 
@@ -364,38 +635,35 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
     const void *pPattern, size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(ptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(size % patternSize == 0 || patternSize > size,
             UR_RESULT_ERROR_INVALID_SIZE);
 
-  memset(ptr, *static_cast<const uint8_t *>(pPattern), size * patternSize);
-
-  return UR_RESULT_SUCCESS;
+  uint8_t Value = *static_cast<const uint8_t *>(pPattern);
+  return native_cpu::enqueueCommand(
+      hQueue, UR_COMMAND_USM_FILL,
+      {native_cpu::mem_access_t(ptr, size * patternSize, true)}, {}, false,
+      numEventsInWaitList, phEventWaitList, phEvent,
+      [ptr, Value, size, patternSize] {
+        memset(ptr, Value, size * patternSize);
+      });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
     size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
   UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  memcpy(pDst, pSrc, size);
-
-  return UR_RESULT_SUCCESS;
+  return native_cpu::enqueueCommand(
+      hQueue, UR_COMMAND_USM_MEMCPY,
+      {native_cpu::mem_access_t(pSrc, size, false),
+       native_cpu::mem_access_t(pDst, size, true)},
+      {}, blocking, numEventsInWaitList, phEventWaitList, phEvent,
+      [pDst, pSrc, size] { memcpy(pDst, pSrc, size); });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
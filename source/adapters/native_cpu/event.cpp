@@ -8,53 +8,247 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <climits>
+#include <thread>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "context.hpp"
+#include "event.hpp"
+#include "queue.hpp"
+
+namespace {
+void futexWait(std::atomic_uint32_t *Word, uint32_t Expected) {
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(Word), FUTEX_WAIT_PRIVATE,
+          Expected, nullptr, nullptr, 0);
+#else
+  std::ignore = Word;
+  std::ignore = Expected;
+  std::this_thread::yield();
+#endif
+}
+
+void futexWakeAll(std::atomic_uint32_t *Word) {
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(Word), FUTEX_WAKE_PRIVATE,
+          INT_MAX, nullptr, nullptr, 0);
+#else
+  std::ignore = Word;
+#endif
+}
+} // namespace
+
+void ur_event_handle_t_::wakeWaiters() {
+  // Waiters register before re-reading the state word, so either they see
+  // the new state or we see them here.
+  if (Waiters.load()) {
+    futexWakeAll(&State);
+  }
+}
+
+void ur_event_handle_t_::setStatus(ur_event_status_t Status) {
+  uint32_t Old = State.load();
+  while (!State.compare_exchange_weak(Old, (Old & ~StatusMask) | Status)) {
+  }
+  if (Status == UR_EVENT_STATUS_COMPLETE) {
+    wakeWaiters();
+  }
+}
+
+void ur_event_handle_t_::wait() {
+  uint32_t Observed = State.load();
+  const uint32_t Generation = Observed >> StatusBits;
+  auto isDone = [Generation](uint32_t Value) {
+    return (Value & StatusMask) == UR_EVENT_STATUS_COMPLETE ||
+           (Value >> StatusBits) != Generation;
+  };
+
+  for (unsigned I = 0; I < SpinCount; I++) {
+    if (isDone(Observed)) {
+      return;
+    }
+    Observed = State.load();
+  }
+
+  Waiters++;
+  while (!isDone(Observed = State.load())) {
+    futexWait(&State, Observed);
+  }
+  Waiters--;
+}
+
+ur_event_handle_t native_cpu::event_pool::acquire(ur_queue_handle_t hQueue,
+                                                  ur_command_t Command) {
+  ur_event_handle_t_ *Event;
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (!FreeList) {
+      auto Block = std::make_unique<ur_event_handle_t_[]>(BlockSize);
+      for (size_t I = 0; I < BlockSize; I++) {
+        Block[I].NextFree = FreeList;
+        FreeList = &Block[I];
+      }
+      Blocks.push_back(std::move(Block));
+    }
+    Event = FreeList;
+    FreeList = Event->NextFree;
+  }
+
+  Event->NextFree = nullptr;
+  Event->RefCount = 1;
+  Event->Queue = hQueue;
+  Event->Context = hQueue->Context;
+  Event->CommandType = Command;
+  Event->Profile = native_cpu::command_profile();
+  if (hQueue->Profiling) {
+    Event->Profile.QueuedNs = native_cpu::getTimestamp();
+  }
+  Event->setStatus(UR_EVENT_STATUS_QUEUED);
+  hQueue->incrementReferenceCount();
+  return Event;
+}
+
+void native_cpu::event_pool::release(ur_event_handle_t hEvent) {
+  // Start a new generation, this releases anyone still waiting on the old
+  // one.
+  uint32_t Old = hEvent->State.load();
+  uint32_t Next = (Old >> ur_event_handle_t_::StatusBits) + 1;
+  hEvent->State = (Next << ur_event_handle_t_::StatusBits) |
+                  UR_EVENT_STATUS_COMPLETE;
+  hEvent->wakeWaiters();
+  hEvent->Queue = nullptr;
+  hEvent->Context = nullptr;
+
+  std::lock_guard<std::mutex> Lock(Mutex);
+  hEvent->NextFree = FreeList;
+  FreeList = hEvent;
+}
+
+void native_cpu::waitForEvents(uint32_t NumEvents,
+                               const ur_event_handle_t *phEvents) {
+  for (uint32_t I = 0; I < NumEvents; I++) {
+    // Waiting on a scheduled command runs the queue's ready commands, the
+    // executor may not get to them.
+    auto Queue = phEvents[I]->Queue;
+    if (Queue && Queue->Scheduler) {
+      Queue->Scheduler->wait(phEvents[I]);
+    } else {
+      phEvents[I]->wait();
+    }
+  }
+}
+
+void native_cpu::setCompletedEvent(ur_queue_handle_t hQueue,
+                                   ur_command_t Command,
+                                   ur_event_handle_t *phEvent,
+                                   const command_profile *Profile) {
+  if (!phEvent) {
+    return;
+  }
+  auto Event = hQueue->Context->EventPool.acquire(hQueue, Command);
+  if (Profile) {
+    Event->Profile = *Profile;
+  } else {
+    Event->Profile.StartNs = Event->Profile.EndNs = Event->Profile.QueuedNs;
+  }
+  Event->setStatus(UR_EVENT_STATUS_COMPLETE);
+  *phEvent = Event;
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
                                                    ur_event_info_t propName,
                                                    size_t propSize,
                                                    void *pPropValue,
                                                    size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
-  DIE_NO_IMPLEMENTATION;
+  switch (propName) {
+  case UR_EVENT_INFO_COMMAND_QUEUE:
+    return ReturnValue(hEvent->Queue);
+  case UR_EVENT_INFO_CONTEXT:
+    return ReturnValue(hEvent->Context);
+  case UR_EVENT_INFO_COMMAND_TYPE:
+    return ReturnValue(hEvent->CommandType);
+  case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS:
+    return ReturnValue(hEvent->getStatus());
+  case UR_EVENT_INFO_REFERENCE_COUNT:
+    return ReturnValue(hEvent->getReferenceCount());
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
     ur_event_handle_t hEvent, ur_profiling_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  if (!hEvent->Queue || !hEvent->Queue->Profiling ||
+      hEvent->getStatus() != UR_EVENT_STATUS_COMPLETE) {
+    return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+  }
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
-  DIE_NO_IMPLEMENTATION;
+  const auto &Profile = hEvent->Profile;
+  switch (propName) {
+  case UR_PROFILING_INFO_COMMAND_QUEUED:
+  case UR_PROFILING_INFO_COMMAND_SUBMIT:
+    return ReturnValue(Profile.QueuedNs);
+  case UR_PROFILING_INFO_COMMAND_START:
+    return ReturnValue(Profile.StartNs);
+  case UR_PROFILING_INFO_COMMAND_END:
+  case UR_PROFILING_INFO_COMMAND_COMPLETE:
+    return ReturnValue(Profile.EndNs);
+  default:
+    break;
+  }
+
+  // Counters are missing if perf_event_open is unavailable or not permitted.
+  if (!Profile.HasCounts) {
+    return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+  }
+  switch (propName) {
+  case UR_PROFILING_INFO_CYCLES_EXP:
+    return ReturnValue(Profile.Counts.Cycles);
+  case UR_PROFILING_INFO_INSTRUCTIONS_EXP:
+    return ReturnValue(Profile.Counts.Instructions);
+  case UR_PROFILING_INFO_LLC_MISSES_EXP:
+    return ReturnValue(Profile.Counts.LLCMisses);
+  case UR_PROFILING_INFO_BRANCH_MISSES_EXP:
+    return ReturnValue(Profile.Counts.BranchMisses);
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
-  std::ignore = numEvents;
-  std::ignore = phEventWaitList;
-  // TODO: currently we do everything synchronously so this is a no-op
+  native_cpu::waitForEvents(numEvents, phEventWaitList);
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  hEvent->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
-  DIE_NO_IMPLEMENTATION;
+  if (hEvent->decrementReferenceCount() == 0) {
+    // The queue keeps the context, and so the pool, alive until the event
+    // is back in the pool.
+    auto Queue = hEvent->Queue;
+    Queue->Context->EventPool.release(hEvent);
+    decrementOrDelete(Queue);
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
@@ -0,0 +1,102 @@
+//===----------- event.hpp - Native CPU Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ur_api.h>
+
+#include "profiling.hpp"
+
+namespace native_cpu {
+class event_pool;
+} // namespace native_cpu
+
+// Events are never freed while their context is alive, urEventRelease hands
+// them back to the context's event_pool instead. The state word holds the
+// ur_event_status_t in its lowest bits and a generation counter, bumped every
+// time the event is recycled, in the rest. A waiter which sees the generation
+// change knows the event it was waiting on has completed and been released.
+struct ur_event_handle_t_ {
+  uint32_t incrementReferenceCount() { return ++RefCount; }
+  uint32_t decrementReferenceCount() { return --RefCount; }
+  uint32_t getReferenceCount() const { return RefCount; }
+
+  ur_event_status_t getStatus() const {
+    return static_cast<ur_event_status_t>(State.load() & StatusMask);
+  }
+
+  // Wakes up all waiters once the status becomes UR_EVENT_STATUS_COMPLETE.
+  void setStatus(ur_event_status_t Status);
+
+  // Spins on the state word for a short while, then parks the thread until
+  // the event completes or is recycled.
+  void wait();
+
+  ur_queue_handle_t Queue = nullptr;
+  ur_context_handle_t Context = nullptr;
+  ur_command_t CommandType = UR_COMMAND_FORCE_UINT32;
+  native_cpu::command_profile Profile;
+
+private:
+  friend class native_cpu::event_pool;
+
+  static constexpr uint32_t StatusBits = 2;
+  static constexpr uint32_t StatusMask = (1u << StatusBits) - 1;
+  static constexpr unsigned SpinCount = 4096;
+
+  void wakeWaiters();
+
+  std::atomic_uint32_t RefCount{0};
+  std::atomic_uint32_t State{UR_EVENT_STATUS_COMPLETE};
+  std::atomic_uint32_t Waiters{0};
+  ur_event_handle_t_ *NextFree = nullptr;
+};
+
+namespace native_cpu {
+
+// Free list of the events of a context. Events are allocated in blocks which
+// are only freed together with the context, so enqueues requesting events do
+// not allocate once the pool has grown to the number of events in flight.
+class event_pool {
+public:
+  event_pool() = default;
+  event_pool(const event_pool &) = delete;
+  event_pool &operator=(const event_pool &) = delete;
+
+  // Returns an event with a reference count of 1 and the queued status.
+  ur_event_handle_t acquire(ur_queue_handle_t hQueue, ur_command_t Command);
+
+  // Returns an event whose reference count dropped to 0 to the pool.
+  void release(ur_event_handle_t hEvent);
+
+private:
+  static constexpr size_t BlockSize = 64;
+
+  std::mutex Mutex;
+  ur_event_handle_t_ *FreeList = nullptr;
+  std::vector<std::unique_ptr<ur_event_handle_t_[]>> Blocks;
+};
+
+// Blocks until all the events of a wait list have completed.
+void waitForEvents(uint32_t NumEvents, const ur_event_handle_t *phEvents);
+
+// Returns in phEvent, if requested, an event for a command which has already
+// finished executing on hQueue. Without a Profile of the command, it is
+// reported as having taken no time.
+void setCompletedEvent(ur_queue_handle_t hQueue, ur_command_t Command,
+                       ur_event_handle_t *phEvent,
+                       const command_profile *Profile = nullptr);
+
+} // namespace native_cpu
@@ -27,8 +27,10 @@ urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
     return UR_RESULT_ERROR_INVALID_KERNEL;
 
   auto f = reinterpret_cast<nativecpu_ptr_t>(
-      const_cast<unsigned char *>(kernelEntry->second));
-  auto kernel = new ur_kernel_handle_t_(pKernelName, *f);
+      const_cast<unsigned char *>(kernelEntry->second.kernel_ptr));
+  // Keep the name owned by the program, pKernelName may not outlive the call.
+  auto kernel = new ur_kernel_handle_t_(kernelEntry->first, *f,
+                                        kernelEntry->second.variant_name);
 
   *phKernel = kernel;
 
@@ -40,17 +42,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
     const ur_kernel_arg_value_properties_t *pProperties,
     const void *pArgValue) {
   // Todo: error checking
-  // Todo: I think that the opencl spec (and therefore the pi spec mandates that
-  // arg is copied (this is why it is defined as const void*, I guess we should
-  // do it
-  // TODO: can args arrive out of order?
-  std::ignore = argIndex;
   std::ignore = pProperties;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(argSize, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
 
-  hKernel->_args.emplace_back(const_cast<void *>(pArgValue));
+  hKernel->getArgsForWrite().setValue(argIndex, pArgValue, argSize);
 
   return UR_RESULT_SUCCESS;
 }
@@ -59,10 +56,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
     ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
     const ur_kernel_arg_local_properties_t *pProperties) {
   std::ignore = pProperties;
-  // emplace a placeholder kernel arg, gets replaced with a pointer to the
+  // set a placeholder kernel arg, gets replaced with a pointer to the
   // memory pool before enqueueing the kernel.
-  hKernel->_args.emplace_back(nullptr);
-  hKernel->_localArgInfo.emplace_back(argIndex, argSize);
+  hKernel->getArgsForWrite().setLocal(argIndex, argSize);
   return UR_RESULT_SUCCESS;
 }
 
@@ -95,6 +91,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
     return ReturnValue(uint32_t{hKernel->getReferenceCount()});
   case UR_KERNEL_INFO_ATTRIBUTES:
     return ReturnValue("");
+  case UR_KERNEL_INFO_VARIANT_EXP:
+    return ReturnValue(hKernel->_variant ? hKernel->_variant : "");
   default:
     return UR_RESULT_ERROR_INVALID_VALUE;
   }
@@ -195,8 +193,6 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
                       const ur_kernel_arg_pointer_properties_t *pProperties,
                       const void *pArgValue) {
-  // TODO: out_of_order args?
-  std::ignore = argIndex;
   std::ignore = pProperties;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
@@ -204,7 +200,9 @@ urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
 
   auto ptrToPtr = reinterpret_cast<const intptr_t *>(pArgValue);
   auto derefPtr = reinterpret_cast<void *>(*ptrToPtr);
-  hKernel->_args.push_back(derefPtr);
+  hKernel->getArgsForWrite().setPtr(
+      argIndex, derefPtr,
+      derefPtr ? native_cpu::usmAccess(derefPtr) : native_cpu::mem_access_t());
 
   return UR_RESULT_SUCCESS;
 }
@@ -238,20 +236,23 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
                      const ur_kernel_arg_mem_obj_properties_t *pProperties,
                      ur_mem_handle_t hArgValue) {
-  // TODO: out_of_order args?
-  std::ignore = argIndex;
-  std::ignore = pProperties;
-
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   // Taken from ur/adapters/cuda/kernel.cpp
   // zero-sized buffers are expected to be null.
   if (hArgValue == nullptr) {
-    hKernel->_args.emplace_back(nullptr);
+    hKernel->getArgsForWrite().setPtr(argIndex, nullptr);
     return UR_RESULT_SUCCESS;
   }
 
-  hKernel->_args.emplace_back(hArgValue->_mem);
+  // Without properties the kernel may read and write the buffer.
+  bool Write = !pProperties ||
+               !(pProperties->memoryAccess & UR_MEM_FLAG_READ_ONLY) ||
+               (pProperties->memoryAccess & UR_MEM_FLAG_READ_WRITE);
+  hKernel->getArgsForWrite().setPtr(
+      argIndex, hArgValue->_mem,
+      native_cpu::mem_access_t(hArgValue->_mem, hArgValue->_size, Write),
+      hArgValue);
   return UR_RESULT_SUCCESS;
 }
 
@@ -286,3 +287,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
 
   DIE_NO_IMPLEMENTATION
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urKernelCloneExp(ur_kernel_handle_t hKernel,
+                 ur_kernel_handle_t *phKernelClone) {
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phKernelClone, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  try {
+    *phKernelClone = new ur_kernel_handle_t_(*hKernel);
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
@@ -12,8 +12,13 @@
 
 #include "common.hpp"
 #include "nativecpu_state.hpp"
+#include "scheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <ur_api.h>
 #include <utility>
+#include <vector>
 
 namespace native_cpu {
 
@@ -37,22 +42,129 @@ struct local_arg_info_t {
       : argIndex(argIndex), argSize(argSize) {}
 };
 
+namespace native_cpu {
+
+// Arguments of a kernel, indexed by argument index. By-value arguments are
+// copied so that they outlive the urKernelSetArg* call, which lets a kernel
+// share its arguments with its clones.
+struct kernel_args {
+  kernel_args() = default;
+  kernel_args(const kernel_args &Other)
+      : Descs(Other.Descs), Values(Other.Values), Accesses(Other.Accesses),
+        Mems(Other.Mems), LocalArgInfo(Other.LocalArgInfo) {
+    // Point the copied descriptors at the copied values.
+    for (size_t I = 0; I < Values.size(); I++) {
+      if (!Values[I].empty()) {
+        Descs[I].MPtr = Values[I].data();
+      }
+    }
+  }
+  kernel_args &operator=(const kernel_args &) = delete;
+
+  void setValue(uint32_t Index, const void *Value, size_t Size) {
+    resize(Index);
+    auto Bytes = static_cast<const char *>(Value);
+    Values[Index].assign(Bytes, Bytes + Size);
+    Descs[Index].MPtr = Values[Index].data();
+    Accesses[Index] = mem_access_t();
+    Mems[Index] = nullptr;
+  }
+
+  void setPtr(uint32_t Index, void *Ptr, mem_access_t Access = mem_access_t(),
+              ur_mem_handle_t Mem = nullptr) {
+    resize(Index);
+    Values[Index].clear();
+    Descs[Index].MPtr = Ptr;
+    Accesses[Index] = Access;
+    Mems[Index] = Mem;
+  }
+
+  // The pointer into the local memory pool is filled in by
+  // ur_kernel_handle_t_::handleLocalArgs before each launch.
+  void setLocal(uint32_t Index, size_t Size) {
+    setPtr(Index, nullptr);
+    LocalArgInfo.emplace_back(Index, Size);
+  }
+
+  std::vector<NativeCPUArgDesc> Descs;
+  // Copies of the by-value arguments, empty for the other kinds.
+  std::vector<std::vector<char>> Values;
+  // Memory the kernel may access through each argument, empty for by-value
+  // and local arguments.
+  std::vector<mem_access_t> Accesses;
+  // Memory objects set with urKernelSetArgMemObj, null for the other kinds.
+  std::vector<ur_mem_handle_t> Mems;
+  std::vector<local_arg_info_t> LocalArgInfo;
+
+private:
+  void resize(uint32_t Index) {
+    if (Index >= Descs.size()) {
+      Descs.resize(Index + 1, NativeCPUArgDesc(nullptr));
+      Values.resize(Index + 1);
+      Accesses.resize(Index + 1);
+      Mems.resize(Index + 1);
+    }
+    // An argument previously set as local may be overwritten by any kind.
+    LocalArgInfo.erase(std::remove_if(LocalArgInfo.begin(), LocalArgInfo.end(),
+                                      [Index](const local_arg_info_t &Entry) {
+                                        return Entry.argIndex == Index;
+                                      }),
+                       LocalArgInfo.end());
+  }
+};
+
+} // namespace native_cpu
+
 struct ur_kernel_handle_t_ : RefCounted {
 
-  ur_kernel_handle_t_(const char *name, nativecpu_task_t subhandler)
-      : _name{name}, _subhandler{std::move(subhandler)} {}
+  ur_kernel_handle_t_(const char *name, nativecpu_task_t subhandler,
+                      const char *variant = nullptr)
+      : _name{name}, _variant{variant}, _subhandler{std::move(subhandler)},
+        _args{std::make_shared<native_cpu::kernel_args>()} {}
+
+  // Used by urKernelCloneExp. The clone shares the arguments of the original
+  // until either of them modifies them, and gets its own local memory pool.
+  ur_kernel_handle_t_(const ur_kernel_handle_t_ &Other)
+      : RefCounted(), _name(Other._name), _variant(Other._variant),
+        _subhandler(Other._subhandler), _args(Other._args), _argsShared(true) {
+    Other._argsShared.store(true, std::memory_order_relaxed);
+  }
+
+  ur_kernel_handle_t_ &operator=(const ur_kernel_handle_t_ &) = delete;
 
   const char *_name;
+  // Name of the ISA variant picked from the binary, owned by the program.
+  const char *_variant;
   nativecpu_task_t _subhandler;
-  std::vector<native_cpu::NativeCPUArgDesc> _args;
-  std::vector<local_arg_info_t> _localArgInfo;
+
+  const native_cpu::kernel_args &getArgs() const { return *_args; }
+
+  // Arguments for a launch running after the call returns, later changes to
+  // the arguments of the kernel copy them first.
+  std::shared_ptr<const native_cpu::kernel_args> shareArgs() const {
+    _argsShared.store(true, std::memory_order_relaxed);
+    return _args;
+  }
+
+  // Returns arguments that are safe to modify, copying them first if they
+  // were ever handed to a launch or a clone.
+  native_cpu::kernel_args &getArgsForWrite() {
+    if (_argsShared.exchange(false, std::memory_order_relaxed)) {
+      _args = std::make_shared<native_cpu::kernel_args>(*_args);
+    }
+    return *_args;
+  }
 
   // To be called before enqueing the kernel.
   void handleLocalArgs() {
+    if (_args->LocalArgInfo.empty()) {
+      return;
+    }
+    auto &Args = getArgsForWrite();
     updateMemPool();
     size_t offset = 0;
-    for (auto &entry : _localArgInfo) {
-      _args[entry.argIndex].MPtr =
+    for (auto &entry : Args.LocalArgInfo) {
+      Args.Descs[entry.argIndex].MPtr =
           reinterpret_cast<char *>(_localMemPool) + offset;
       // update offset in the memory pool
       // Todo: update this offset computation when we have work-group
@@ -76,7 +188,7 @@ private:
     // the number of work groups being executed in parallel (e.g. number of
     // threads in the thread pool).
     size_t reqSize = 0;
-    for (auto &entry : _localArgInfo) {
+    for (auto &entry : _args->LocalArgInfo) {
       reqSize += entry.argSize;
     }
     if (reqSize == 0 || reqSize == _localMemPoolSize) {
@@ -86,6 +198,10 @@ private:
     _localMemPool = realloc(_localMemPool, reqSize);
     _localMemPoolSize = reqSize;
   }
+  std::shared_ptr<native_cpu::kernel_args> _args;
+  // Whether _args may be referenced from elsewhere, the reference count of
+  // the shared_ptr can't tell that reliably while other threads drop theirs.
+  mutable std::atomic<bool> _argsShared{false};
   void *_localMemPool = nullptr;
   size_t _localMemPoolSize = 0;
 };
@@ -57,26 +57,25 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
   } else {
     retMem = new _ur_buffer(hContext, size);
   }
+  retMem->_size = size;
 
   *phBuffer = retMem;
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urMemRetain(ur_mem_handle_t hMem) {
-  std::ignore = hMem;
+  UR_ASSERT(hMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION
+  hMem->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urMemRelease(ur_mem_handle_t hMem) {
   UR_ASSERT(hMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  hMem->decrementRefCount();
-  if (hMem->_refCount > 0) {
-    return UR_RESULT_SUCCESS;
-  }
-
-  delete hMem;
+  // Commands in flight hold a reference to the memory they access, the last
+  // of them to complete deletes it.
+  decrementOrDelete(hMem);
   return UR_RESULT_SUCCESS;
 }
 
@@ -17,7 +17,7 @@
 #include "common.hpp"
 #include "context.hpp"
 
-struct ur_mem_handle_t_ : _ur_object {
+struct ur_mem_handle_t_ : _ur_object, RefCounted {
   ur_mem_handle_t_(size_t Size, bool _IsImage)
       : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true},
         IsImage{_IsImage} {}
@@ -32,20 +32,19 @@ struct ur_mem_handle_t_ : _ur_object {
       : _mem{static_cast<char *>(HostPtr)}, _ownsMem{false}, IsImage{_IsImage} {
   }
 
-  ~ur_mem_handle_t_() {
+  virtual ~ur_mem_handle_t_() {
     if (_ownsMem) {
       free(_mem);
     }
   }
 
-  void decrementRefCount() noexcept { _refCount--; }
-
   // Method to get type of the derived object (image or buffer)
   bool isImage() const { return this->IsImage; }
 
   char *_mem;
+  // Size in bytes, used to track which commands access the buffer.
+  size_t _size = 0;
   bool _ownsMem;
-  std::atomic_uint32_t _refCount = {1};
 
 private:
   const bool IsImage;
@@ -59,10 +58,18 @@ struct _ur_buffer final : ur_mem_handle_t_ {
       : ur_mem_handle_t_(HostPtr, Size, false) {}
   _ur_buffer(ur_context_handle_t /* Context*/, size_t Size)
       : ur_mem_handle_t_(Size, false) {}
+  // Sub-buffers keep their parent, which owns their memory, alive.
   _ur_buffer(_ur_buffer *b, size_t Offset, size_t Size)
       : ur_mem_handle_t_(b->_mem + Offset, false), SubBuffer(b) {
-    std::ignore = Size;
+    _size = Size;
     SubBuffer.Origin = Offset;
+    b->incrementReferenceCount();
+  }
+
+  ~_ur_buffer() override {
+    if (SubBuffer.Parent) {
+      decrementOrDelete(SubBuffer.Parent);
+    }
   }
 
   bool isSubBuffer() const { return SubBuffer.Parent != nullptr; }
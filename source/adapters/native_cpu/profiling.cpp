@@ -0,0 +1,155 @@
+//===----------- profiling.cpp - Native CPU Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <tuple>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "profiling.hpp"
+
+uint64_t native_cpu::getTimestamp() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+      .count();
+}
+
+namespace {
+// Set once opening the counters failed, they will fail on any thread.
+std::atomic<bool> CountersUnavailable{false};
+
+#ifdef __linux__
+constexpr uint64_t CounterConfigs[] = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+constexpr size_t NumCounters = std::size(CounterConfigs);
+
+// Counter group of a thread, all counters are scheduled on the PMU together
+// and read with a single read on the group leader.
+struct thread_counters {
+  int Fds[NumCounters] = {-1, -1, -1, -1};
+  bool Opened = false;
+
+  ~thread_counters() {
+    for (int Fd : Fds) {
+      if (Fd >= 0) {
+        close(Fd);
+      }
+    }
+  }
+
+  bool open() {
+    Opened = true;
+    for (size_t I = 0; I < NumCounters; I++) {
+      perf_event_attr Attr;
+      memset(&Attr, 0, sizeof(Attr));
+      Attr.size = sizeof(Attr);
+      Attr.type = PERF_TYPE_HARDWARE;
+      Attr.config = CounterConfigs[I];
+      // Kernel and hypervisor events need a lower perf_event_paranoid.
+      Attr.exclude_kernel = 1;
+      Attr.exclude_hv = 1;
+      Attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+      Fds[I] = static_cast<int>(syscall(SYS_perf_event_open, &Attr, 0, -1,
+                                        I ? Fds[0] : -1, PERF_FLAG_FD_CLOEXEC));
+      if (Fds[I] < 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool read(native_cpu::perf_counts &Counts) {
+    struct {
+      uint64_t Nr;
+      uint64_t TimeEnabled;
+      uint64_t TimeRunning;
+      uint64_t Values[NumCounters];
+    } Data;
+    if (::read(Fds[0], &Data, sizeof(Data)) != sizeof(Data) ||
+        Data.TimeRunning == 0) {
+      return false;
+    }
+    // Scale up for the time the group was multiplexed out.
+    auto Scale = [&Data](uint64_t Value) {
+      if (Data.TimeRunning == Data.TimeEnabled) {
+        return Value;
+      }
+      return static_cast<uint64_t>(static_cast<double>(Value) *
+                                   Data.TimeEnabled / Data.TimeRunning);
+    };
+    Counts.Cycles = Scale(Data.Values[0]);
+    Counts.Instructions = Scale(Data.Values[1]);
+    Counts.LLCMisses = Scale(Data.Values[2]);
+    Counts.BranchMisses = Scale(Data.Values[3]);
+    return true;
+  }
+};
+#endif
+
+// Counts reported by the threads helping the command measured on this
+// thread.
+thread_local native_cpu::perf_counts WorkerCounts;
+thread_local bool WorkerCountsValid = true;
+} // namespace
+
+bool native_cpu::readPerfCounts(perf_counts &Counts) {
+#ifdef __linux__
+  if (CountersUnavailable.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  thread_local thread_counters Counters;
+  if (!Counters.Opened && !Counters.open()) {
+    CountersUnavailable = true;
+    return false;
+  }
+  return Counters.read(Counts);
+#else
+  std::ignore = Counts;
+  return false;
+#endif
+}
+
+native_cpu::command_timer::command_timer(bool Enabled) : Enabled(Enabled) {
+  if (!Enabled) {
+    return;
+  }
+  WorkerCounts = perf_counts();
+  WorkerCountsValid = true;
+  Counting = readPerfCounts(Start);
+  StartNs = getTimestamp();
+}
+
+void native_cpu::command_timer::stop(command_profile &Profile) {
+  if (!Enabled) {
+    return;
+  }
+  Profile.StartNs = StartNs;
+  Profile.EndNs = getTimestamp();
+  perf_counts End;
+  Profile.HasCounts = Counting && WorkerCountsValid && readPerfCounts(End);
+  if (Profile.HasCounts) {
+    Profile.Counts = End - Start;
+    Profile.Counts += WorkerCounts;
+  }
+}
+
+void native_cpu::addWorkerCounts(const perf_counts &Counts, bool Valid) {
+  WorkerCounts += Counts;
+  WorkerCountsValid = WorkerCountsValid && Valid;
+}
@@ -0,0 +1,84 @@
+//===----------- profiling.hpp - Native CPU Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstdint>
+
+namespace native_cpu {
+
+// Nanoseconds on the clock urDeviceGetGlobalTimestamps reports.
+uint64_t getTimestamp();
+
+// Hardware counters of the user space execution of a thread.
+struct perf_counts {
+  uint64_t Cycles = 0;
+  uint64_t Instructions = 0;
+  uint64_t LLCMisses = 0;
+  uint64_t BranchMisses = 0;
+
+  perf_counts &operator+=(const perf_counts &Other) {
+    Cycles += Other.Cycles;
+    Instructions += Other.Instructions;
+    LLCMisses += Other.LLCMisses;
+    BranchMisses += Other.BranchMisses;
+    return *this;
+  }
+
+  perf_counts operator-(const perf_counts &Other) const {
+    perf_counts Delta;
+    Delta.Cycles = Cycles - Other.Cycles;
+    Delta.Instructions = Instructions - Other.Instructions;
+    Delta.LLCMisses = LLCMisses - Other.LLCMisses;
+    Delta.BranchMisses = BranchMisses - Other.BranchMisses;
+    return Delta;
+  }
+};
+
+// Reads the counters of the calling thread, which are opened with
+// perf_event_open the first time the thread reads them. Returns false if they
+// are not available, e.g. because perf_event_paranoid forbids access, in
+// which case no thread tries to open them again.
+bool readPerfCounts(perf_counts &Counts);
+
+// Profiling information of the command of an event, filled in if the queue
+// was created with UR_QUEUE_FLAG_PROFILING_ENABLE.
+struct command_profile {
+  uint64_t QueuedNs = 0;
+  uint64_t StartNs = 0;
+  uint64_t EndNs = 0;
+  // Set if the counters could be read on all the threads which executed the
+  // command.
+  bool HasCounts = false;
+  perf_counts Counts;
+};
+
+// Measures the execution of a command on the calling thread, which is
+// expected to run the whole command before calling stop. Threads helping it
+// report their share through addWorkerCounts on the measuring thread.
+class command_timer {
+public:
+  explicit command_timer(bool Enabled);
+
+  // Fills in the start and end timestamps and counters of Profile.
+  void stop(command_profile &Profile);
+
+private:
+  bool Enabled;
+  bool Counting = false;
+  uint64_t StartNs = 0;
+  perf_counts Start;
+};
+
+// Adds counts of another thread to the command measured on the calling
+// thread. Valid is false if the other thread failed to read its counters.
+void addWorkerCounts(const perf_counts &Counts, bool Valid);
+
+} // namespace native_cpu
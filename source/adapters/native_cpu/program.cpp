@@ -10,9 +10,44 @@
 
 #include "ur_api.h"
 
+#include <bitset>
+#include <iterator>
+
 #include "common.hpp"
 #include "program.hpp"
 
+namespace {
+// ISA extensions from the least to the most preferred. The bit values of
+// nativecpu_isa_feature follow the binary format, not this order, e.g. a
+// variant using AVX2 is preferred to one only using FMA.
+constexpr nativecpu_isa_feature ISAOrder[] = {
+    NATIVECPU_ISA_NEON,     NATIVECPU_ISA_SSE4_2,   NATIVECPU_ISA_AVX,
+    NATIVECPU_ISA_FMA,      NATIVECPU_ISA_AVX2,     NATIVECPU_ISA_AVX512F,
+    NATIVECPU_ISA_AVX512VL, NATIVECPU_ISA_AVX512DQ, NATIVECPU_ISA_AVX512BW,
+};
+
+// The position in ISAOrder of the most preferred feature in the mask plus
+// one, 0 for a mask without known features.
+int isaLevel(uint64_t features) {
+  int level = 0;
+  for (int i = 0; i < static_cast<int>(std::size(ISAOrder)); i++) {
+    if (features & ISAOrder[i]) {
+      level = i + 1;
+    }
+  }
+  return level;
+}
+} // namespace
+
+// A variant requiring a more preferred ISA extension wins, then the one using
+// more extensions.
+bool native_cpu::isBetterVariant(uint64_t features, uint64_t other) {
+  if (isaLevel(features) != isaLevel(other)) {
+    return isaLevel(features) > isaLevel(other);
+  }
+  return std::bitset<64>(features).count() > std::bitset<64>(other).count();
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL
 urProgramCreateWithIL(ur_context_handle_t hContext, const void *pIL,
                       size_t length, const ur_program_properties_t *pProperties,
@@ -38,15 +73,43 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
   UR_ASSERT(phProgram, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pBinary != nullptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
+  const auto *header =
+      reinterpret_cast<const nativecpu_program_header *>(pBinary);
+  if (header->magic == NATIVECPU_PROGRAM_MAGIC &&
+      header->version != NATIVECPU_PROGRAM_VERSION) {
+    return UR_RESULT_ERROR_INVALID_BINARY;
+  }
+
   auto hProgram = new ur_program_handle_t_(
       hContext, reinterpret_cast<const unsigned char *>(pBinary));
 
-  const nativecpu_entry *nativecpu_it =
-      reinterpret_cast<const nativecpu_entry *>(pBinary);
-  while (nativecpu_it->kernel_ptr != nullptr) {
-    hProgram->_kernels.insert(
-        std::make_pair(nativecpu_it->kernelname, nativecpu_it->kernel_ptr));
-    nativecpu_it++;
+  if (header->magic == NATIVECPU_PROGRAM_MAGIC) {
+    // The features were read once when the device was created.
+    const uint64_t hostFeatures = hDevice->HostInfo.ISAFeatures;
+    for (auto *it = header->entries; it->kernel_ptr != nullptr; it++) {
+      if (it->required_features & ~hostFeatures) {
+        continue;
+      }
+      ur_program_handle_t_::kernel_variant variant{
+          it->kernel_ptr, it->variant_name, it->required_features};
+      auto [entry, inserted] =
+          hProgram->_kernels.insert(std::make_pair(it->kernelname, variant));
+      if (!inserted && native_cpu::isBetterVariant(
+                           it->required_features,
+                           entry->second.required_features)) {
+        entry->second = variant;
+      }
+    }
+  } else {
+    const nativecpu_entry *nativecpu_it =
+        reinterpret_cast<const nativecpu_entry *>(pBinary);
+    while (nativecpu_it->kernel_ptr != nullptr) {
+      hProgram->_kernels.insert(std::make_pair(
+          nativecpu_it->kernelname,
+          ur_program_handle_t_::kernel_variant{nativecpu_it->kernel_ptr,
+                                               nullptr, 0}));
+      nativecpu_it++;
+    }
   }
 
   *phProgram = hProgram;
@@ -107,6 +170,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_context_handle_t hContext, ur_program_handle_t hProgram,
+    const char *pOptions, ur_exp_program_build_callback_t pfnNotify,
+    void *pUserData) {
+  // Kernels are compiled ahead of time, there is nothing to wait for.
+  pfnNotify(urProgramBuild(hContext, hProgram, pOptions), pUserData);
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL
 urProgramRetain(ur_program_handle_t hProgram) {
   hProgram->incrementReferenceCount();
@@ -13,6 +13,7 @@
 #include <ur_api.h>
 
 #include "context.hpp"
+#include <cstdint>
 #include <map>
 
 struct ur_program_handle_t_ : RefCounted {
@@ -29,7 +30,14 @@ struct ur_program_handle_t_ : RefCounted {
     }
   };
 
-  std::map<const char *, const unsigned char *, _compare> _kernels;
+  struct kernel_variant {
+    const unsigned char *kernel_ptr;
+    // Null for binaries without variants.
+    const char *variant_name;
+    uint64_t required_features;
+  };
+
+  std::map<const char *, kernel_variant, _compare> _kernels;
 };
 
 // The nativecpu_entry struct is also defined as LLVM-IR in the
@@ -40,3 +48,51 @@ struct nativecpu_entry {
   const char *kernelname;
   const unsigned char *kernel_ptr;
 };
+
+// CPU features a kernel variant can require, as bits of
+// nativecpu_variant_entry::required_features. The values are part of the
+// binary format, new features may only be appended. The bit order says
+// nothing about which variant is preferred, see ISAOrder in program.cpp.
+enum nativecpu_isa_feature : uint64_t {
+  NATIVECPU_ISA_SSE4_2 = 1ull << 0,
+  NATIVECPU_ISA_AVX = 1ull << 1,
+  NATIVECPU_ISA_AVX2 = 1ull << 2,
+  NATIVECPU_ISA_FMA = 1ull << 3,
+  NATIVECPU_ISA_AVX512F = 1ull << 4,
+  NATIVECPU_ISA_AVX512BW = 1ull << 5,
+  NATIVECPU_ISA_AVX512DQ = 1ull << 6,
+  NATIVECPU_ISA_AVX512VL = 1ull << 7,
+  NATIVECPU_ISA_NEON = 1ull << 32,
+};
+
+// Binaries with several variants per kernel start with a
+// nativecpu_program_header instead of a nativecpu_entry table. The magic sits
+// where the first kernel name pointer of an old binary is, and is never a
+// valid user space address. Like nativecpu_entry, these structs need to match
+// the clang-offload-wrapper.
+constexpr uintptr_t NATIVECPU_PROGRAM_MAGIC = ~uintptr_t(0) - 0x4e43;
+constexpr uint32_t NATIVECPU_PROGRAM_VERSION = 1;
+
+// One implementation of a kernel, usable on CPUs with all of its
+// required_features. A kernel may have any number of variants.
+struct nativecpu_variant_entry {
+  const char *kernelname;
+  const unsigned char *kernel_ptr;
+  uint64_t required_features;
+  // Reported by urKernelGetInfo, e.g. "avx2", may be null.
+  const char *variant_name;
+};
+
+struct nativecpu_program_header {
+  uintptr_t magic;
+  uint32_t version;
+  uint32_t reserved;
+  // Terminated by an entry with a null kernel_ptr.
+  const nativecpu_variant_entry *entries;
+};
+
+namespace native_cpu {
+// Whether a variant requiring features is preferred to one requiring other,
+// both being supported by the host.
+bool isBetterVariant(uint64_t features, uint64_t other);
+} // namespace native_cpu
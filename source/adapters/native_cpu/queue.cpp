@@ -10,10 +10,54 @@
 
 #include "queue.hpp"
 #include "common.hpp"
+#include "context.hpp"
+#include "device.hpp"
 
 #include "ur/ur.hpp"
 #include "ur_api.h"
 
+ur_queue_handle_t_::ur_queue_handle_t_(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_queue_properties_t *pProperties)
+    : Context(hContext),
+      Profiling(pProperties &&
+                (pProperties->flags & UR_QUEUE_FLAG_PROFILING_ENABLE)) {
+  Context->incrementReferenceCount();
+
+  const void *Next = pProperties ? pProperties->pNext : nullptr;
+  while (Next) {
+    auto *Base = static_cast<const ur_base_properties_t *>(Next);
+    if (Base->stype == UR_STRUCTURE_TYPE_EXP_QUEUE_EXECUTOR_PROPERTIES) {
+      auto *Executor =
+          reinterpret_cast<const ur_exp_queue_executor_properties_t *>(Base);
+      ExecutorSubmit = Executor->pfnSubmit;
+      ExecutorUserData = Executor->pUserData;
+      ExecutorConcurrency = Executor->concurrencyHint
+                                ? Executor->concurrencyHint
+                                : hDevice->HostInfo.NumThreads;
+    }
+    Next = Base->pNext;
+  }
+
+  if (ExecutorSubmit && pProperties &&
+      (pProperties->flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE)) {
+    Scheduler = new native_cpu::command_scheduler(this, ExecutorSubmit,
+                                                  ExecutorUserData);
+    native_cpu::retainUSMTracking();
+  }
+}
+
+ur_queue_handle_t_::~ur_queue_handle_t_() {
+  // Commands hold a reference to the queue through their event, none are
+  // left in flight here. Tasks still queued on the executor keep the
+  // scheduler alive.
+  if (Scheduler) {
+    Scheduler->release();
+    native_cpu::releaseUSMTracking();
+  }
+  decrementOrDelete(Context);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
                                                    ur_queue_info_t propName,
                                                    size_t propSize,
@@ -31,11 +75,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
 UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProperties, ur_queue_handle_t *phQueue) {
-  std::ignore = hContext;
-  std::ignore = hDevice;
-  std::ignore = pProperties;
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  auto Queue = new ur_queue_handle_t_();
+  auto Queue = new ur_queue_handle_t_(hContext, hDevice, pProperties);
   *phQueue = Queue;
 
   CONTINUE_NO_IMPLEMENTATION;
@@ -78,8 +120,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
-  std::ignore = hQueue;
-  // TODO: is this fine as no-op?
+  // Queues without a scheduler run commands synchronously.
+  if (hQueue->Scheduler) {
+    hQueue->Scheduler->waitAll();
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -9,5 +9,28 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 #include "common.hpp"
+#include "scheduler.hpp"
 
-struct ur_queue_handle_t_ : RefCounted {};
+struct ur_queue_handle_t_ : RefCounted {
+  ur_queue_handle_t_(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+                     const ur_queue_properties_t *pProperties);
+  ~ur_queue_handle_t_();
+
+  // Retained, events of the queue are pooled in the context.
+  ur_context_handle_t Context;
+  // Set by UR_QUEUE_FLAG_PROFILING_ENABLE, commands then record timestamps
+  // and hardware counters in their events.
+  bool Profiling = false;
+
+  // Set from ur_exp_queue_executor_properties_t. Without an executor kernels
+  // run on the enqueuing thread only.
+  ur_exp_executor_submit_callback_t ExecutorSubmit = nullptr;
+  void *ExecutorUserData = nullptr;
+  // Number of threads, including the enqueuing one, a kernel launch is split
+  // across.
+  uint32_t ExecutorConcurrency = 1;
+  // Out-of-order queues with an executor run commands asynchronously,
+  // ordered by their wait lists and memory hazards. Commands of other queues
+  // run on the enqueuing thread, in order.
+  native_cpu::command_scheduler *Scheduler = nullptr;
+};
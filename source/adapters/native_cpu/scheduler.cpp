@@ -0,0 +1,163 @@
+//===----------- scheduler.cpp - Native CPU Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+
+#include "ur_api.h"
+
+#include "common.hpp"
+#include "context.hpp"
+#include "event.hpp"
+#include "queue.hpp"
+#include "scheduler.hpp"
+
+void native_cpu::command_scheduler::enqueue(
+    ur_command_t CommandType, std::vector<mem_access_t> Accesses,
+    std::function<void()> Run, bool Blocking, uint32_t NumEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  // Only commands of this queue are ordered by the graph, other queues
+  // complete their commands on their own.
+  for (uint32_t I = 0; I < NumEventsInWaitList; I++) {
+    if (phEventWaitList[I]->Queue != Queue) {
+      waitForEvents(1, &phEventWaitList[I]);
+    }
+  }
+
+  auto *Command = new command_t;
+  Command->Accesses = std::move(Accesses);
+  Command->Run = std::move(Run);
+  Command->Event = Queue->Context->EventPool.acquire(Queue, CommandType);
+  ur_event_handle_t Event = Command->Event;
+  if (phEvent) {
+    Event->incrementReferenceCount();
+    *phEvent = Event;
+  }
+  if (Blocking) {
+    Event->incrementReferenceCount();
+  }
+
+  bool IsReady;
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    for (auto *Other : InFlight) {
+      bool Depends =
+          std::find(phEventWaitList, phEventWaitList + NumEventsInWaitList,
+                    Other->Event) != phEventWaitList + NumEventsInWaitList;
+      for (auto &Access : Command->Accesses) {
+        if (Depends) {
+          break;
+        }
+        Depends = std::any_of(
+            Other->Accesses.begin(), Other->Accesses.end(),
+            [&](const mem_access_t &A) { return A.conflicts(Access); });
+      }
+      if (Depends) {
+        Other->Successors.push_back(Command);
+        Command->PendingDeps++;
+      }
+    }
+    InFlight.push_back(Command);
+    IsReady = Command->PendingDeps == 0;
+    if (IsReady) {
+      Ready.push_back(Command);
+    }
+  }
+  if (IsReady) {
+    submitTasks(1);
+  }
+
+  if (Blocking) {
+    wait(Event);
+    urEventRelease(Event);
+  }
+}
+
+void native_cpu::command_scheduler::wait(ur_event_handle_t hEvent) {
+  std::unique_lock<std::mutex> Lock(Mutex);
+  while (hEvent->getStatus() != UR_EVENT_STATUS_COMPLETE) {
+    if (!runReady(Lock)) {
+      Progress.wait(Lock);
+    }
+  }
+}
+
+void native_cpu::command_scheduler::waitAll() {
+  std::unique_lock<std::mutex> Lock(Mutex);
+  while (!InFlight.empty()) {
+    if (!runReady(Lock)) {
+      Progress.wait(Lock);
+    }
+  }
+}
+
+bool native_cpu::command_scheduler::runReady(
+    std::unique_lock<std::mutex> &Lock) {
+  if (Ready.empty()) {
+    return false;
+  }
+  command_t *Command = Ready.front();
+  Ready.pop_front();
+
+  while (Command) {
+    Lock.unlock();
+    Command->Event->setStatus(UR_EVENT_STATUS_RUNNING);
+    command_timer Timer(Queue->Profiling);
+    Command->Run();
+    Timer.stop(Command->Event->Profile);
+    Lock.lock();
+
+    InFlight.erase(std::find(InFlight.begin(), InFlight.end(), Command));
+    size_t NewlyReady = 0;
+    for (auto *Successor : Command->Successors) {
+      if (--Successor->PendingDeps == 0) {
+        Ready.push_back(Successor);
+        NewlyReady++;
+      }
+    }
+    // Set under the lock, waiters check the status before sleeping.
+    Command->Event->setStatus(UR_EVENT_STATUS_COMPLETE);
+    Progress.notify_all();
+
+    ur_event_handle_t Event = Command->Event;
+    delete Command;
+
+    // Keep going with one of the commands made ready, which likely uses the
+    // same data, and hand the others to the executor.
+    Command = nullptr;
+    if (NewlyReady) {
+      Command = Ready.back();
+      Ready.pop_back();
+      NewlyReady--;
+    }
+    Lock.unlock();
+    submitTasks(NewlyReady);
+    urEventRelease(Event);
+    Lock.lock();
+  }
+  return true;
+}
+
+void native_cpu::command_scheduler::submitTasks(size_t Count) {
+  for (size_t I = 0; I < Count; I++) {
+    retain();
+    Submit(UserData, runTask, this);
+  }
+}
+
+void native_cpu::command_scheduler::runTask(void *pTaskData) {
+  auto *Scheduler = static_cast<command_scheduler *>(pTaskData);
+  {
+    // The command this task was submitted for may have been run by a
+    // waiting thread already, there is nothing to do then.
+    std::unique_lock<std::mutex> Lock(Scheduler->Mutex);
+    Scheduler->runReady(Lock);
+  }
+  Scheduler->release();
+}
@@ -0,0 +1,121 @@
+//===----------- scheduler.hpp - Native CPU Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <ur_api.h>
+
+namespace native_cpu {
+
+// Byte range of host memory a command reads or writes.
+struct mem_access_t {
+  uintptr_t Begin = 0;
+  uintptr_t End = 0;
+  bool Write = false;
+
+  mem_access_t() = default;
+  mem_access_t(const void *Ptr, size_t Size, bool Write)
+      : Begin(reinterpret_cast<uintptr_t>(Ptr)), End(Begin + Size),
+        Write(Write) {}
+
+  // Access to memory of unknown extent, it conflicts with every access.
+  static mem_access_t all() {
+    mem_access_t Access;
+    Access.End = UINTPTR_MAX;
+    Access.Write = true;
+    return Access;
+  }
+
+  bool empty() const { return Begin == End; }
+
+  // Read after write, write after read and write after write hazards.
+  bool conflicts(const mem_access_t &Other) const {
+    return (Write || Other.Write) && Begin < Other.End && Other.Begin < End;
+  }
+};
+
+// Runs the commands of an out-of-order queue on the queue's executor. Each
+// command waits for the commands of the queue in its wait list and for those
+// in flight it has a memory hazard with, commands without either start
+// right away and run concurrently.
+//
+// Executors may defer tasks indefinitely, so every thread waiting on a
+// command of the queue runs ready commands itself until it is complete.
+// Tasks keep a reference to the scheduler, as they may run after the queue
+// is gone.
+class command_scheduler {
+public:
+  command_scheduler(ur_queue_handle_t hQueue,
+                    ur_exp_executor_submit_callback_t Submit, void *UserData)
+      : Queue(hQueue), Submit(Submit), UserData(UserData) {}
+  command_scheduler(const command_scheduler &) = delete;
+  command_scheduler &operator=(const command_scheduler &) = delete;
+
+  void retain() { RefCount.fetch_add(1, std::memory_order_relaxed); }
+
+  void release() {
+    if (RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+  // Schedules Run, which accesses the given memory. Events of other queues
+  // in the wait list are waited for on the calling thread. Blocking commands
+  // have completed on return.
+  void enqueue(ur_command_t CommandType, std::vector<mem_access_t> Accesses,
+               std::function<void()> Run, bool Blocking,
+               uint32_t NumEventsInWaitList,
+               const ur_event_handle_t *phEventWaitList,
+               ur_event_handle_t *phEvent);
+
+  // Blocks until hEvent, an event of this queue, is complete.
+  void wait(ur_event_handle_t hEvent);
+
+  // Blocks until all the commands enqueued so far are complete.
+  void waitAll();
+
+private:
+  struct command_t {
+    std::vector<mem_access_t> Accesses;
+    std::function<void()> Run;
+    ur_event_handle_t Event = nullptr;
+    uint32_t PendingDeps = 0;
+    std::vector<command_t *> Successors;
+  };
+
+  ~command_scheduler() = default;
+
+  // Runs a ready command and the commands it makes ready, returns false if
+  // there was none. Called and returns with Lock held.
+  bool runReady(std::unique_lock<std::mutex> &Lock);
+  void submitTasks(size_t Count);
+  static void runTask(void *pTaskData);
+
+  ur_queue_handle_t Queue;
+  ur_exp_executor_submit_callback_t Submit;
+  void *UserData;
+  std::atomic<uint32_t> RefCount{1};
+
+  std::mutex Mutex;
+  // Signalled when commands become ready or complete.
+  std::condition_variable Progress;
+  std::vector<command_t *> InFlight;
+  std::deque<command_t *> Ready;
+};
+
+} // namespace native_cpu
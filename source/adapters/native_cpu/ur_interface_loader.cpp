@@ -359,6 +359,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     return result;
   }
   pDdiTable->pfnPitchedAllocExp = urUSMPitchedAllocExp;
+  pDdiTable->pfnExportExp = urUSMExportExp;
+  pDdiTable->pfnImportHandleExp = urUSMImportHandleExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -403,6 +405,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
   }
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp = nullptr;
+  pDdiTable->pfnCloneExp = urKernelCloneExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -415,6 +418,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
   }
 
   pDdiTable->pfnBuildExp = urProgramBuildExp;
+  pDdiTable->pfnBuildAsyncExp = urProgramBuildAsyncExp;
   pDdiTable->pfnCompileExp = urProgramCompileExp;
   pDdiTable->pfnLinkExp = urProgramLinkExp;
 
@@ -8,60 +8,273 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "context.hpp"
+#include "ur_util.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
-               ur_usm_pool_handle_t pool, size_t size, void **ppMem) {
-  std::ignore = hContext;
-  std::ignore = pUSMDesc;
-  std::ignore = pool;
+#include <umf_pools/disjoint_pool_config_parser.hpp>
+#if defined(__linux__)
+#include <umf_providers/host_memory_provider.hpp>
+
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+umf::pool_unique_handle_t native_cpu::createHostMemPool() {
+#if defined(__linux__)
+  usm::HostMemoryProviderParams Params;
+  if (auto Config = ur_getenv("UR_NATIVE_CPU_USM_PROVIDER")) {
+    Params = usm::parseHostMemoryProviderConfig(*Config);
+  }
+  auto [Ret, Provider] =
+      umf::memoryProviderMakeUnique<usm::HostMemoryProvider>(Params);
+  if (Ret == UMF_RESULT_SUCCESS) {
+    // Allocations above MaxPoolableSize go to the provider directly. When
+    // huge pages are enabled, slabs are at least as large as the huge page
+    // threshold so they are huge page backed too.
+    auto PoolParams =
+        usm::DisjointPoolAllConfigs().Configs[usm::DisjointPoolMemType::Host];
+    if (Params.PageMode != usm::HostPageMode::None) {
+      PoolParams.SlabMinSize =
+          std::max(PoolParams.SlabMinSize, Params.HugePageThreshold);
+    }
+    auto [PoolRet, Pool] = umf::poolMakeUniqueFromOps(
+        &UMF_DISJOINT_POOL_OPS, std::move(Provider), &PoolParams);
+    if (PoolRet == UMF_RESULT_SUCCESS) {
+      return std::move(Pool);
+    }
+  }
+#endif
+  return umf::pool_unique_handle_t(nullptr, nullptr);
+}
+
+namespace {
+// Live USM allocations by start address, pointer kernel arguments are
+// tracked as accesses to the whole allocation they point into. Only queues
+// with a scheduler order commands by these accesses, so allocations are only
+// tracked while such a queue exists. Pointers into untracked allocations
+// access all memory.
+struct usm_allocations {
+  std::atomic<uint32_t> Users = 0;
+  std::atomic<size_t> NumTracked = 0;
+  std::mutex Mutex;
+  std::map<uintptr_t, size_t> Sizes;
+
+  void insert(void *Ptr, size_t Size) {
+    if (!Users.load(std::memory_order_relaxed)) {
+      return;
+    }
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (Sizes.insert_or_assign(reinterpret_cast<uintptr_t>(Ptr), Size)
+            .second) {
+      NumTracked++;
+    }
+  }
+
+  // Allocations tracked while a queue with a scheduler existed are erased
+  // even once none is left, their addresses may be reused.
+  void erase(void *Ptr) {
+    if (!NumTracked.load(std::memory_order_relaxed)) {
+      return;
+    }
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (Sizes.erase(reinterpret_cast<uintptr_t>(Ptr))) {
+      NumTracked--;
+    }
+  }
+};
+
+usm_allocations &getAllocations() {
+  static usm_allocations Allocations;
+  return Allocations;
+}
+
+// Allocations mapped from a memfd: exportable allocations of this process,
+// which own the memfd, and imports of other processes' allocations, for which
+// Fd is -1. The kernel keeps the memory alive as long as any process has it
+// mapped or holds a descriptor of it.
+struct shared_mappings {
+  struct mapping_t {
+    int Fd;
+    size_t Size;
+  };
+
+  std::mutex Mutex;
+  std::map<void *, mapping_t> Mappings;
+
+  void insert(void *Ptr, int Fd, size_t Size) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Mappings[Ptr] = {Fd, Size};
+  }
 
+  // Returns the memfd of an exportable allocation starting at Ptr, or -1.
+  int getFd(void *Ptr) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    auto It = Mappings.find(Ptr);
+    return It == Mappings.end() ? -1 : It->second.Fd;
+  }
+
+  // Unmaps Ptr, returns false if it isn't a shared mapping.
+  bool unmap(void *Ptr) {
+    mapping_t Mapping;
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      auto It = Mappings.find(Ptr);
+      if (It == Mappings.end()) {
+        return false;
+      }
+      Mapping = It->second;
+      Mappings.erase(It);
+    }
+#if defined(__linux__)
+    munmap(Ptr, Mapping.Size);
+    if (Mapping.Fd >= 0) {
+      close(Mapping.Fd);
+    }
+#endif
+    return true;
+  }
+};
+
+shared_mappings &getSharedMappings() {
+  static shared_mappings Mappings;
+  return Mappings;
+}
+
+const ur_exp_usm_export_desc_t *
+findExportDesc(const ur_usm_desc_t *pUSMDesc) {
+  const void *Next = pUSMDesc ? pUSMDesc->pNext : nullptr;
+  while (Next) {
+    auto *Base = static_cast<const ur_base_desc_t *>(Next);
+    if (Base->stype == UR_STRUCTURE_TYPE_EXP_USM_EXPORT_DESC) {
+      return reinterpret_cast<const ur_exp_usm_export_desc_t *>(Base);
+    }
+    Next = Base->pNext;
+  }
+  return nullptr;
+}
+
+// Backs an exportable allocation with a memfd, so other processes can map
+// the same pages.
+ur_result_t allocExportable(size_t Size, size_t Align, void **ppMem) {
+#if defined(__linux__)
+  UR_ASSERT(Align <= static_cast<size_t>(sysconf(_SC_PAGESIZE)),
+            UR_RESULT_ERROR_UNSUPPORTED_ALIGNMENT);
+  int Fd = memfd_create("ur_native_cpu_usm", MFD_CLOEXEC);
+  if (Fd < 0) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  void *Ptr = MAP_FAILED;
+  if (ftruncate(Fd, Size) == 0) {
+    Ptr = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+  }
+  if (Ptr == MAP_FAILED) {
+    close(Fd);
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  getSharedMappings().insert(Ptr, Fd, Size);
+  getAllocations().insert(Ptr, Size);
+  *ppMem = Ptr;
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = Size;
+  std::ignore = Align;
+  std::ignore = ppMem;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
+} // namespace
+
+void native_cpu::retainUSMTracking() { getAllocations().Users++; }
+
+void native_cpu::releaseUSMTracking() { getAllocations().Users--; }
+
+native_cpu::mem_access_t native_cpu::usmAccess(const void *Ptr) {
+  auto &Allocations = getAllocations();
+  if (!Allocations.Users.load(std::memory_order_relaxed)) {
+    return mem_access_t::all();
+  }
+  auto Address = reinterpret_cast<uintptr_t>(Ptr);
+  std::lock_guard<std::mutex> Lock(Allocations.Mutex);
+  auto It = Allocations.Sizes.upper_bound(Address);
+  if (It == Allocations.Sizes.begin()) {
+    return mem_access_t::all();
+  }
+  --It;
+  if (Address >= It->first + It->second) {
+    return mem_access_t::all();
+  }
+  return mem_access_t(reinterpret_cast<const void *>(It->first), It->second,
+                      true);
+}
+
+static ur_result_t allocImpl(ur_context_handle_t hContext,
+                             const ur_usm_desc_t *pUSMDesc, size_t size,
+                             void **ppMem) {
   UR_ASSERT(ppMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
   UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
 
-  *ppMem = malloc(size);
+  size_t Align = pUSMDesc ? pUSMDesc->align : 0;
+  UR_ASSERT((Align & (Align - 1)) == 0, UR_RESULT_ERROR_INVALID_VALUE);
+  if (auto *Export = findExportDesc(pUSMDesc)) {
+    UR_ASSERT(Export->exportType == UR_EXP_USM_EXPORT_TYPE_FD,
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    return allocExportable(size, Align, ppMem);
+  }
 
+  if (!hContext->HostMemPool) {
+    *ppMem = malloc(size);
+    if (*ppMem) {
+      getAllocations().insert(*ppMem, size);
+    }
+    return UR_RESULT_SUCCESS;
+  }
+
+  auto *Pool = hContext->HostMemPool.get();
+  *ppMem = umfPoolAlignedMalloc(Pool, size, Align);
+  if (*ppMem == nullptr) {
+    return umf::umf2urResult(umfPoolGetLastAllocationError(Pool));
+  }
+  getAllocations().insert(*ppMem, size);
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
+               ur_usm_pool_handle_t pool, size_t size, void **ppMem) {
+  std::ignore = pool;
+
+  return allocImpl(hContext, pUSMDesc, size, ppMem);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                  const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
                  size_t size, void **ppMem) {
-  std::ignore = hContext;
   std::ignore = hDevice;
-  std::ignore = pUSMDesc;
   std::ignore = pool;
 
-  UR_ASSERT(ppMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-  // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
-  UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
-
-  *ppMem = malloc(size);
-
-  return UR_RESULT_SUCCESS;
+  return allocImpl(hContext, pUSMDesc, size, ppMem);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                  const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
                  size_t size, void **ppMem) {
-  std::ignore = hContext;
   std::ignore = hDevice;
-  std::ignore = pUSMDesc;
   std::ignore = pool;
 
-  UR_ASSERT(ppMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-  // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
-  UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
-
-  *ppMem = malloc(size);
-
-  return UR_RESULT_SUCCESS;
+  return allocImpl(hContext, pUSMDesc, size, ppMem);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
@@ -70,6 +283,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
 
   UR_ASSERT(pMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
+  getAllocations().erase(pMem);
+  if (getSharedMappings().unmap(pMem)) {
+    return UR_RESULT_SUCCESS;
+  }
+  if (auto *Pool = umfPoolByPtr(pMem)) {
+    return umf::umf2urResult(umfPoolFree(Pool, pMem));
+  }
   free(pMem);
 
   return UR_RESULT_SUCCESS;
@@ -139,3 +359,51 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMReleaseExp(ur_context_handle_t Context,
   std::ignore = HostPtr;
   DIE_NO_IMPLEMENTATION;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMExportExp(ur_context_handle_t hContext, void *pMem,
+               ur_exp_usm_export_type_t exportType,
+               ur_native_handle_t *phOsHandle) {
+  std::ignore = hContext;
+
+  UR_ASSERT(exportType == UR_EXP_USM_EXPORT_TYPE_FD,
+            UR_RESULT_ERROR_INVALID_VALUE);
+  int Fd = getSharedMappings().getFd(pMem);
+  UR_ASSERT(Fd >= 0, UR_RESULT_ERROR_INVALID_VALUE);
+
+  *phOsHandle = reinterpret_cast<ur_native_handle_t>(static_cast<intptr_t>(Fd));
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMImportHandleExp(ur_context_handle_t hContext,
+                     ur_exp_usm_export_type_t exportType,
+                     ur_native_handle_t hOsHandle, size_t size, void **ppMem) {
+  std::ignore = hContext;
+
+  UR_ASSERT(exportType == UR_EXP_USM_EXPORT_TYPE_FD,
+            UR_RESULT_ERROR_INVALID_VALUE);
+#if defined(__linux__)
+  // The mapping holds its own reference to the memory, the caller keeps
+  // ownership of the descriptor.
+  int Fd = static_cast<int>(reinterpret_cast<intptr_t>(hOsHandle));
+  struct stat Stat;
+  if (fstat(Fd, &Stat) != 0 || static_cast<size_t>(Stat.st_size) < size) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  void *Ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+  if (Ptr == MAP_FAILED) {
+    return errno == ENOMEM ? UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+                           : UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  getSharedMappings().insert(Ptr, -1, size);
+  getAllocations().insert(Ptr, size);
+  *ppMem = Ptr;
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = hOsHandle;
+  std::ignore = size;
+  std::ignore = ppMem;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
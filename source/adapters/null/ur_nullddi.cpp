@@ -5468,6 +5468,29 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelCloneExp
+__urdlllocal ur_result_t UR_APICALL urKernelCloneExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object to clone
+    ur_kernel_handle_t
+        *phKernelClone ///< [out] pointer to handle of the cloned kernel object
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // if the driver has created a custom function, then call it instead of using the generic path
+    auto pfnCloneExp = d_context.urDdiTable.KernelExp.pfnCloneExp;
+    if (nullptr != pfnCloneExp) {
+        result = pfnCloneExp(hKernel, phKernelClone);
+    } else {
+        // generic implementation
+        *phKernelClone = reinterpret_cast<ur_kernel_handle_t>(d_context.get());
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urProgramBuildExp
 __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
@@ -5551,6 +5574,84 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_program_handle_t hProgram, ///< [in] handle of the program object
+    const char *pOptions,         ///< [in][optional] string of build options
+    ur_exp_program_build_callback_t
+        pfnNotify, ///< [in] callback called once the build has finished
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to pfnNotify
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // if the driver has created a custom function, then call it instead of using the generic path
+    auto pfnBuildAsyncExp = d_context.urDdiTable.ProgramExp.pfnBuildAsyncExp;
+    if (nullptr != pfnBuildAsyncExp) {
+        result = pfnBuildAsyncExp(hContext, hProgram, pOptions, pfnNotify,
+                                  pUserData);
+    } else {
+        // generic implementation
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMExportExp
+__urdlllocal ur_result_t UR_APICALL urUSMExportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem, ///< [in] pointer to the start of the USM allocation
+    ur_exp_usm_export_type_t exportType, ///< [in] type of OS handle to return
+    ur_native_handle_t *phOsHandle       ///< [out] OS handle of the allocation
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // if the driver has created a custom function, then call it instead of using the generic path
+    auto pfnExportExp = d_context.urDdiTable.USMExp.pfnExportExp;
+    if (nullptr != pfnExportExp) {
+        result = pfnExportExp(hContext, pMem, exportType, phOsHandle);
+    } else {
+        // generic implementation
+        *phOsHandle = reinterpret_cast<ur_native_handle_t>(d_context.get());
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMImportHandleExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportHandleExp(
+    ur_context_handle_t hContext,        ///< [in] handle of the context object
+    ur_exp_usm_export_type_t exportType, ///< [in] type of hOsHandle
+    ur_native_handle_t
+        hOsHandle, ///< [in][nocheck] OS handle returned by ::urUSMExportExp in the exporting
+                   ///< process
+    size_t size,   ///< [in] size in bytes of the exported allocation
+    void **ppMem   ///< [out] pointer to the imported memory
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // if the driver has created a custom function, then call it instead of using the generic path
+    auto pfnImportHandleExp = d_context.urDdiTable.USMExp.pfnImportHandleExp;
+    if (nullptr != pfnImportHandleExp) {
+        result =
+            pfnImportHandleExp(hContext, exportType, hOsHandle, size, ppMem);
+    } else {
+        // generic implementation
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urUSMImportExp
 __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
@@ -6160,6 +6261,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
         driver::urKernelSuggestMaxCooperativeGroupCountExp;
 
+    pDdiTable->pfnCloneExp = driver::urKernelCloneExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
@@ -6375,6 +6478,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
 
     pDdiTable->pfnLinkExp = driver::urProgramLinkExp;
 
+    pDdiTable->pfnBuildAsyncExp = driver::urProgramBuildAsyncExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
@@ -6537,6 +6642,10 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
 
     pDdiTable->pfnPitchedAllocExp = driver::urUSMPitchedAllocExp;
 
+    pDdiTable->pfnExportExp = driver::urUSMExportExp;
+
+    pDdiTable->pfnImportHandleExp = driver::urUSMImportHandleExp;
+
     pDdiTable->pfnImportExp = driver::urUSMImportExp;
 
     pDdiTable->pfnReleaseExp = driver::urUSMReleaseExp;
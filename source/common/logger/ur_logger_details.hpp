@@ -9,6 +9,11 @@
 #include "ur_level.hpp"
 #include "ur_sinks.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
 namespace logger {
 
 struct LegacyMessage {
@@ -16,6 +21,78 @@ struct LegacyMessage {
     const char *message;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief State of a rate-limited logging call site, see UR_LOG_RATE_LIMITED.
+///
+/// At most `burst` messages are logged per period of `periodMs`
+/// milliseconds, further messages of the call site count as duplicates of the
+/// logged ones and are suppressed. The number of suppressed messages is
+/// reported with the first message of the next period that has one, and
+/// when the logger that last suppressed one is destroyed. Checks only use
+/// atomics. The counts are approximate when the period changes on several
+/// threads at once, or when several loggers share the call site.
+class RateLimit {
+  public:
+    static constexpr uint64_t DEFAULT_BURST = 10;
+    static constexpr uint64_t DEFAULT_PERIOD_MS = 1000;
+
+    constexpr RateLimit(uint64_t burst = DEFAULT_BURST,
+                        uint64_t periodMs = DEFAULT_PERIOD_MS)
+        : burst(burst), periodMs(periodMs) {}
+
+    // Returns true if a message may be logged. Messages suppressed in the
+    // previous periods are added to suppressedBefore.
+    bool acquire(uint64_t &suppressedBefore) {
+        auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+        int64_t current = static_cast<int64_t>(now / periodMs);
+        int64_t last = period.load(std::memory_order_relaxed);
+        if (last != current &&
+            period.compare_exchange_strong(last, current,
+                                           std::memory_order_relaxed)) {
+            logged.store(0, std::memory_order_relaxed);
+        }
+        if (logged.fetch_add(1, std::memory_order_relaxed) < burst) {
+            suppressedBefore += suppressed.exchange(0);
+            return true;
+        }
+        suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+  private:
+    friend class Logger;
+
+    // Set the first time a message is suppressed, when the call site is added
+    // to the registry.
+    std::atomic<bool> registered{false};
+    const char *format = nullptr;
+    logger::Level level = logger::Level::QUIET;
+    // Logger that last suppressed a message, which reports the count when it
+    // is destroyed. Only compared, never dereferenced.
+    std::atomic<const void *> owner{nullptr};
+
+    const uint64_t burst;
+    const uint64_t periodMs;
+    std::atomic<int64_t> period{-1};
+    std::atomic<uint64_t> logged{0};
+    std::atomic<uint64_t> suppressed{0};
+};
+
+/// @brief Call sites which suppressed messages, shared by all loggers so that
+///        a call site used through several loggers is reported by each of
+///        them. Never destroyed, as loggers may be static objects themselves.
+struct RateLimitRegistry {
+    std::mutex mutex;
+    std::vector<logger::RateLimit *> sites;
+
+    static RateLimitRegistry &get() {
+        static auto *registry = new RateLimitRegistry;
+        return *registry;
+    }
+};
+
 class Logger {
   public:
     Logger(std::unique_ptr<logger::Sink> sink) : sink(std::move(sink)) {
@@ -25,7 +102,24 @@ class Logger {
     Logger(logger::Level level, std::unique_ptr<logger::Sink> sink)
         : level(level), sink(std::move(sink)) {}
 
-    ~Logger() = default;
+    Logger(Logger &&) = default;
+    Logger &operator=(Logger &&) = default;
+
+    ~Logger() {
+        if (!sink) {
+            return;
+        }
+        auto &registry = RateLimitRegistry::get();
+        std::scoped_lock<std::mutex> lock(registry.mutex);
+        for (auto *limit : registry.sites) {
+            if (limit->owner.load(std::memory_order_relaxed) != this) {
+                continue;
+            }
+            if (uint64_t count = limit->suppressed.exchange(0)) {
+                logSuppressed(limit->level, limit->format, count);
+            }
+        }
+    }
 
     void setLevel(logger::Level level) { this->level = level; }
 
@@ -112,17 +206,63 @@ class Logger {
         sink->log(level, format, std::forward<Args>(args)...);
     }
 
+    // Logs the message unless the call site exceeded its rate limit, use
+    // UR_LOG_RATE_LIMITED rather than calling this directly.
+    template <typename... Args>
+    void logRateLimited(logger::RateLimit &limit, logger::Level level,
+                        const char *format, Args &&...args) {
+        if (!sink || (!isLegacySink && level < this->level)) {
+            return;
+        }
+
+        uint64_t suppressed = 0;
+        if (!limit.acquire(suppressed)) {
+            limit.owner.store(this, std::memory_order_relaxed);
+            if (!limit.registered.exchange(true)) {
+                auto &registry = RateLimitRegistry::get();
+                std::scoped_lock<std::mutex> lock(registry.mutex);
+                limit.format = format;
+                limit.level = level;
+                registry.sites.push_back(&limit);
+            }
+            return;
+        }
+        if (suppressed) {
+            logSuppressed(level, format, suppressed);
+        }
+        log(level, format, std::forward<Args>(args)...);
+    }
+
     void setLegacySink(std::unique_ptr<logger::Sink> legacySink) {
         this->isLegacySink = true;
         this->sink = std::move(legacySink);
     }
 
   private:
+    void logSuppressed(logger::Level level, const char *format,
+                       uint64_t count) {
+        if (sink && level >= this->level) {
+            sink->log(level, "Suppressed {} messages like \"{}\"", count,
+                      format);
+        }
+    }
+
     logger::Level level;
     std::unique_ptr<logger::Sink> sink;
     bool isLegacySink = false;
 };
 
+/// @brief Logs a message through a logger, at most
+///        logger::RateLimit::DEFAULT_BURST times per
+///        logger::RateLimit::DEFAULT_PERIOD_MS milliseconds for the call site.
+///        Meant for messages on hot paths which may repeat on every call.
+#define UR_LOG_RATE_LIMITED(loggerInstance, level, ...)                        \
+    do {                                                                       \
+        static logger::RateLimit urLogRateLimit_;                              \
+        (loggerInstance)                                                       \
+            .logRateLimited(urLogRateLimit_, level, __VA_ARGS__);              \
+    } while (0)
+
 } // namespace logger
 
 #endif /* UR_LOGGER_DETAILS_HPP */
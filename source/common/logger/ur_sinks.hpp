@@ -6,10 +6,32 @@
 #ifndef UR_SINKS_HPP
 #define UR_SINKS_HPP 1
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 #include "ur_filesystem_resolved.hpp"
 #include "ur_level.hpp"
@@ -185,6 +207,449 @@ class FileSink : public Sink {
     std::ofstream ofstream;
 };
 
+/// @brief Sink keeping the latest messages of each thread in memory.
+///
+/// Messages are copied into a fixed-size ring owned by the logging thread,
+/// without I/O or locks, so loggers can run at the debug level in production.
+/// The rings are appended to the file when a message at or above the flush
+/// level is logged, when the sink is destroyed, on urLoaderTearDown and, on
+/// Unix, when the process gets a fatal signal.
+class FlightRecorderSink : public Sink {
+  public:
+    // Records kept per thread, older ones are overwritten.
+    static constexpr size_t RING_RECORDS = 512;
+    // Longer messages are truncated.
+    static constexpr size_t RECORD_TEXT_SIZE = 240;
+    // Threads logging once all rings are in use are not recorded.
+    static constexpr size_t MAX_RINGS = 256;
+    static constexpr size_t MAX_SINKS = 16;
+
+    FlightRecorderSink(std::string logger_name, filesystem::path file_path,
+                       bool skip_prefix = false)
+        : Sink(std::move(logger_name), skip_prefix),
+          path(file_path.string()), id(nextId()),
+          start(std::chrono::steady_clock::now()) {
+        // Fail early, like FileSink, rather than when the first dump is due.
+        int fd = detail::openForAppend(path.c_str());
+        if (fd < 0) {
+            std::stringstream ss;
+            ss << "Failure while opening log file " << path
+               << ". Check if given path exists.";
+            throw std::invalid_argument(ss.str());
+        }
+        detail::closeFile(fd);
+        registerSink(this);
+    }
+
+    FlightRecorderSink(std::string logger_name, filesystem::path file_path,
+                       Level flush_lvl, bool skip_prefix = false)
+        : FlightRecorderSink(std::move(logger_name), std::move(file_path),
+                             skip_prefix) {
+        this->flush_level = flush_lvl;
+    }
+
+    ~FlightRecorderSink() {
+        unregisterSink(this);
+        // A dumpAll running on another thread, e.g. in a signal handler, may
+        // have loaded this sink before it was unregistered.
+        while (activeDumpAlls().load()) {
+            std::this_thread::yield();
+        }
+        dump("exit");
+    }
+
+    /// @brief Appends the records which have not been dumped yet to the file.
+    ///        Async-signal-safe.
+    void dump(const char *reason) {
+        // Dumps of the same sink are serialized, so that each record is
+        // written once. A dump interrupted by a fatal signal never resumes,
+        // the handler running on the same thread takes over instead of
+        // waiting for it.
+        uint64_t self = currentThread();
+        uint64_t owner = 0;
+        while (!dumpingThread.compare_exchange_weak(
+            owner, self, std::memory_order_acquire,
+            std::memory_order_relaxed)) {
+            if (owner == self) {
+                break;
+            }
+            owner = 0;
+            std::this_thread::yield();
+        }
+        dumpLocked(reason);
+        dumpingThread.store(0, std::memory_order_release);
+    }
+
+    /// @brief Dumps all flight recorder sinks of this library.
+    static void dumpAll(const char *reason) {
+        activeDumpAlls().fetch_add(1);
+        for (auto &sink : sinks()) {
+            if (auto *recorder = sink.load()) {
+                recorder->dump(reason);
+            }
+        }
+        activeDumpAlls().fetch_sub(1);
+    }
+
+  protected:
+    void print(logger::Level level, const std::string &msg) override {
+        if (Ring *ring = getRing()) {
+            uint64_t timeNs =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+            ring->write(timeNs, msg);
+        }
+        if (level >= flush_level) {
+            dump(level == logger::Level::QUIET ? "message"
+                                               : level_to_str(level));
+        }
+    }
+
+  private:
+    struct detail {
+        static int openForAppend(const char *path) {
+#ifdef _WIN32
+            return _open(path, _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY,
+                         _S_IREAD | _S_IWRITE);
+#else
+            return open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif
+        }
+
+        static void closeFile(int fd) {
+#ifdef _WIN32
+            _close(fd);
+#else
+            close(fd);
+#endif
+        }
+
+        static void writeBytes(int fd, const char *data, size_t size) {
+#ifdef _WIN32
+            _write(fd, data, static_cast<unsigned>(size));
+#else
+            while (size) {
+                ssize_t written = write(fd, data, size);
+                if (written <= 0) {
+                    return;
+                }
+                data += written;
+                size -= static_cast<size_t>(written);
+            }
+#endif
+        }
+
+        static void writeString(int fd, const char *str) {
+            writeBytes(fd, str, strlen(str));
+        }
+
+        // snprintf is not async-signal-safe.
+        static void writeNumber(int fd, uint64_t value, size_t width = 0) {
+            char buffer[24];
+            size_t pos = sizeof(buffer);
+            do {
+                buffer[--pos] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value && pos);
+            while (sizeof(buffer) - pos < width && pos) {
+                buffer[--pos] = '0';
+            }
+            writeBytes(fd, buffer + pos, sizeof(buffer) - pos);
+        }
+    };
+
+    static constexpr size_t RECORD_WORDS = RECORD_TEXT_SIZE / sizeof(uint64_t);
+
+    // Written by the owning thread only. Dumps may run on any thread while
+    // the record is overwritten, so the fields are atomics guarded by a
+    // sequence number, odd while the record is being written.
+    struct Record {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<uint64_t> timeNs{0};
+        std::atomic<uint64_t> tid{0};
+        std::atomic<uint64_t> length{0};
+        std::atomic<uint64_t> text[RECORD_WORDS] = {};
+    };
+
+    struct Ring {
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> dumped{0};
+        // Thread currently owning the ring.
+        std::atomic<uint64_t> tid{0};
+        std::atomic<bool> inUse{true};
+        Record records[RING_RECORDS];
+
+        void write(uint64_t timeNs, const std::string &msg) {
+            uint64_t index = head.load(std::memory_order_relaxed);
+            Record &record = records[index % RING_RECORDS];
+
+            uint64_t words[RECORD_WORDS] = {};
+            size_t length = std::min(msg.size(), RECORD_TEXT_SIZE);
+            std::memcpy(words, msg.data(), length);
+            if (length < msg.size()) {
+                std::memcpy(reinterpret_cast<char *>(words) + length - 4,
+                            "...\n", 4);
+            }
+
+            record.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            record.timeNs.store(timeNs, std::memory_order_relaxed);
+            record.tid.store(tid.load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+            record.length.store(length, std::memory_order_relaxed);
+            for (size_t i = 0; i < (length + 7) / 8; i++) {
+                record.text[i].store(words[i], std::memory_order_relaxed);
+            }
+            record.sequence.store(index * 2 + 2, std::memory_order_release);
+            head.store(index + 1, std::memory_order_release);
+        }
+
+        // Copies record index, returns false if it was overwritten meanwhile.
+        bool read(uint64_t index, uint64_t &timeNs, uint64_t &recordTid,
+                  char *text, size_t &length) const {
+            const Record &record = records[index % RING_RECORDS];
+            uint64_t sequence = record.sequence.load(std::memory_order_acquire);
+            if (sequence != index * 2 + 2) {
+                return false;
+            }
+            timeNs = record.timeNs.load(std::memory_order_relaxed);
+            recordTid = record.tid.load(std::memory_order_relaxed);
+            length = std::min<uint64_t>(
+                record.length.load(std::memory_order_relaxed),
+                RECORD_TEXT_SIZE);
+            uint64_t words[RECORD_WORDS];
+            for (size_t i = 0; i < (length + 7) / 8; i++) {
+                words[i] = record.text[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (record.sequence.load(std::memory_order_relaxed) != sequence) {
+                return false;
+            }
+            std::memcpy(text, words, length);
+            return true;
+        }
+    };
+
+    // Rings a thread writes to, one per sink. Rings are shared with the
+    // sink, so either may go away first.
+    struct ThreadRings {
+        struct Entry {
+            uint64_t sinkId;
+            std::shared_ptr<Ring> ring;
+        };
+        std::vector<Entry> entries;
+
+        ~ThreadRings() {
+            // Hand the rings over to new threads, keeping their records.
+            for (auto &entry : entries) {
+                entry.ring->inUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    Ring *getRing() {
+        static thread_local ThreadRings threadRings;
+        for (auto &entry : threadRings.entries) {
+            if (entry.sinkId == id) {
+                return entry.ring.get();
+            }
+        }
+
+        std::scoped_lock<std::mutex> lock(ringsMutex);
+        std::shared_ptr<Ring> ring;
+        for (auto &owned : ownedRings) {
+            if (!owned->inUse.load(std::memory_order_acquire)) {
+                ring = owned;
+                ring->inUse.store(true, std::memory_order_relaxed);
+                break;
+            }
+        }
+        if (!ring) {
+            if (ownedRings.size() >= MAX_RINGS) {
+                return nullptr;
+            }
+            ring = std::make_shared<Ring>();
+            rings[ownedRings.size()].store(ring.get(),
+                                           std::memory_order_release);
+            ownedRings.push_back(ring);
+            ringCount.store(ownedRings.size(), std::memory_order_release);
+        }
+#ifdef __linux__
+        ring->tid.store(static_cast<uint64_t>(syscall(SYS_gettid)),
+                        std::memory_order_relaxed);
+#else
+        ring->tid.store(ownedRings.size(), std::memory_order_relaxed);
+#endif
+        threadRings.entries.push_back({id, ring});
+        return ring.get();
+    }
+
+    static uint64_t currentThread() {
+#ifdef __linux__
+        return static_cast<uint64_t>(syscall(SYS_gettid));
+#else
+        return std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+#endif
+    }
+
+    void dumpLocked(const char *reason) {
+        size_t count = std::min(ringCount.load(std::memory_order_acquire),
+                                MAX_RINGS);
+        bool pending = false;
+        for (size_t i = 0; i < count && !pending; i++) {
+            Ring *ring = rings[i].load(std::memory_order_acquire);
+            pending = ring && ring->head.load(std::memory_order_acquire) >
+                                  ring->dumped.load(std::memory_order_relaxed);
+        }
+        if (!pending) {
+            return;
+        }
+
+        int fd = detail::openForAppend(path.c_str());
+        if (fd < 0) {
+            return;
+        }
+        detail::writeString(fd, "==== flight recorder, dump on ");
+        detail::writeString(fd, reason);
+        detail::writeString(fd, " ====\n");
+        for (size_t i = 0; i < count; i++) {
+            if (Ring *ring = rings[i].load(std::memory_order_acquire)) {
+                dumpRing(fd, *ring);
+            }
+        }
+        detail::closeFile(fd);
+    }
+
+    // Rings outlive their threads and are reused, so a ring may hold the
+    // records of several threads one after the other.
+    void dumpRing(int fd, Ring &ring) {
+        uint64_t head = ring.head.load(std::memory_order_acquire);
+        uint64_t first = ring.dumped.load(std::memory_order_relaxed);
+        uint64_t oldest = head > RING_RECORDS ? head - RING_RECORDS : 0;
+        uint64_t overwritten = first < oldest ? oldest - first : 0;
+        first = std::max(first, oldest);
+
+        char text[RECORD_TEXT_SIZE];
+        uint64_t lastTid = UINT64_MAX;
+        for (uint64_t index = first; index < head; index++) {
+            uint64_t timeNs = 0;
+            uint64_t tid = 0;
+            size_t length = 0;
+            if (!ring.read(index, timeNs, tid, text, length)) {
+                overwritten++;
+                continue;
+            }
+            if (tid != lastTid) {
+                detail::writeString(fd, "---- thread ");
+                detail::writeNumber(fd, tid);
+                if (overwritten) {
+                    detail::writeString(fd, ", ");
+                    detail::writeNumber(fd, overwritten);
+                    detail::writeString(fd, " older records overwritten");
+                    overwritten = 0;
+                }
+                detail::writeString(fd, " ----\n");
+                lastTid = tid;
+            }
+            detail::writeString(fd, "[");
+            detail::writeNumber(fd, timeNs / 1000000000);
+            detail::writeString(fd, ".");
+            detail::writeNumber(fd, timeNs / 1000 % 1000000, 6);
+            detail::writeString(fd, "] ");
+            detail::writeBytes(fd, text, length);
+            if (length == 0 || text[length - 1] != '\n') {
+                detail::writeString(fd, "\n");
+            }
+        }
+        ring.dumped.store(head, std::memory_order_relaxed);
+    }
+
+    static uint64_t nextId() {
+        static std::atomic<uint64_t> lastId{0};
+        return ++lastId;
+    }
+
+    static std::atomic<FlightRecorderSink *> (&sinks())[MAX_SINKS] {
+        static std::atomic<FlightRecorderSink *> registered[MAX_SINKS];
+        return registered;
+    }
+
+    // Number of dumpAll calls in progress. Sequentially consistent with the
+    // unregistration, so a sink either is not seen by a dumpAll or waits for
+    // it to finish.
+    static std::atomic<size_t> &activeDumpAlls() {
+        static std::atomic<size_t> active{0};
+        return active;
+    }
+
+    static void registerSink(FlightRecorderSink *sink) {
+        for (auto &slot : sinks()) {
+            FlightRecorderSink *expected = nullptr;
+            if (slot.compare_exchange_strong(expected, sink)) {
+                break;
+            }
+        }
+#ifndef _WIN32
+        installSignalHandlers();
+#endif
+    }
+
+    static void unregisterSink(FlightRecorderSink *sink) {
+        for (auto &slot : sinks()) {
+            FlightRecorderSink *expected = sink;
+            slot.compare_exchange_strong(expected, nullptr);
+        }
+    }
+
+#ifndef _WIN32
+    static constexpr int FATAL_SIGNALS[] = {SIGSEGV, SIGBUS, SIGILL, SIGFPE,
+                                            SIGABRT};
+
+    static struct sigaction *previousActions() {
+        static struct sigaction previous[std::size(FATAL_SIGNALS)];
+        return previous;
+    }
+
+    static void signalHandler(int signal) {
+        dumpAll(signal == SIGABRT ? "abort" : "fatal signal");
+        // Hand the signal to whoever handled it before, or to the default
+        // action, which terminates the process.
+        for (size_t i = 0; i < std::size(FATAL_SIGNALS); i++) {
+            if (FATAL_SIGNALS[i] == signal) {
+                sigaction(signal, &previousActions()[i], nullptr);
+            }
+        }
+        raise(signal);
+    }
+
+    static void installSignalHandlers() {
+        static std::once_flag installed;
+        std::call_once(installed, [] {
+            struct sigaction action = {};
+            action.sa_handler = signalHandler;
+            sigemptyset(&action.sa_mask);
+            action.sa_flags = SA_NODEFER;
+            for (size_t i = 0; i < std::size(FATAL_SIGNALS); i++) {
+                sigaction(FATAL_SIGNALS[i], &action, &previousActions()[i]);
+            }
+        });
+    }
+#endif
+
+    std::string path;
+    uint64_t id;
+    std::chrono::steady_clock::time_point start;
+
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<Ring>> ownedRings;
+    // Same rings as ownedRings, readable from signal handlers.
+    std::atomic<Ring *> rings[MAX_RINGS] = {};
+    std::atomic<size_t> ringCount{0};
+    // Thread writing a dump of this sink, 0 if none.
+    std::atomic<uint64_t> dumpingThread{0};
+};
+
 inline std::unique_ptr<Sink> sink_from_str(std::string logger_name,
                                            std::string name,
                                            filesystem::path file_path = "",
@@ -196,12 +661,15 @@ inline std::unique_ptr<Sink> sink_from_str(std::string logger_name,
     } else if (name == "file" && !file_path.empty()) {
         return std::make_unique<logger::FileSink>(logger_name, file_path,
                                                   skip_prefix);
+    } else if (name == "flight" && !file_path.empty()) {
+        return std::make_unique<logger::FlightRecorderSink>(
+            logger_name, file_path, skip_prefix);
     }
 
     throw std::invalid_argument(
         std::string("Parsing error: no valid sink for string '") + name +
         std::string("' with path '") + file_path.string() + std::string("'.") +
-        std::string("\nValid sink names are: stdout, stderr, file"));
+        std::string("\nValid sink names are: stdout, stderr, file, flight"));
 }
 
 } // namespace logger
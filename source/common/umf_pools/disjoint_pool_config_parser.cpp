@@ -7,6 +7,8 @@
 //===----------------------------------------------------------------------===//
 
 #include "disjoint_pool_config_parser.hpp"
+#include "logger/ur_logger.hpp"
+#include "ur_util.hpp"
 
 #include <iomanip>
 #include <iostream>
@@ -72,22 +74,12 @@ DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
 
     // TODO: replace with UR ENV var parser and avoid creating a copy of 'config'
     auto GetValue = [](std::string &Param, size_t Length, size_t &Setting) {
-        size_t Multiplier = 1;
-        if (tolower(Param[Length - 1]) == 'k') {
-            Length--;
-            Multiplier = 1_KB;
-        }
-        if (tolower(Param[Length - 1]) == 'm') {
-            Length--;
-            Multiplier = 1_MB;
-        }
-        if (tolower(Param[Length - 1]) == 'g') {
-            Length--;
-            Multiplier = 1_GB;
-        }
-        std::string TheNumber = Param.substr(0, Length);
-        if (TheNumber.find_first_not_of("0123456789") == std::string::npos) {
-            Setting = std::stoi(TheNumber) * Multiplier;
+        auto Value = Param.substr(0, Length);
+        if (auto Size = ur_parse_size(Value)) {
+            Setting = *Size;
+        } else {
+            logger::warning("USM pool config: invalid size '{}', keeping {}",
+                            Value, Setting);
         }
     };
 
@@ -218,6 +210,7 @@ DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
     AllConfigs.limits = std::shared_ptr<umf_disjoint_pool_shared_limits_t>(
         umfDisjointPoolSharedLimitsCreate(MaxSize),
         umfDisjointPoolSharedLimitsDestroy);
+    AllConfigs.MaxPoolSize = MaxSize;
 
     for (auto &Config : AllConfigs.Configs) {
         Config.SharedLimits = AllConfigs.limits.get();
@@ -11,6 +11,7 @@
 
 #include <umf/pools/pool_disjoint.h>
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -22,6 +23,7 @@ enum DisjointPoolMemType { Host, Device, Shared, SharedReadOnly, All };
 class DisjointPoolAllConfigs {
   public:
     size_t EnableBuffers = 1;
+    size_t MaxPoolSize = (std::numeric_limits<size_t>::max)();
     std::shared_ptr<umf_disjoint_pool_shared_limits_t> limits;
     umf_disjoint_pool_params_t Configs[DisjointPoolMemType::All];
 
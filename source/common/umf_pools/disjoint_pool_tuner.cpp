@@ -0,0 +1,243 @@
+//===--- disjoint_pool_tuner.cpp - adaptive tuning of USM memory pools ----==//
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "disjoint_pool_tuner.hpp"
+#include "logger/ur_logger.hpp"
+#include "ur_util.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace usm {
+
+// A size class qualifies as hot when it receives at least 1/HotShareDivisor
+// of the tracked allocations and its blocks get reused within
+// HotReuseDistance tracked allocations on average.
+constexpr size_t HotShareDivisor = 20;
+constexpr size_t HotReuseDistance = 256;
+
+static std::string formatSize(size_t Size) {
+    if (Size != 0 && Size % (1024 * 1024 * 1024) == 0) {
+        return std::to_string(Size / (1024 * 1024 * 1024)) + "G";
+    }
+    if (Size != 0 && Size % (1024 * 1024) == 0) {
+        return std::to_string(Size / (1024 * 1024)) + "M";
+    }
+    if (Size != 0 && Size % 1024 == 0) {
+        return std::to_string(Size / 1024) + "K";
+    }
+    return std::to_string(Size);
+}
+
+static size_t sizeClassOf(size_t Size) {
+    size_t Class = 0;
+    while (Class < 63 && (size_t(1) << Class) < Size) {
+        Class++;
+    }
+    return Class;
+}
+
+DisjointPoolTunerParams parseDisjointPoolTunerConfig(const std::string &config) {
+    DisjointPoolTunerParams Params;
+
+    std::stringstream Stream(config);
+    std::string Param;
+    size_t *Settings[] = {&Params.SampleRate, &Params.RetuneInterval,
+                          &Params.MaxPoolableSizeLimit, &Params.CapacityLimit};
+    for (size_t *Setting : Settings) {
+        if (!std::getline(Stream, Param, ',')) {
+            break;
+        }
+        if (auto Size = ur_parse_size(Param)) {
+            *Setting = *Size;
+        } else if (!Param.empty()) {
+            logger::warning("Disjoint pool tuner: ignoring invalid setting "
+                            "'{}', using {}",
+                            Param, *Setting);
+        }
+    }
+
+    Params.SampleRate = (std::max)(Params.SampleRate, size_t(1));
+    Params.RetuneInterval = (std::max)(Params.RetuneInterval, size_t(1));
+    return Params;
+}
+
+std::string disjointPoolConfigToString(const DisjointPoolAllConfigs &configs) {
+    static constexpr const char *MemTypeNames[] = {"host", "device", "shared",
+                                                   "read_only_shared"};
+
+    std::stringstream Out;
+    Out << configs.EnableBuffers << ";";
+    if (configs.MaxPoolSize != (std::numeric_limits<size_t>::max)()) {
+        Out << formatSize(configs.MaxPoolSize);
+    }
+    for (int i = 0; i < DisjointPoolMemType::All; i++) {
+        auto &Config = configs.Configs[i];
+        Out << ";" << MemTypeNames[i] << ":"
+            << formatSize(Config.MaxPoolableSize) << "," << Config.Capacity
+            << "," << formatSize(Config.SlabMinSize);
+    }
+    return Out.str();
+}
+
+DisjointPoolTuner::DisjointPoolTuner(const DisjointPoolAllConfigs &configs,
+                                     const DisjointPoolTunerParams &params)
+    : BaseConfigs(configs), Params(params), Configs(configs) {}
+
+size_t DisjointPoolTuner::filterSlotOf(void *ptr) {
+    auto Hash = reinterpret_cast<uintptr_t>(ptr) * 0x9E3779B97F4A7C15ull;
+    return (Hash >> 32) % FilterSize;
+}
+
+void DisjointPoolTuner::recordAlloc(DisjointPoolMemType memType, void *ptr,
+                                    size_t size) {
+    // Sample by allocation rather than by address, so that addresses the
+    // pool keeps recycling are tracked as often as any other.
+    if (!ptr || memType >= DisjointPoolMemType::All ||
+        AllocCount.fetch_add(1, std::memory_order_relaxed) %
+                Params.SampleRate !=
+            0) {
+        return;
+    }
+
+    std::scoped_lock<std::mutex> Lock(Mutex);
+    auto SizeClass = sizeClassOf(size);
+    if (!SampledAllocs.try_emplace(ptr, SampledAlloc{memType, SizeClass})
+             .second) {
+        return;
+    }
+    SampledFilter[filterSlotOf(ptr)].fetch_add(1, std::memory_order_relaxed);
+
+    auto &TypeStats = Stats[memType];
+    auto &ClassStats = TypeStats.Classes[SizeClass];
+    TypeStats.Tick++;
+    ClassStats.Allocs++;
+    ClassStats.Live++;
+    ClassStats.PeakLive = (std::max)(ClassStats.PeakLive, ClassStats.Live);
+    if (ClassStats.PendingFrees > 0) {
+        ClassStats.PendingFrees--;
+        ClassStats.ReuseDistanceSum += TypeStats.Tick - ClassStats.LastFreeTick;
+        ClassStats.ReuseCount++;
+    }
+
+    if (++TypeStats.SinceRetune >= Params.RetuneInterval) {
+        retune(memType);
+        TypeStats.SinceRetune = 0;
+    }
+}
+
+void DisjointPoolTuner::recordFree(void *ptr) {
+    // Most freed allocations were never sampled, reject them without the
+    // lock.
+    if (!ptr || SampledFilter[filterSlotOf(ptr)].load(
+                    std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    std::scoped_lock<std::mutex> Lock(Mutex);
+    auto It = SampledAllocs.find(ptr);
+    if (It == SampledAllocs.end()) {
+        return;
+    }
+
+    auto &TypeStats = Stats[It->second.MemType];
+    auto &ClassStats = TypeStats.Classes[It->second.SizeClass];
+    ClassStats.Live--;
+    ClassStats.PendingFrees++;
+    ClassStats.LastFreeTick = TypeStats.Tick;
+    SampledAllocs.erase(It);
+    SampledFilter[filterSlotOf(ptr)].fetch_sub(1, std::memory_order_relaxed);
+}
+
+void DisjointPoolTuner::retune(DisjointPoolMemType memType) {
+    auto &Base = BaseConfigs.Configs[memType];
+    auto &Config = Configs.Configs[memType];
+    auto &TypeStats = Stats[memType];
+
+    size_t Total = 0;
+    for (auto &ClassStats : TypeStats.Classes) {
+        Total += ClassStats.Allocs;
+    }
+
+    size_t MaxPoolableSize = Base.MaxPoolableSize;
+    size_t Capacity = Base.Capacity;
+    for (size_t Class = 0; Class < NumSizeClasses; Class++) {
+        auto &ClassStats = TypeStats.Classes[Class];
+        bool IsHot = ClassStats.Allocs * HotShareDivisor >= Total &&
+                     ClassStats.ReuseCount > 0 &&
+                     ClassStats.ReuseDistanceSum <=
+                         HotReuseDistance * ClassStats.ReuseCount;
+        if (!IsHot) {
+            continue;
+        }
+        MaxPoolableSize = (std::max)(MaxPoolableSize, size_t(1) << Class);
+        // Only one in SampleRate allocations is tracked, so scale the peak
+        // to estimate how many blocks of this class are live at once.
+        Capacity = (std::max)(Capacity, ClassStats.PeakLive * Params.SampleRate);
+    }
+
+    // Decay the histogram so that the next retune follows phase changes.
+    for (auto &ClassStats : TypeStats.Classes) {
+        ClassStats.Allocs /= 2;
+        ClassStats.PeakLive = ClassStats.Live;
+        ClassStats.ReuseDistanceSum /= 2;
+        ClassStats.ReuseCount /= 2;
+    }
+
+    // Pooling was disabled on purpose for this memory type.
+    if (Base.Capacity == 0) {
+        return;
+    }
+
+    MaxPoolableSize = (std::min)(
+        MaxPoolableSize,
+        (std::max)(Params.MaxPoolableSizeLimit, Base.MaxPoolableSize));
+    Capacity =
+        (std::min)(Capacity, (std::max)(Params.CapacityLimit, Base.Capacity));
+    // Keep the worst case of a full bucket of the largest poolable size
+    // within MaxPoolSize.
+    Capacity = (std::max)(
+        Base.Capacity,
+        (std::min)(Capacity, Configs.MaxPoolSize /
+                                 (std::max)(MaxPoolableSize, size_t(1))));
+
+    if (MaxPoolableSize == Config.MaxPoolableSize &&
+        Capacity == Config.Capacity) {
+        return;
+    }
+
+    Config.MaxPoolableSize = MaxPoolableSize;
+    Config.Capacity = Capacity;
+    RetuneCount.fetch_add(1, std::memory_order_release);
+
+    logger::info("USM pool tuner: retuned {} pool to MaxPoolableSize={}, "
+                 "Capacity={}, config string: \"{}\"",
+                 Config.Name ? Config.Name : "", Config.MaxPoolableSize,
+                 Config.Capacity, disjointPoolConfigToString(Configs));
+}
+
+DisjointPoolAllConfigs DisjointPoolTuner::getConfigs() const {
+    std::scoped_lock<std::mutex> Lock(Mutex);
+    return Configs;
+}
+
+void DisjointPoolTuner::applyTunedSettings(
+    DisjointPoolAllConfigs &configs) const {
+    std::scoped_lock<std::mutex> Lock(Mutex);
+    for (int i = 0; i < DisjointPoolMemType::All; i++) {
+        configs.Configs[i].MaxPoolableSize = Configs.Configs[i].MaxPoolableSize;
+        configs.Configs[i].Capacity = Configs.Configs[i].Capacity;
+    }
+}
+
+size_t DisjointPoolTuner::getRetuneCount() const {
+    // Checked on every allocation from a context pool, so don't lock.
+    return RetuneCount.load(std::memory_order_acquire);
+}
+
+} // namespace usm
@@ -0,0 +1,123 @@
+//===--- disjoint_pool_tuner.hpp - adaptive tuning of USM memory pools ----==//
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef USM_POOL_TUNER
+#define USM_POOL_TUNER
+
+#include "disjoint_pool_config_parser.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace usm {
+
+// Parameters of the adaptive mode, parsed from a string of this form:
+// [SampleRate][,[RetuneInterval][,[MaxPoolableSizeLimit][,CapacityLimit]]]
+//
+// SampleRate:           Track one in SampleRate allocations.
+//                       Default 16.
+// RetuneInterval:       Number of tracked allocations between retunes.
+//                       Default 1024.
+// MaxPoolableSizeLimit: Upper bound for a retuned MaxPoolableSize.
+//                       Default 64MB.
+// CapacityLimit:        Upper bound for a retuned Capacity.
+//                       Default 16.
+//
+// Example of usage:
+// "8,512,32M,8"
+struct DisjointPoolTunerParams {
+    size_t SampleRate = 16;
+    size_t RetuneInterval = 1024;
+    size_t MaxPoolableSizeLimit = 64 * 1024 * 1024;
+    size_t CapacityLimit = 16;
+};
+
+DisjointPoolTunerParams parseDisjointPoolTunerConfig(const std::string &config);
+
+// Formats configs as a string accepted by parseDisjointPoolConfig.
+std::string disjointPoolConfigToString(const DisjointPoolAllConfigs &configs);
+
+// Samples the live allocation-size histogram and the reuse distance of each
+// size class per memory type, and periodically derives new MaxPoolableSize and
+// Capacity settings from it. The settings given at construction are used as
+// the lower bound of the tuned ones and DisjointPoolTunerParams together with
+// MaxPoolSize bound them from above. Memory types with pooling disabled
+// (Capacity of 0) are left untouched.
+//
+// UMF pools copy their parameters on creation, so users of the tuner replace
+// their pools once getRetuneCount changes. Every change is logged as a config
+// string that can be reused through the allocator env variable.
+class DisjointPoolTuner {
+  public:
+    DisjointPoolTuner(const DisjointPoolAllConfigs &configs,
+                      const DisjointPoolTunerParams &params);
+
+    // Both are cheap for allocations which are not sampled.
+    void recordAlloc(DisjointPoolMemType memType, void *ptr, size_t size);
+    void recordFree(void *ptr);
+
+    DisjointPoolAllConfigs getConfigs() const;
+    // Copies the tuned MaxPoolableSize and Capacity of each memory type into
+    // configs, leaving its other settings and its limits alone.
+    void applyTunedSettings(DisjointPoolAllConfigs &configs) const;
+    // Number of retunes which changed the configuration.
+    size_t getRetuneCount() const;
+
+  private:
+    // Size class N holds allocations in the range (2^(N-1), 2^N].
+    static constexpr size_t NumSizeClasses = 64;
+
+    struct SizeClassStats {
+        size_t Allocs = 0;
+        size_t Live = 0;
+        size_t PeakLive = 0;
+        size_t PendingFrees = 0;
+        size_t LastFreeTick = 0;
+        size_t ReuseDistanceSum = 0;
+        size_t ReuseCount = 0;
+    };
+
+    struct MemTypeStats {
+        size_t Tick = 0;
+        size_t SinceRetune = 0;
+        std::array<SizeClassStats, NumSizeClasses> Classes;
+    };
+
+    struct SampledAlloc {
+        DisjointPoolMemType MemType;
+        size_t SizeClass;
+    };
+
+    static size_t filterSlotOf(void *ptr);
+    void retune(DisjointPoolMemType memType);
+
+    // Number of slots of SampledFilter.
+    static constexpr size_t FilterSize = 4096;
+
+    const DisjointPoolAllConfigs BaseConfigs;
+    const DisjointPoolTunerParams Params;
+
+    std::atomic<size_t> AllocCount{0};
+    // Number of sampled live allocations hashing to each slot, a zero lets
+    // recordFree skip the lock.
+    std::array<std::atomic<uint32_t>, FilterSize> SampledFilter{};
+
+    mutable std::mutex Mutex;
+    DisjointPoolAllConfigs Configs;
+    std::array<MemTypeStats, DisjointPoolMemType::All> Stats;
+    std::unordered_map<void *, SampledAlloc> SampledAllocs;
+    std::atomic<size_t> RetuneCount{0};
+};
+
+} // namespace usm
+
+#endif
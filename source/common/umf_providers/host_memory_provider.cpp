@@ -0,0 +1,271 @@
+//===--- host_memory_provider.cpp - huge page backed host memory ----------==//
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "host_memory_provider.hpp"
+#include "logger/ur_logger.hpp"
+#include "ur_util.hpp"
+
+#include <ur_api.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace usm {
+
+HostMemoryProviderParams
+parseHostMemoryProviderConfig(const std::string &config) {
+    HostMemoryProviderParams Params;
+
+    std::stringstream Stream(config);
+    std::string Param;
+    if (std::getline(Stream, Param, ',')) {
+        if (Param == "none") {
+            Params.PageMode = HostPageMode::None;
+        } else if (Param == "hugetlb") {
+            Params.PageMode = HostPageMode::HugeTLB;
+        } else if (Param == "thp") {
+            Params.PageMode = HostPageMode::Transparent;
+        } else if (!Param.empty()) {
+            logger::warning("Host memory provider: unknown page mode '{}'",
+                            Param);
+        }
+    }
+    if (std::getline(Stream, Param, ',') && !Param.empty()) {
+        if (auto Threshold = ur_parse_size(Param)) {
+            Params.HugePageThreshold = *Threshold;
+        } else {
+            logger::warning(
+                "Host memory provider: invalid huge page threshold '{}'",
+                Param);
+        }
+    }
+    if (std::getline(Stream, Param, ',') && !Param.empty()) {
+        auto Node = ur_parse_uint(Param);
+        if (Node && *Node < 1024) {
+            Params.NumaNode = static_cast<int>(*Node);
+        } else {
+            logger::warning("Host memory provider: invalid NUMA node '{}'",
+                            Param);
+        }
+    }
+    if (std::getline(Stream, Param, ',')) {
+        if (Param == "bind") {
+            Params.NumaPolicy = HostNumaPolicy::Bind;
+        } else if (Param == "preferred") {
+            Params.NumaPolicy = HostNumaPolicy::Preferred;
+        } else if (!Param.empty()) {
+            logger::warning("Host memory provider: unknown NUMA policy '{}'",
+                            Param);
+        }
+    }
+
+    return Params;
+}
+
+static size_t queryHugePageSize() {
+    std::ifstream Meminfo("/proc/meminfo");
+    std::string Line;
+    while (std::getline(Meminfo, Line)) {
+        // "Hugepagesize:       2048 kB"
+        if (Line.rfind("Hugepagesize:", 0) == 0) {
+            size_t KB = std::strtoull(Line.c_str() + 13, nullptr, 10);
+            if (KB) {
+                return KB * 1024;
+            }
+        }
+    }
+    return 2 * 1024 * 1024;
+}
+
+static ur_result_t &getLastStatusRef() {
+    static thread_local ur_result_t LastStatus = UR_RESULT_SUCCESS;
+    return LastStatus;
+}
+
+static size_t roundUp(size_t Size, size_t Alignment) {
+    return (Size + Alignment - 1) / Alignment * Alignment;
+}
+
+umf_result_t HostMemoryProvider::initialize(HostMemoryProviderParams params) {
+    Params = params;
+    BasePageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    HugePageSize = queryHugePageSize();
+    if (Params.HugePageThreshold == 0) {
+        Params.HugePageThreshold = HugePageSize;
+    }
+    return UMF_RESULT_SUCCESS;
+}
+
+void *HostMemoryProvider::mapAligned(size_t length, size_t align) {
+    size_t Extra = align > BasePageSize ? align - BasePageSize : 0;
+    void *Addr = mmap(nullptr, length + Extra, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Addr == MAP_FAILED) {
+        return nullptr;
+    }
+    if (Extra == 0) {
+        return Addr;
+    }
+
+    // Trim the parts of the mapping before and after the aligned range.
+    auto Start = reinterpret_cast<uintptr_t>(Addr);
+    auto Aligned = roundUp(Start, align);
+    if (Aligned != Start) {
+        munmap(Addr, Aligned - Start);
+    }
+    size_t Tail = Start + length + Extra - (Aligned + length);
+    if (Tail) {
+        munmap(reinterpret_cast<void *>(Aligned + length), Tail);
+    }
+    return reinterpret_cast<void *>(Aligned);
+}
+
+bool HostMemoryProvider::bindToNode(void *addr, size_t length) {
+    constexpr size_t BitsPerLong = sizeof(unsigned long) * 8;
+    size_t Node = static_cast<size_t>(Params.NumaNode);
+    std::vector<unsigned long> Mask(Node / BitsPerLong + 1);
+    Mask[Node / BitsPerLong] = 1ul << (Node % BitsPerLong);
+
+    int Mode = Params.NumaPolicy == HostNumaPolicy::Bind ? MPOL_BIND
+                                                         : MPOL_PREFERRED;
+    // The memory is not touched yet, so the policy applies to all its pages.
+    // The libc wrapper lives in libnuma, call the kernel directly instead.
+    return syscall(SYS_mbind, addr, length, Mode, Mask.data(),
+                   Mask.size() * BitsPerLong, 0) == 0;
+}
+
+umf_result_t HostMemoryProvider::alloc(size_t size, size_t align, void **ptr) {
+    if (!ptr) {
+        return UMF_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (align & (align - 1)) {
+        return UMF_RESULT_ERROR_INVALID_ALIGNMENT;
+    }
+
+    bool Huge = Params.PageMode != HostPageMode::None &&
+                size >= Params.HugePageThreshold;
+    size_t PageSize = Huge ? HugePageSize : BasePageSize;
+    size_t Length = roundUp((std::max)(size, size_t(1)), PageSize);
+
+    void *Addr = nullptr;
+    bool HugeTLB = false;
+    if (Huge && Params.PageMode == HostPageMode::HugeTLB &&
+        align <= HugePageSize) {
+        Addr = mmap(nullptr, Length, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        // The huge page pool is sized by the administrator and may be
+        // empty, use transparent huge pages instead.
+        HugeTLB = Addr != MAP_FAILED;
+        Addr = HugeTLB ? Addr : nullptr;
+    }
+    if (!Addr) {
+        // Transparent huge pages are only used for aligned ranges.
+        Addr = mapAligned(Length, (std::max)(align, PageSize));
+        if (!Addr) {
+            getLastStatusRef() = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+            return UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        if (Huge) {
+            // Only a hint, the kernel may have THP disabled.
+            madvise(Addr, Length, MADV_HUGEPAGE);
+        }
+    }
+
+    if (Params.NumaNode >= 0 && !bindToNode(Addr, Length) &&
+        Params.NumaPolicy == HostNumaPolicy::Bind) {
+        munmap(Addr, Length);
+        getLastStatusRef() = UR_RESULT_ERROR_OUT_OF_RESOURCES;
+        return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+    }
+
+    {
+        std::scoped_lock<std::mutex> Lock(Mutex);
+        Mappings[Addr] = Mapping{Length, HugeTLB};
+    }
+    *ptr = Addr;
+    return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t HostMemoryProvider::free(void *ptr, size_t size) {
+    (void)size;
+
+    Mapping Freed;
+    {
+        std::scoped_lock<std::mutex> Lock(Mutex);
+        auto It = Mappings.find(ptr);
+        if (It == Mappings.end()) {
+            return UMF_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        Freed = It->second;
+        Mappings.erase(It);
+    }
+
+    if (munmap(ptr, Freed.Length) != 0) {
+        getLastStatusRef() = UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+    }
+    return UMF_RESULT_SUCCESS;
+}
+
+void HostMemoryProvider::get_last_native_error(const char **errMsg,
+                                               int32_t *errCode) {
+    (void)errMsg;
+    *errCode = static_cast<int32_t>(getLastStatusRef());
+}
+
+umf_result_t HostMemoryProvider::get_recommended_page_size(size_t size,
+                                                           size_t *pageSize) {
+    bool Huge = Params.PageMode != HostPageMode::None &&
+                size >= Params.HugePageThreshold;
+    *pageSize = Huge ? HugePageSize : BasePageSize;
+    return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t HostMemoryProvider::get_min_page_size(void *ptr,
+                                                   size_t *pageSize) {
+    *pageSize = BasePageSize;
+    if (ptr) {
+        std::scoped_lock<std::mutex> Lock(Mutex);
+        auto It = Mappings.find(ptr);
+        if (It != Mappings.end() && It->second.HugeTLB) {
+            *pageSize = HugePageSize;
+        }
+    }
+    return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t HostMemoryProvider::purge_lazy(void *ptr, size_t size) {
+#ifdef MADV_FREE
+    if (madvise(ptr, size, MADV_FREE) == 0) {
+        return UMF_RESULT_SUCCESS;
+    }
+    getLastStatusRef() = UR_RESULT_ERROR_INVALID_ARGUMENT;
+    return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+#else
+    (void)ptr;
+    (void)size;
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+umf_result_t HostMemoryProvider::purge_force(void *ptr, size_t size) {
+    if (madvise(ptr, size, MADV_DONTNEED) == 0) {
+        return UMF_RESULT_SUCCESS;
+    }
+    getLastStatusRef() = UR_RESULT_ERROR_INVALID_ARGUMENT;
+    return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+}
+
+} // namespace usm
@@ -0,0 +1,97 @@
+//===--- host_memory_provider.hpp - huge page backed host memory ----------==//
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef USM_HOST_MEMORY_PROVIDER
+#define USM_HOST_MEMORY_PROVIDER
+
+#include <umf/memory_provider.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace usm {
+
+enum class HostPageMode {
+    // Base pages only.
+    None,
+    // madvise(MADV_HUGEPAGE) on large mappings.
+    Transparent,
+    // MAP_HUGETLB on large mappings, transparent huge pages when the huge
+    // page pool is exhausted.
+    HugeTLB,
+};
+
+enum class HostNumaPolicy { Preferred, Bind };
+
+// Parameters of the host memory provider, parsed from a string of this form:
+// [PageMode][,[HugePageThreshold][,[NumaNode][,NumaPolicy]]]
+//
+// PageMode:          none|thp|hugetlb
+//                    Default none, huge pages are opt-in as they round
+//                    the slabs of a pool on top up to the threshold.
+// HugePageThreshold: Mappings of at least this size use huge pages.
+//                    Default 2MB.
+// NumaNode:          Node the memory is placed on with mbind.
+//                    Default none, the policy of the thread touching it.
+// NumaPolicy:        preferred|bind, whether allocations fall back to
+//                    other nodes when the node is full.
+//                    Default preferred.
+//
+// Example of usage:
+// "hugetlb,4M,1,bind"
+struct HostMemoryProviderParams {
+    HostPageMode PageMode = HostPageMode::None;
+    size_t HugePageThreshold = 2 * 1024 * 1024;
+    int NumaNode = -1;
+    HostNumaPolicy NumaPolicy = HostNumaPolicy::Preferred;
+};
+
+HostMemoryProviderParams
+parseHostMemoryProviderConfig(const std::string &config);
+
+// UMF memory provider mapping host memory directly with mmap. Large
+// allocations, including the slabs of a disjoint pool on top of it, are
+// aligned to and backed by huge pages, which cuts the TLB misses of kernels
+// streaming through large buffers. Only available on Linux.
+class HostMemoryProvider {
+  public:
+    umf_result_t initialize(HostMemoryProviderParams params);
+    umf_result_t alloc(size_t size, size_t align, void **ptr);
+    umf_result_t free(void *ptr, size_t size);
+    void get_last_native_error(const char **errMsg, int32_t *errCode);
+    umf_result_t get_recommended_page_size(size_t size, size_t *pageSize);
+    umf_result_t get_min_page_size(void *ptr, size_t *pageSize);
+    umf_result_t purge_lazy(void *ptr, size_t size);
+    umf_result_t purge_force(void *ptr, size_t size);
+    const char *get_name() { return "HostMemoryProvider"; }
+
+    size_t getHugePageSize() const { return HugePageSize; }
+
+  private:
+    struct Mapping {
+        size_t Length;
+        bool HugeTLB;
+    };
+
+    void *mapAligned(size_t length, size_t align);
+    bool bindToNode(void *addr, size_t length);
+
+    HostMemoryProviderParams Params;
+    size_t BasePageSize = 0;
+    size_t HugePageSize = 0;
+
+    // Lengths of the mappings, UMF does not always pass the size to free.
+    std::mutex Mutex;
+    std::unordered_map<void *, Mapping> Mappings;
+};
+
+} // namespace usm
+
+#endif
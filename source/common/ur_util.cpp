@@ -10,6 +10,10 @@
 
 #include "ur_util.hpp"
 
+#include <cctype>
+#include <charconv>
+#include <limits>
+
 #ifdef _WIN32
 #include <windows.h>
 int ur_getpid(void) { return static_cast<int>(GetCurrentProcessId()); }
@@ -42,3 +46,42 @@ std::optional<std::string> ur_getenv(const char *name) {
     }
 #endif
 }
+
+std::optional<uint64_t> ur_parse_uint(const std::string &str) {
+    uint64_t value = 0;
+    const char *end = str.data() + str.size();
+    auto [ptr, ec] = std::from_chars(str.data(), end, value);
+    if (ec != std::errc() || ptr != end || str.empty()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+std::optional<size_t> ur_parse_size(const std::string &str) {
+    if (str.empty()) {
+        return std::nullopt;
+    }
+
+    size_t multiplier = 1;
+    switch (std::tolower(static_cast<unsigned char>(str.back()))) {
+    case 'k':
+        multiplier = size_t(1) << 10;
+        break;
+    case 'm':
+        multiplier = size_t(1) << 20;
+        break;
+    case 'g':
+        multiplier = size_t(1) << 30;
+        break;
+    default:
+        break;
+    }
+
+    auto number =
+        ur_parse_uint(multiplier == 1 ? str : str.substr(0, str.size() - 1));
+    if (!number ||
+        *number > (std::numeric_limits<size_t>::max)() / multiplier) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(*number) * multiplier;
+}
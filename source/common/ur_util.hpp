@@ -249,6 +249,15 @@ inline std::size_t combine_hashes(std::size_t seed, const T &v, Args... args) {
     return combine_hashes(seed ^ std::hash<T>{}(v), args...);
 }
 
+/// @brief Parses a non-negative decimal integer, the whole string must be
+///        the number. Returns std::nullopt for malformed or overflowing values.
+std::optional<uint64_t> ur_parse_uint(const std::string &str);
+
+/// @brief Parses a size in bytes with an optional, case insensitive K, M or G
+///        suffix, e.g. "64K". Returns std::nullopt for malformed values and
+///        sizes not fitting in size_t.
+std::optional<size_t> ur_parse_size(const std::string &str);
+
 inline ur_result_t exceptionToResult(std::exception_ptr eptr) {
     try {
         if (eptr) {
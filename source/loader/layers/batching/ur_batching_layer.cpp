@@ -0,0 +1,769 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_batching_layer.cpp
+ *
+ */
+
+#include "ur_batching_layer.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace ur_batching_layer {
+context_t context;
+
+constexpr size_t DEFAULT_MAX_COMMANDS = 64;
+constexpr uint64_t DEFAULT_MAX_DELAY_US = 1000;
+
+static uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static std::chrono::steady_clock::time_point timePoint(uint64_t ns) {
+    return std::chrono::steady_clock::time_point(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::nanoseconds(ns)));
+}
+
+template <typename T>
+static std::vector<T> copyArray(const T *pArray, size_t count) {
+    return pArray ? std::vector<T>(pArray, pArray + count) : std::vector<T>();
+}
+
+template <typename T> static const T *dataOrNull(const std::vector<T> &array) {
+    return array.empty() ? nullptr : array.data();
+}
+
+static std::vector<uint8_t> copyPattern(const void *pPattern,
+                                        size_t patternSize) {
+    auto pBytes = static_cast<const uint8_t *>(pPattern);
+    return std::vector<uint8_t>(pBytes, pBytes + patternSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sync point wait list of a command appended to a command buffer.
+///
+/// In-order queues chain the commands of the command buffer, commands of out
+/// of order queues may run concurrently, as they would without batching.
+struct sync_point_wait_t {
+    uint32_t count;
+    ur_exp_command_buffer_sync_point_t syncPoint;
+
+    explicit sync_point_wait_t(const batch_t &batch)
+        : count(batch.inOrder && batch.size ? 1 : 0),
+          syncPoint(batch.lastSyncPoint) {}
+
+    const ur_exp_command_buffer_sync_point_t *list() const {
+        return count ? &syncPoint : nullptr;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::context_t()
+    : logger(logger::create_logger("batching")),
+      maxCommands(DEFAULT_MAX_COMMANDS),
+      maxDelayNs(DEFAULT_MAX_DELAY_US * 1000) {
+    try {
+        auto config = getenv_to_map("UR_BATCHING");
+        if (config.has_value()) {
+            auto kv = config->find("max_commands");
+            if (kv != config->end()) {
+                maxCommands = std::max<size_t>(
+                    std::stoull(kv->second.front()), 1);
+            }
+            kv = config->find("max_delay_us");
+            if (kv != config->end()) {
+                maxDelayNs = std::stoull(kv->second.front()) * 1000;
+            }
+            kv = config->find("mode");
+            if (kv != config->end()) {
+                auto &mode = kv->second.front();
+                if (mode == "replay") {
+                    allowCommandBuffers = false;
+                } else if (mode != "auto") {
+                    throw std::invalid_argument("unknown mode " + mode);
+                }
+            }
+        }
+    } catch (std::exception &e) {
+        logger.error("Invalid UR_BATCHING value: {}", e.what());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::~context_t() { stopFlusher(); }
+
+void context_t::addQueue(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_queue_properties_t *pProperties,
+                         ur_queue_handle_t hQueue) {
+    if (!pProperties ||
+        !(pProperties->flags & UR_QUEUE_FLAG_SUBMISSION_BATCHED)) {
+        return;
+    }
+
+    auto batch = std::make_shared<batch_t>();
+    batch->hContext = hContext;
+    batch->hDevice = hDevice;
+    batch->inOrder =
+        !(pProperties->flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+
+    ur_bool_t commandBufferSupport = false;
+    if (allowCommandBuffers &&
+        urDdiTable.Device.pfnGetInfo(
+            hDevice, UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP,
+            sizeof(commandBufferSupport), &commandBufferSupport,
+            nullptr) == UR_RESULT_SUCCESS) {
+        batch->useCommandBuffer = commandBufferSupport;
+    }
+
+    logger.debug("Batching commands of queue {} {}",
+                 static_cast<void *>(hQueue),
+                 batch->useCommandBuffer ? "in command buffers" : "for replay");
+
+    {
+        std::scoped_lock<std::shared_mutex> lock(queuesMutex);
+        queues[hQueue] = std::move(batch);
+    }
+    startFlusher();
+}
+
+ur_result_t context_t::removeQueue(ur_queue_handle_t hQueue) {
+    auto batch = getBatch(hQueue);
+    if (!batch) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    uint32_t refCount = 0;
+    if (urDdiTable.Queue.pfnGetInfo(hQueue, UR_QUEUE_INFO_REFERENCE_COUNT,
+                                    sizeof(refCount), &refCount,
+                                    nullptr) != UR_RESULT_SUCCESS) {
+        refCount = 1;
+    }
+
+    std::scoped_lock<std::mutex> lock(batch->mutex);
+    ur_result_t result = flushLocked(hQueue, *batch, "urQueueRelease");
+    if (refCount > 1) {
+        return result;
+    }
+
+    releaseBatch(hQueue, *batch);
+
+    std::scoped_lock<std::shared_mutex> queuesLock(queuesMutex);
+    queues.erase(hQueue);
+    return result;
+}
+
+bool context_t::isBatched(ur_queue_handle_t hQueue) {
+    std::shared_lock<std::shared_mutex> lock(queuesMutex);
+    return queues.count(hQueue) != 0;
+}
+
+std::shared_ptr<batch_t> context_t::getBatch(ur_queue_handle_t hQueue) {
+    std::shared_lock<std::shared_mutex> lock(queuesMutex);
+    auto it = queues.find(hQueue);
+    return it == queues.end() ? nullptr : it->second;
+}
+
+ur_result_t context_t::flush(ur_queue_handle_t hQueue, const char *reason) {
+    auto batch = getBatch(hQueue);
+    if (!batch) {
+        return UR_RESULT_SUCCESS;
+    }
+    std::scoped_lock<std::mutex> lock(batch->mutex);
+    return flushLocked(hQueue, *batch, reason);
+}
+
+ur_result_t context_t::flushAll(const char *reason) {
+    return flushMatching([](const batch_t &) { return true; }, reason);
+}
+
+ur_result_t context_t::flushEvents(uint32_t numEvents,
+                                   const ur_event_handle_t *phEvents,
+                                   const char *reason) {
+    std::vector<ur_queue_handle_t> flushed;
+    ur_result_t result = UR_RESULT_SUCCESS;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        ur_queue_handle_t hQueue = nullptr;
+        if (urDdiTable.Event.pfnGetInfo(phEvents[i],
+                                        UR_EVENT_INFO_COMMAND_QUEUE,
+                                        sizeof(hQueue), &hQueue,
+                                        nullptr) != UR_RESULT_SUCCESS ||
+            !hQueue ||
+            std::find(flushed.begin(), flushed.end(), hQueue) !=
+                flushed.end()) {
+            continue;
+        }
+        flushed.push_back(hQueue);
+        ur_result_t flushResult = flush(hQueue, reason);
+        if (result == UR_RESULT_SUCCESS) {
+            result = flushResult;
+        }
+    }
+    return result;
+}
+
+ur_result_t context_t::flushPointer(ur_context_handle_t hContext,
+                                    const void *pMem, const char *reason) {
+    // Without the size of the allocation any recorded pointer may be in it.
+    size_t size = 0;
+    if (urDdiTable.USM.pfnGetMemAllocInfo(
+            hContext, pMem, UR_USM_ALLOC_INFO_SIZE, sizeof(size), &size,
+            nullptr) != UR_RESULT_SUCCESS) {
+        size = 0;
+    }
+    auto begin = reinterpret_cast<uintptr_t>(pMem);
+
+    return flushMatching(
+        [&](const batch_t &batch) {
+            if (batch.hContext != hContext) {
+                return false;
+            }
+            if (batch.launches) {
+                return true;
+            }
+            return std::any_of(batch.pointers.begin(), batch.pointers.end(),
+                               [&](const void *pointer) {
+                                   auto address =
+                                       reinterpret_cast<uintptr_t>(pointer);
+                                   return size == 0 || (address >= begin &&
+                                                        address - begin < size);
+                               });
+        },
+        reason);
+}
+
+ur_result_t context_t::flushKernel(ur_kernel_handle_t hKernel,
+                                   const char *reason) {
+    if (pendingLaunches.load(std::memory_order_relaxed) == 0) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    return flushMatching(
+        [&](const batch_t &batch) {
+            return std::any_of(batch.commands.begin(), batch.commands.end(),
+                               [&](const command_t &command) {
+                                   return command.hKernel == hKernel;
+                               });
+        },
+        reason);
+}
+
+ur_result_t context_t::flushMatching(
+    const std::function<bool(const batch_t &)> &matches, const char *reason) {
+    std::vector<std::pair<ur_queue_handle_t, std::shared_ptr<batch_t>>>
+        batches;
+    {
+        std::shared_lock<std::shared_mutex> lock(queuesMutex);
+        batches.assign(queues.begin(), queues.end());
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+    for (auto &[hQueue, batch] : batches) {
+        std::scoped_lock<std::mutex> lock(batch->mutex);
+        if (!matches(*batch)) {
+            continue;
+        }
+        ur_result_t flushResult = flushLocked(hQueue, *batch, reason);
+        if (result == UR_RESULT_SUCCESS) {
+            result = flushResult;
+        }
+    }
+    return result;
+}
+
+void context_t::finished(ur_queue_handle_t hQueue) {
+    auto batch = getBatch(hQueue);
+    if (!batch) {
+        return;
+    }
+    std::scoped_lock<std::mutex> lock(batch->mutex);
+    // Commands recorded by other threads since the finish started may still
+    // be waiting in the batch, but everything submitted has completed.
+    releaseCompleted(*batch, true);
+}
+
+ur_result_t context_t::beginCommand(ur_queue_handle_t hQueue, batch_t &batch,
+                                    uint32_t numEventsInWaitList,
+                                    const ur_event_handle_t *phEventWaitList) {
+    if (numEventsInWaitList > 0) {
+        ur_result_t result = flushLocked(hQueue, batch, "wait list");
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+        for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+            urDdiTable.Event.pfnRetain(phEventWaitList[i]);
+            batch.waitList.push_back(phEventWaitList[i]);
+        }
+    }
+
+    if (batch.size == 0) {
+        batch.startNs = now();
+    }
+
+    if (batch.useCommandBuffer && !batch.hCommandBuffer) {
+        releaseCompleted(batch, false);
+        ur_exp_command_buffer_desc_t desc = {
+            UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_DESC, nullptr, false};
+        return urDdiTable.CommandBufferExp.pfnCreateExp(
+            batch.hContext, batch.hDevice, &desc, &batch.hCommandBuffer);
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t context_t::endCommand(ur_queue_handle_t hQueue, batch_t &batch) {
+    batch.size++;
+    if (batch.size >= maxCommands) {
+        return flushLocked(hQueue, batch, "max_commands");
+    }
+    if (now() - batch.startNs >= maxDelayNs) {
+        return flushLocked(hQueue, batch, "max_delay_us");
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t context_t::flushLocked(ur_queue_handle_t hQueue, batch_t &batch,
+                                   const char *reason) {
+    if (batch.size == 0) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    logger.debug("Flushing {} commands of queue {} {}, {}", batch.size,
+                 static_cast<void *>(hQueue),
+                 batch.useCommandBuffer ? "as a command buffer" : "by replay",
+                 reason);
+    flushedBatches.fetch_add(1, std::memory_order_relaxed);
+    flushedCommands.fetch_add(batch.size, std::memory_order_relaxed);
+
+    ur_result_t result = batch.useCommandBuffer
+                             ? submitCommandBuffer(hQueue, batch)
+                             : replay(batch);
+    if (result != UR_RESULT_SUCCESS) {
+        logger.error("Flushing commands of queue {} failed: {}",
+                     static_cast<void *>(hQueue), result);
+    }
+
+    for (auto hEvent : batch.waitList) {
+        urDdiTable.Event.pfnRelease(hEvent);
+    }
+    batch.waitList.clear();
+    batch.pointers.clear();
+    batch.launches = 0;
+    batch.size = 0;
+    return result;
+}
+
+ur_result_t context_t::submitCommandBuffer(ur_queue_handle_t hQueue,
+                                           batch_t &batch) {
+    auto &commandBufferExp = urDdiTable.CommandBufferExp;
+    auto hCommandBuffer = batch.hCommandBuffer;
+    batch.hCommandBuffer = nullptr;
+
+    ur_event_handle_t hEvent = nullptr;
+    ur_result_t result = commandBufferExp.pfnFinalizeExp(hCommandBuffer);
+    if (result == UR_RESULT_SUCCESS) {
+        result = commandBufferExp.pfnEnqueueExp(
+            hCommandBuffer, hQueue, static_cast<uint32_t>(batch.waitList.size()),
+            dataOrNull(batch.waitList), &hEvent);
+    }
+    if (result != UR_RESULT_SUCCESS) {
+        commandBufferExp.pfnReleaseExp(hCommandBuffer);
+        return result;
+    }
+    batch.submitted.emplace_back(hCommandBuffer, hEvent);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t context_t::replay(batch_t &batch) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+    for (size_t i = 0; i < batch.commands.size(); i++) {
+        auto &command = batch.commands[i];
+        // The remaining commands are dropped after a failure, like the
+        // adapter would have rejected them at enqueue time.
+        if (result == UR_RESULT_SUCCESS) {
+            result = i == 0 ? command.submit(
+                                  static_cast<uint32_t>(batch.waitList.size()),
+                                  dataOrNull(batch.waitList))
+                            : command.submit(0, nullptr);
+        }
+        if (command.hKernel) {
+            urDdiTable.Kernel.pfnRelease(command.hKernel);
+            pendingLaunches.fetch_sub(1, std::memory_order_relaxed);
+        }
+        for (auto hMem : command.mems) {
+            urDdiTable.Mem.pfnRelease(hMem);
+        }
+    }
+    batch.commands.clear();
+    return result;
+}
+
+void context_t::releaseCompleted(batch_t &batch, bool all) {
+    auto completed = [&](ur_event_handle_t hEvent) {
+        ur_event_status_t status = UR_EVENT_STATUS_QUEUED;
+        return !hEvent ||
+               (urDdiTable.Event.pfnGetInfo(
+                    hEvent, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                    sizeof(status), &status, nullptr) == UR_RESULT_SUCCESS &&
+                status == UR_EVENT_STATUS_COMPLETE);
+    };
+
+    auto &submitted = batch.submitted;
+    auto it = std::remove_if(
+        submitted.begin(), submitted.end(), [&](const auto &commandBuffer) {
+            auto [hCommandBuffer, hEvent] = commandBuffer;
+            if (!all && !completed(hEvent)) {
+                return false;
+            }
+            urDdiTable.CommandBufferExp.pfnReleaseExp(hCommandBuffer);
+            if (hEvent) {
+                urDdiTable.Event.pfnRelease(hEvent);
+            }
+            return true;
+        });
+    submitted.erase(it, submitted.end());
+}
+
+void context_t::releaseBatch(ur_queue_handle_t hQueue, batch_t &batch) {
+    // The command buffers may only be released once they completed.
+    if (!batch.submitted.empty()) {
+        urDdiTable.Queue.pfnFinish(hQueue);
+    }
+    releaseCompleted(batch, true);
+
+    // Left behind by a command which failed to be recorded, flushing an
+    // empty batch doesn't release them.
+    for (auto hEvent : batch.waitList) {
+        urDdiTable.Event.pfnRelease(hEvent);
+    }
+    batch.waitList.clear();
+    if (batch.hCommandBuffer) {
+        urDdiTable.CommandBufferExp.pfnReleaseExp(batch.hCommandBuffer);
+        batch.hCommandBuffer = nullptr;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::startFlusher() {
+    // Without a delay every command flushes its batch right away.
+    if (maxDelayNs == 0) {
+        return;
+    }
+    std::scoped_lock<std::mutex> lock(flusherMutex);
+    if (!flusher.joinable()) {
+        flusherStopping = false;
+        flusher = std::thread([this] { runFlusher(); });
+    }
+}
+
+void context_t::stopFlusher() {
+    {
+        std::scoped_lock<std::mutex> lock(flusherMutex);
+        if (!flusher.joinable()) {
+            return;
+        }
+        flusherStopping = true;
+    }
+    flusherCv.notify_one();
+    flusher.join();
+}
+
+void context_t::runFlusher() {
+    std::unique_lock<std::mutex> lock(flusherMutex);
+    while (!flusherStopping) {
+        lock.unlock();
+        uint64_t deadline = flushExpired();
+        lock.lock();
+        // Batches started after the scan expire after the deadline, so
+        // waking up at the deadline is early enough for them too.
+        flusherCv.wait_until(lock, timePoint(deadline),
+                             [this] { return flusherStopping; });
+    }
+}
+
+uint64_t context_t::flushExpired() {
+    uint64_t deadline = now() + maxDelayNs;
+    // Failures are logged by flushLocked, there is no application call to
+    // return them from.
+    flushMatching(
+        [&](const batch_t &batch) {
+            if (batch.size == 0) {
+                return false;
+            }
+            uint64_t expiry = batch.startNs + maxDelayNs;
+            if (now() < expiry) {
+                deadline = std::min(deadline, expiry);
+                return false;
+            }
+            return true;
+        },
+        "max_delay_us");
+    return deadline;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ur_result_t context_t::recordKernelLaunch(
+    ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList) {
+    auto batch = getBatch(hQueue);
+    if (!batch) {
+        return urDdiTable.Enqueue.pfnKernelLaunch(
+            hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+            pLocalWorkSize, numEventsInWaitList, phEventWaitList, nullptr);
+    }
+
+    std::scoped_lock<std::mutex> lock(batch->mutex);
+    ur_result_t result =
+        beginCommand(hQueue, *batch, numEventsInWaitList, phEventWaitList);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    batch->launches++;
+    if (batch->useCommandBuffer) {
+        sync_point_wait_t wait(*batch);
+        result = urDdiTable.CommandBufferExp.pfnAppendKernelLaunchExp(
+            batch->hCommandBuffer, hKernel, workDim, pGlobalWorkOffset,
+            pGlobalWorkSize, pLocalWorkSize, wait.count, wait.list(),
+            &batch->lastSyncPoint, nullptr);
+    } else {
+        // The kernel arguments are read at submission, flushKernel submits
+        // the launch before they are changed.
+        urDdiTable.Kernel.pfnRetain(hKernel);
+        pendingLaunches.fetch_add(1, std::memory_order_relaxed);
+
+        command_t command;
+        command.hKernel = hKernel;
+        command.submit =
+            [hQueue, hKernel, workDim,
+             offset = copyArray(pGlobalWorkOffset, workDim),
+             globalSize = copyArray(pGlobalWorkSize, workDim),
+             localSize = copyArray(pLocalWorkSize, workDim)](
+                uint32_t numEvents, const ur_event_handle_t *phEvents) {
+                return context.urDdiTable.Enqueue.pfnKernelLaunch(
+                    hQueue, hKernel, workDim, dataOrNull(offset),
+                    dataOrNull(globalSize), dataOrNull(localSize), numEvents,
+                    phEvents, nullptr);
+            };
+        batch->commands.push_back(std::move(command));
+    }
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    return endCommand(hQueue, *batch);
+}
+
+ur_result_t context_t::recordMemBufferCopy(
+    ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
+    ur_mem_handle_t hBufferDst, size_t srcOffset, size_t dstOffset, size_t size,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList) {
+    auto batch = getBatch(hQueue);
+    if (!batch) {
+        return urDdiTable.Enqueue.pfnMemBufferCopy(
+            hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset, size,
+            numEventsInWaitList, phEventWaitList, nullptr);
+    }
+
+    std::scoped_lock<std::mutex> lock(batch->mutex);
+    ur_result_t result =
+        beginCommand(hQueue, *batch, numEventsInWaitList, phEventWaitList);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    if (batch->useCommandBuffer) {
+        sync_point_wait_t wait(*batch);
+        result = urDdiTable.CommandBufferExp.pfnAppendMemBufferCopyExp(
+            batch->hCommandBuffer, hBufferSrc, hBufferDst, srcOffset,
+            dstOffset, size, wait.count, wait.list(), &batch->lastSyncPoint);
+    } else {
+        urDdiTable.Mem.pfnRetain(hBufferSrc);
+        urDdiTable.Mem.pfnRetain(hBufferDst);
+
+        command_t command;
+        command.mems = {hBufferSrc, hBufferDst};
+        command.submit = [=](uint32_t numEvents,
+                             const ur_event_handle_t *phEvents) {
+            return context.urDdiTable.Enqueue.pfnMemBufferCopy(
+                hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset, size,
+                numEvents, phEvents, nullptr);
+        };
+        batch->commands.push_back(std::move(command));
+    }
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    return endCommand(hQueue, *batch);
+}
+
+ur_result_t context_t::recordMemBufferFill(
+    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, const void *pPattern,
+    size_t patternSize, size_t offset, size_t size,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList) {
+    auto batch = getBatch(hQueue);
+    if (!batch) {
+        return urDdiTable.Enqueue.pfnMemBufferFill(
+            hQueue, hBuffer, pPattern, patternSize, offset, size,
+            numEventsInWaitList, phEventWaitList, nullptr);
+    }
+
+    std::scoped_lock<std::mutex> lock(batch->mutex);
+    ur_result_t result =
+        beginCommand(hQueue, *batch, numEventsInWaitList, phEventWaitList);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    if (batch->useCommandBuffer) {
+        sync_point_wait_t wait(*batch);
+        result = urDdiTable.CommandBufferExp.pfnAppendMemBufferFillExp(
+            batch->hCommandBuffer, hBuffer, pPattern, patternSize, offset,
+            size, wait.count, wait.list(), &batch->lastSyncPoint);
+    } else {
+        urDdiTable.Mem.pfnRetain(hBuffer);
+
+        command_t command;
+        command.mems = {hBuffer};
+        command.submit = [hQueue, hBuffer, offset, size,
+                          pattern = copyPattern(pPattern, patternSize)](
+                             uint32_t numEvents,
+                             const ur_event_handle_t *phEvents) {
+            return context.urDdiTable.Enqueue.pfnMemBufferFill(
+                hQueue, hBuffer, pattern.data(), pattern.size(), offset, size,
+                numEvents, phEvents, nullptr);
+        };
+        batch->commands.push_back(std::move(command));
+    }
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    return endCommand(hQueue, *batch);
+}
+
+ur_result_t context_t::recordUSMFill(ur_queue_handle_t hQueue, void *pMem,
+                                     size_t patternSize, const void *pPattern,
+                                     size_t size, uint32_t numEventsInWaitList,
+                                     const ur_event_handle_t *phEventWaitList) {
+    auto batch = getBatch(hQueue);
+    if (!batch) {
+        return urDdiTable.Enqueue.pfnUSMFill(hQueue, pMem, patternSize,
+                                             pPattern, size,
+                                             numEventsInWaitList,
+                                             phEventWaitList, nullptr);
+    }
+
+    std::scoped_lock<std::mutex> lock(batch->mutex);
+    ur_result_t result =
+        beginCommand(hQueue, *batch, numEventsInWaitList, phEventWaitList);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    batch->pointers.push_back(pMem);
+    if (batch->useCommandBuffer) {
+        sync_point_wait_t wait(*batch);
+        result = urDdiTable.CommandBufferExp.pfnAppendUSMFillExp(
+            batch->hCommandBuffer, pMem, pPattern, patternSize, size,
+            wait.count, wait.list(), &batch->lastSyncPoint);
+    } else {
+        command_t command;
+        command.submit = [hQueue, pMem, size,
+                          pattern = copyPattern(pPattern, patternSize)](
+                             uint32_t numEvents,
+                             const ur_event_handle_t *phEvents) {
+            return context.urDdiTable.Enqueue.pfnUSMFill(
+                hQueue, pMem, pattern.size(), pattern.data(), size, numEvents,
+                phEvents, nullptr);
+        };
+        batch->commands.push_back(std::move(command));
+    }
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    return endCommand(hQueue, *batch);
+}
+
+ur_result_t context_t::recordUSMMemcpy(
+    ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
+    size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList) {
+    auto batch = getBatch(hQueue);
+    if (!batch || blocking) {
+        ur_result_t result = flush(hQueue, "urEnqueueUSMMemcpy");
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+        return urDdiTable.Enqueue.pfnUSMMemcpy(hQueue, blocking, pDst, pSrc,
+                                               size, numEventsInWaitList,
+                                               phEventWaitList, nullptr);
+    }
+
+    std::scoped_lock<std::mutex> lock(batch->mutex);
+    ur_result_t result =
+        beginCommand(hQueue, *batch, numEventsInWaitList, phEventWaitList);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    batch->pointers.push_back(pDst);
+    batch->pointers.push_back(pSrc);
+    if (batch->useCommandBuffer) {
+        sync_point_wait_t wait(*batch);
+        result = urDdiTable.CommandBufferExp.pfnAppendUSMMemcpyExp(
+            batch->hCommandBuffer, pDst, pSrc, size, wait.count, wait.list(),
+            &batch->lastSyncPoint);
+    } else {
+        command_t command;
+        command.submit = [=](uint32_t numEvents,
+                             const ur_event_handle_t *phEvents) {
+            return context.urDdiTable.Enqueue.pfnUSMMemcpy(
+                hQueue, false, pDst, pSrc, size, numEvents, phEvents, nullptr);
+        };
+        batch->commands.push_back(std::move(command));
+    }
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    return endCommand(hQueue, *batch);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ur_result_t context_t::tearDown() {
+    if (!enabled) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    stopFlusher();
+    flushAll("urLoaderTearDown");
+    logger.info("Submitted {} commands in {} batches",
+                flushedCommands.load(std::memory_order_relaxed),
+                flushedBatches.load(std::memory_order_relaxed));
+
+    {
+        // Queues the application didn't release still hold their command
+        // buffers and events.
+        std::scoped_lock<std::shared_mutex> lock(queuesMutex);
+        for (auto &[hQueue, batch] : queues) {
+            std::scoped_lock<std::mutex> batchLock(batch->mutex);
+            releaseBatch(hQueue, *batch);
+        }
+        queues.clear();
+    }
+    flushedBatches = 0;
+    flushedCommands = 0;
+    // The layer stays in the dispatch table, the loader only initializes the
+    // layers once.
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace ur_batching_layer
@@ -0,0 +1,196 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_batching_layer.hpp
+ *
+ */
+
+#ifndef UR_BATCHING_LAYER_H
+#define UR_BATCHING_LAYER_H 1
+
+#include "logger/ur_logger.hpp"
+#include "ur_ddi.h"
+#include "ur_proxy_layer.hpp"
+#include "ur_util.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace ur_batching_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief A command recorded for replaying it on the queue later.
+struct command_t {
+    std::function<ur_result_t(uint32_t, const ur_event_handle_t *)> submit;
+    // Retained when recording, so that the application may release them.
+    ur_kernel_handle_t hKernel = nullptr;
+    std::vector<ur_mem_handle_t> mems;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Commands recorded on a queue created with
+///        UR_QUEUE_FLAG_SUBMISSION_BATCHED and not submitted yet.
+struct batch_t {
+    std::mutex mutex;
+    ur_context_handle_t hContext = nullptr;
+    ur_device_handle_t hDevice = nullptr;
+    bool inOrder = true;
+    bool useCommandBuffer = false;
+
+    // Retained events the first command of the batch waits for, commands
+    // with a wait list always start a new batch.
+    std::vector<ur_event_handle_t> waitList;
+    // Number of recorded commands and when the first one was recorded.
+    size_t size = 0;
+    uint64_t startNs = 0;
+    // USM pointers passed to the recorded commands, and the number of kernel
+    // launches among them, which may access any allocation.
+    std::vector<const void *> pointers;
+    size_t launches = 0;
+
+    // Adapters with command buffers get the commands appended right away,
+    // which also captures the kernel arguments.
+    ur_exp_command_buffer_handle_t hCommandBuffer = nullptr;
+    ur_exp_command_buffer_sync_point_t lastSyncPoint = 0;
+    // Other adapters get the commands replayed one by one.
+    std::vector<command_t> commands;
+
+    // Submitted command buffers and their events, released once complete.
+    std::vector<std::pair<ur_exp_command_buffer_handle_t, ur_event_handle_t>>
+        submitted;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+class __urdlllocal context_t : public proxy_layer_context_t {
+  public:
+    ur_dditable_t urDdiTable = {};
+    logger::Logger logger;
+    bool enabled = false;
+
+    context_t();
+    ~context_t();
+
+    bool isAvailable() const override { return true; }
+    std::vector<std::string> getNames() const override { return {name}; }
+    ur_result_t init(ur_dditable_t *dditable,
+                     const std::set<std::string> &enabledLayerNames,
+                     codeloc_data codelocData) override;
+    ur_result_t tearDown() override;
+
+    void addQueue(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+                  const ur_queue_properties_t *pProperties,
+                  ur_queue_handle_t hQueue);
+    // Submits the commands and waits for the queue if it is about to be
+    // destroyed.
+    ur_result_t removeQueue(ur_queue_handle_t hQueue);
+    bool isBatched(ur_queue_handle_t hQueue);
+
+    // Submits the recorded commands of a queue, reason is logged.
+    ur_result_t flush(ur_queue_handle_t hQueue, const char *reason);
+    ur_result_t flushAll(const char *reason);
+    // Submits the commands of the queues the events were enqueued on.
+    ur_result_t flushEvents(uint32_t numEvents,
+                            const ur_event_handle_t *phEvents,
+                            const char *reason);
+    // Submits the commands which may access the allocation at pMem.
+    ur_result_t flushPointer(ur_context_handle_t hContext, const void *pMem,
+                             const char *reason);
+    // Submits the commands which would see arguments set on hKernel.
+    ur_result_t flushKernel(ur_kernel_handle_t hKernel, const char *reason);
+    // Releases the command buffers submitted to a queue which finished.
+    void finished(ur_queue_handle_t hQueue);
+
+    ur_result_t recordKernelLaunch(ur_queue_handle_t hQueue,
+                                   ur_kernel_handle_t hKernel, uint32_t workDim,
+                                   const size_t *pGlobalWorkOffset,
+                                   const size_t *pGlobalWorkSize,
+                                   const size_t *pLocalWorkSize,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList);
+    ur_result_t recordMemBufferCopy(ur_queue_handle_t hQueue,
+                                    ur_mem_handle_t hBufferSrc,
+                                    ur_mem_handle_t hBufferDst,
+                                    size_t srcOffset, size_t dstOffset,
+                                    size_t size, uint32_t numEventsInWaitList,
+                                    const ur_event_handle_t *phEventWaitList);
+    ur_result_t recordMemBufferFill(ur_queue_handle_t hQueue,
+                                    ur_mem_handle_t hBuffer,
+                                    const void *pPattern, size_t patternSize,
+                                    size_t offset, size_t size,
+                                    uint32_t numEventsInWaitList,
+                                    const ur_event_handle_t *phEventWaitList);
+    ur_result_t recordUSMFill(ur_queue_handle_t hQueue, void *pMem,
+                              size_t patternSize, const void *pPattern,
+                              size_t size, uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList);
+    ur_result_t recordUSMMemcpy(ur_queue_handle_t hQueue, bool blocking,
+                                void *pDst, const void *pSrc, size_t size,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList);
+
+  private:
+    std::shared_ptr<batch_t> getBatch(ur_queue_handle_t hQueue);
+    // Called with the batch locked, before recording a command.
+    ur_result_t beginCommand(ur_queue_handle_t hQueue, batch_t &batch,
+                             uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList);
+    // Called with the batch locked, after recording a command.
+    ur_result_t endCommand(ur_queue_handle_t hQueue, batch_t &batch);
+    ur_result_t flushLocked(ur_queue_handle_t hQueue, batch_t &batch,
+                            const char *reason);
+    // Submits the commands of the batches for which matches returns true,
+    // called with each batch locked.
+    ur_result_t
+    flushMatching(const std::function<bool(const batch_t &)> &matches,
+                  const char *reason);
+    ur_result_t submitCommandBuffer(ur_queue_handle_t hQueue, batch_t &batch);
+    ur_result_t replay(batch_t &batch);
+    void releaseCompleted(batch_t &batch, bool all);
+    // Called with the batch locked once its queue goes away, releases what
+    // the batch still holds.
+    void releaseBatch(ur_queue_handle_t hQueue, batch_t &batch);
+
+    // The flusher thread submits the batches older than max_delay_us, which
+    // would otherwise wait for the next command recorded on their queue.
+    void startFlusher();
+    void stopFlusher();
+    void runFlusher();
+    // Returns when the oldest batch left waiting expires.
+    uint64_t flushExpired();
+
+    const std::string name = "UR_LAYER_BATCHING";
+
+    size_t maxCommands;
+    uint64_t maxDelayNs;
+    bool allowCommandBuffers = true;
+
+    std::shared_mutex queuesMutex;
+    std::unordered_map<ur_queue_handle_t, std::shared_ptr<batch_t>> queues;
+    // Number of replayed kernel launches waiting in batches, kernel argument
+    // changes only need to look for them if there are any.
+    std::atomic<size_t> pendingLaunches = 0;
+
+    std::atomic<uint64_t> flushedBatches = 0;
+    std::atomic<uint64_t> flushedCommands = 0;
+
+    std::mutex flusherMutex;
+    std::condition_variable flusherCv;
+    bool flusherStopping = false;
+    std::thread flusher;
+};
+
+extern context_t context;
+} // namespace ur_batching_layer
+
+#endif /* UR_BATCHING_LAYER_H */
@@ -0,0 +1,216 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_compddi.cpp
+ *
+ */
+
+#include "ur_composite_layer.hpp"
+
+namespace ur_composite_layer {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueCreate
+__urdlllocal ur_result_t UR_APICALL urQueueCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_queue_properties_t
+        *pProperties, ///< [in][optional] pointer to queue creation properties.
+    ur_queue_handle_t
+        *phQueue ///< [out] pointer to handle of queue object created
+) {
+    auto pfnCreate = context.urDdiTable.Queue.pfnCreate;
+
+    if (nullptr == pfnCreate) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnCreate(hContext, hDevice, pProperties, phQueue);
+    if (result == UR_RESULT_SUCCESS) {
+        context.insertQueue(hContext, hDevice, pProperties, *phQueue);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueRetain
+__urdlllocal ur_result_t UR_APICALL urQueueRetain(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue object to get access
+) {
+    auto pfnRetain = context.urDdiTable.Queue.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnRetain(hQueue);
+    if (result == UR_RESULT_SUCCESS) {
+        context.retainQueue(hQueue);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueRelease
+__urdlllocal ur_result_t UR_APICALL urQueueRelease(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue object to release
+) {
+    auto pfnRelease = context.urDdiTable.Queue.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    // Member queues go first, the adapter may free hQueue right away.
+    context.releaseQueue(hQueue);
+
+    ur_result_t result = pfnRelease(hQueue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueKernelLaunch
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function.
+    ///< If nullptr, the runtime implementation will choose the work-group
+    ///< size.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnKernelLaunch = context.urDdiTable.Enqueue.pfnKernelLaunch;
+
+    if (nullptr == pfnKernelLaunch) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto result = context.launchKernel(
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+    if (result) {
+        return *result;
+    }
+
+    return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                           pGlobalWorkSize, pLocalWorkSize,
+                           numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Enqueue table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_enqueue_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_composite_layer::context.version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_composite_layer::context.version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnKernelLaunch = ur_composite_layer::urEnqueueKernelLaunch;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Queue table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetQueueProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_composite_layer::context.version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_composite_layer::context.version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnCreate = ur_composite_layer::urQueueCreate;
+    pDdiTable->pfnRetain = ur_composite_layer::urQueueRetain;
+    pDdiTable->pfnRelease = ur_composite_layer::urQueueRelease;
+
+    return result;
+}
+
+ur_result_t context_t::init(ur_dditable_t *dditable,
+                            const std::set<std::string> &enabledLayerNames,
+                            codeloc_data) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    if (!enabledLayerNames.count(name)) {
+        return result;
+    }
+
+    // The layer creates member queues and queries devices and events, keep
+    // the complete table of the layers below.
+    ur_composite_layer::context.urDdiTable = *dditable;
+    ur_composite_layer::context.enabled = true;
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_composite_layer::urGetEnqueueProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->Enqueue);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_composite_layer::urGetQueueProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->Queue);
+    }
+
+    return result;
+}
+} /* namespace ur_composite_layer */
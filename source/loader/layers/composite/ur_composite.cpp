@@ -0,0 +1,126 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_composite.cpp
+ *
+ */
+
+#include "ur_composite.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+namespace ur_composite_layer {
+
+// Largest work-group size assumed when the adapter picks it.
+constexpr size_t MAX_IMPLICIT_GROUP_SIZE = 64;
+
+// Weight of the newest sample in the throughput average.
+constexpr double THROUGHPUT_SMOOTHING = 0.25;
+
+std::optional<launch_split_t> planSplit(uint32_t workDim,
+                                        const size_t *pGlobalWorkSize,
+                                        const size_t *pLocalWorkSize) {
+    if (workDim == 0 || workDim > 3 || !pGlobalWorkSize) {
+        return std::nullopt;
+    }
+
+    std::optional<launch_split_t> best;
+    for (uint32_t dim = 0; dim < workDim; dim++) {
+        size_t globalSize = pGlobalWorkSize[dim];
+        size_t groupSize = 1;
+        if (pLocalWorkSize) {
+            groupSize = pLocalWorkSize[dim];
+        } else {
+            while (groupSize < MAX_IMPLICIT_GROUP_SIZE &&
+                   globalSize % (groupSize * 2) == 0) {
+                groupSize *= 2;
+            }
+        }
+        if (groupSize == 0 || globalSize == 0 || globalSize % groupSize) {
+            return std::nullopt;
+        }
+
+        size_t numGroups = globalSize / groupSize;
+        if (!best || numGroups > best->numGroups) {
+            best = launch_split_t{dim, groupSize, numGroups};
+        }
+    }
+    return best;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+balancer_t::balancer_t(std::vector<double> initialWeights)
+    : weights(std::move(initialWeights)), throughputs(weights.size()) {
+    for (auto &weight : weights) {
+        if (!(weight > 0)) {
+            weight = 1;
+        }
+    }
+}
+
+std::vector<size_t> balancer_t::split(size_t numGroups) const {
+    if (weights.empty()) {
+        return {};
+    }
+
+    std::vector<double> shares = weights;
+    if (numMeasured == weights.size()) {
+        for (size_t i = 0; i < shares.size(); i++) {
+            shares[i] = *throughputs[i];
+        }
+    }
+    double total = std::accumulate(shares.begin(), shares.end(), 0.0);
+
+    std::vector<size_t> counts(shares.size(), 0);
+    std::vector<std::pair<double, size_t>> remainders;
+    size_t assigned = 0;
+    for (size_t i = 0; i < shares.size(); i++) {
+        double exact = static_cast<double>(numGroups) * shares[i] / total;
+        counts[i] = std::min(static_cast<size_t>(std::floor(exact)),
+                             numGroups - assigned);
+        assigned += counts[i];
+        remainders.emplace_back(exact - static_cast<double>(counts[i]), i);
+    }
+
+    // Ties go to the earlier member, so splits are deterministic.
+    std::stable_sort(
+        remainders.begin(), remainders.end(),
+        [](const auto &a, const auto &b) { return a.first > b.first; });
+    for (size_t i = 0; assigned < numGroups; i = (i + 1) % counts.size()) {
+        counts[remainders[i].second]++;
+        assigned++;
+    }
+    return counts;
+}
+
+void balancer_t::record(size_t member, size_t groups, uint64_t nanoseconds) {
+    if (member >= throughputs.size() || groups == 0) {
+        return;
+    }
+
+    // Shards taking no measurable time still count as a nanosecond.
+    double sample = static_cast<double>(groups) /
+                    static_cast<double>(std::max<uint64_t>(nanoseconds, 1));
+    auto &throughput = throughputs[member];
+    if (throughput) {
+        *throughput = THROUGHPUT_SMOOTHING * sample +
+                      (1 - THROUGHPUT_SMOOTHING) * *throughput;
+    } else {
+        throughput = sample;
+        numMeasured++;
+    }
+}
+
+std::optional<double> balancer_t::getThroughput(size_t member) const {
+    return member < throughputs.size() ? throughputs[member] : std::nullopt;
+}
+
+} // namespace ur_composite_layer
@@ -0,0 +1,72 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_composite.hpp
+ *
+ */
+
+#ifndef UR_COMPOSITE_HPP
+#define UR_COMPOSITE_HPP 1
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace ur_composite_layer {
+
+// How a launch is cut into shards: along dimension dim, in whole groups of
+// groupSize work-items.
+struct launch_split_t {
+    uint32_t dim;
+    size_t groupSize;
+    size_t numGroups;
+};
+
+// Returns the dimension with the most work-groups. Without a local size the
+// adapter picks work-group sizes for every shard, shards are then cut at
+// multiples of the largest power of two up to 64 dividing the global size,
+// which keeps them to sizes the adapter would pick for the whole launch.
+std::optional<launch_split_t> planSplit(uint32_t workDim,
+                                        const size_t *pGlobalWorkSize,
+                                        const size_t *pLocalWorkSize);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Shares the work-groups of launches between the member devices of a
+///        composite queue.
+///
+/// Members start with a share proportional to their initial weight, e.g. the
+/// number of compute units. Once every member has run a shard, shares follow
+/// the throughput measured from the profiling timestamps of past shards,
+/// smoothed with an exponentially weighted moving average. The class is not
+/// thread safe.
+class balancer_t {
+  public:
+    explicit balancer_t(std::vector<double> initialWeights);
+
+    size_t getNumMembers() const { return weights.size(); }
+
+    // Number of groups of each member, adding up to numGroups. Rounding is
+    // done with the largest remainder method.
+    std::vector<size_t> split(size_t numGroups) const;
+
+    // Member ran groups work-groups in the given number of nanoseconds.
+    void record(size_t member, size_t groups, uint64_t nanoseconds);
+
+    // Work-groups per nanosecond, std::nullopt until the member ran a shard.
+    std::optional<double> getThroughput(size_t member) const;
+
+  private:
+    std::vector<double> weights;
+    std::vector<std::optional<double>> throughputs;
+    size_t numMeasured = 0;
+};
+
+} // namespace ur_composite_layer
+
+#endif /* UR_COMPOSITE_HPP */
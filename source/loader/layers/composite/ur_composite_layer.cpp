@@ -0,0 +1,395 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_composite_layer.cpp
+ *
+ */
+
+#include "ur_composite_layer.hpp"
+
+#include <array>
+
+namespace ur_composite_layer {
+context_t context;
+
+// Launches with fewer work-groups per member than this run on the queue's
+// own device, splitting them costs more than it gains.
+constexpr size_t DEFAULT_MIN_GROUPS = 8;
+// At most MAX_PENDING_SHARDS shard events per queue are kept retained for
+// their timestamps.
+constexpr size_t MAX_PENDING_SHARDS = 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+submitter_t::submitter_t() : thread([this] { run(); }) {}
+
+submitter_t::~submitter_t() {
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cv.notify_one();
+    thread.join();
+}
+
+std::future<ur_result_t>
+submitter_t::submit(std::function<ur_result_t()> task) {
+    auto packaged =
+        std::make_shared<std::packaged_task<ur_result_t()>>(std::move(task));
+    auto future = packaged->get_future();
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        tasks.emplace_back([packaged] { (*packaged)(); });
+    }
+    cv.notify_one();
+    return future;
+}
+
+void submitter_t::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+        if (tasks.empty()) {
+            return;
+        }
+        auto task = std::move(tasks.front());
+        tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::context_t()
+    : logger(logger::create_logger("composite")),
+      minGroups(DEFAULT_MIN_GROUPS) {
+    try {
+        auto config = getenv_to_map("UR_COMPOSITE");
+        if (config.has_value()) {
+            auto kv = config->find("members");
+            if (kv != config->end()) {
+                auto &value = kv->second.front();
+                if (value == "context") {
+                    membersMode = members_t::CONTEXT;
+                } else if (value != "sub_devices") {
+                    logger.error("Unknown UR_COMPOSITE members: {}", value);
+                }
+            }
+            kv = config->find("kernels");
+            if (kv != config->end()) {
+                splitKernels.insert(kv->second.begin(), kv->second.end());
+            }
+            kv = config->find("min_groups");
+            if (kv != config->end()) {
+                minGroups = std::stoull(kv->second.front());
+            }
+        }
+    } catch (std::exception &e) {
+        logger.error("Invalid UR_COMPOSITE value: {}", e.what());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::~context_t() {}
+
+std::vector<ur_device_handle_t>
+context_t::getMembers(ur_context_handle_t hContext,
+                      ur_device_handle_t hDevice) {
+    auto &contextDdi = urDdiTable.Context;
+    uint32_t numDevices = 0;
+    if (contextDdi.pfnGetInfo(hContext, UR_CONTEXT_INFO_NUM_DEVICES,
+                              sizeof(numDevices), &numDevices,
+                              nullptr) != UR_RESULT_SUCCESS) {
+        return {};
+    }
+    std::vector<ur_device_handle_t> devices(numDevices);
+    if (contextDdi.pfnGetInfo(hContext, UR_CONTEXT_INFO_DEVICES,
+                              sizeof(ur_device_handle_t) * numDevices,
+                              devices.data(), nullptr) != UR_RESULT_SUCCESS) {
+        return {};
+    }
+    if (membersMode == members_t::CONTEXT) {
+        return devices;
+    }
+
+    std::vector<ur_device_handle_t> members;
+    for (auto hMember : devices) {
+        ur_device_handle_t hParent = nullptr;
+        if (urDdiTable.Device.pfnGetInfo(
+                hMember, UR_DEVICE_INFO_PARENT_DEVICE, sizeof(hParent),
+                &hParent, nullptr) == UR_RESULT_SUCCESS &&
+            hParent == hDevice) {
+            members.push_back(hMember);
+        }
+    }
+    return members;
+}
+
+bool context_t::isSplitKernel(ur_kernel_handle_t hKernel) {
+    size_t nameSize = 0;
+    if (urDdiTable.Kernel.pfnGetInfo(hKernel, UR_KERNEL_INFO_FUNCTION_NAME, 0,
+                                     nullptr, &nameSize) != UR_RESULT_SUCCESS ||
+        nameSize == 0) {
+        return false;
+    }
+    std::string name(nameSize, '\0');
+    if (urDdiTable.Kernel.pfnGetInfo(hKernel, UR_KERNEL_INFO_FUNCTION_NAME,
+                                     nameSize, name.data(),
+                                     nullptr) != UR_RESULT_SUCCESS) {
+        return false;
+    }
+    name.resize(nameSize - 1);
+    return splitKernels.count(name) != 0;
+}
+
+void context_t::insertQueue(ur_context_handle_t hContext,
+                            ur_device_handle_t hDevice,
+                            const ur_queue_properties_t *pProperties,
+                            ur_queue_handle_t hQueue) {
+    auto devices = getMembers(hContext, hDevice);
+    if (devices.size() < 2) {
+        return;
+    }
+
+    // Shards are balanced by their duration, member queues always profile.
+    // Other properties, e.g. an executor, apply to every member.
+    ur_queue_properties_t memberProperties = {
+        UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+        pProperties ? pProperties->pNext : nullptr,
+        (pProperties ? pProperties->flags : 0) |
+            UR_QUEUE_FLAG_PROFILING_ENABLE};
+
+    std::vector<double> weights;
+    std::vector<member_t> members;
+    for (auto hMember : devices) {
+        uint32_t computeUnits = 0;
+        urDdiTable.Device.pfnGetInfo(hMember, UR_DEVICE_INFO_MAX_COMPUTE_UNITS,
+                                     sizeof(computeUnits), &computeUnits,
+                                     nullptr);
+        weights.push_back(computeUnits);
+
+        ur_queue_handle_t hMemberQueue = nullptr;
+        auto result = urDdiTable.Queue.pfnCreate(hContext, hMember,
+                                                 &memberProperties,
+                                                 &hMemberQueue);
+        if (result != UR_RESULT_SUCCESS) {
+            logger.warning("Unable to create a queue on member device {}: {}, "
+                           "launches are not split",
+                           hMember, result);
+            for (auto &member : members) {
+                urDdiTable.Queue.pfnRelease(member.hQueue);
+            }
+            return;
+        }
+        members.push_back({hMember, hMemberQueue, nullptr});
+    }
+    for (size_t i = 1; i < members.size(); i++) {
+        members[i].submitter = std::make_unique<submitter_t>();
+    }
+
+    auto queue = std::make_shared<composite_queue_t>(std::move(weights));
+    queue->members = std::move(members);
+    logger.info("Queue {} splits launches across {} devices", hQueue,
+                queue->members.size());
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    queues[hQueue] = std::move(queue);
+}
+
+bool context_t::retainQueue(ur_queue_handle_t hQueue) {
+    std::scoped_lock<std::mutex> lock(mutex);
+    auto it = queues.find(hQueue);
+    if (it == queues.end()) {
+        return false;
+    }
+    it->second->refCount++;
+    return true;
+}
+
+void context_t::releaseQueue(ur_queue_handle_t hQueue) {
+    std::shared_ptr<composite_queue_t> queue;
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        auto it = queues.find(hQueue);
+        if (it == queues.end() || --it->second->refCount > 0) {
+            return;
+        }
+        queue = std::move(it->second);
+        queues.erase(it);
+    }
+    destroyQueue(*queue);
+}
+
+void context_t::destroyQueue(composite_queue_t &queue) {
+    std::scoped_lock<std::mutex> lock(queue.mutex);
+    collectShards(queue, true);
+    for (auto &member : queue.members) {
+        member.submitter.reset();
+        urDdiTable.Queue.pfnRelease(member.hQueue);
+    }
+    queue.members.clear();
+}
+
+void context_t::collectShards(composite_queue_t &queue, bool all) {
+    auto &eventDdi = urDdiTable.Event;
+    while (!queue.pendingShards.empty()) {
+        auto pending = queue.pendingShards.front();
+
+        bool complete = true;
+        if (!all) {
+            ur_event_status_t status = UR_EVENT_STATUS_QUEUED;
+            complete = eventDdi.pfnGetInfo(
+                           pending.hEvent,
+                           UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                           sizeof(status), &status,
+                           nullptr) == UR_RESULT_SUCCESS &&
+                       status == UR_EVENT_STATUS_COMPLETE;
+        }
+        if (!complete && queue.pendingShards.size() <= MAX_PENDING_SHARDS) {
+            break;
+        }
+
+        uint64_t startTime = 0;
+        uint64_t endTime = 0;
+        if (complete &&
+            eventDdi.pfnGetProfilingInfo(
+                pending.hEvent, UR_PROFILING_INFO_COMMAND_START,
+                sizeof(startTime), &startTime, nullptr) == UR_RESULT_SUCCESS &&
+            eventDdi.pfnGetProfilingInfo(
+                pending.hEvent, UR_PROFILING_INFO_COMMAND_END, sizeof(endTime),
+                &endTime, nullptr) == UR_RESULT_SUCCESS &&
+            endTime >= startTime) {
+            queue.balancer.record(pending.member, pending.groups,
+                                  endTime - startTime);
+        }
+
+        eventDdi.pfnRelease(pending.hEvent);
+        queue.pendingShards.pop_front();
+    }
+}
+
+std::optional<ur_result_t> context_t::launchKernel(
+    ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+    std::shared_ptr<composite_queue_t> queue;
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        auto it = queues.find(hQueue);
+        if (it == queues.end()) {
+            return std::nullopt;
+        }
+        queue = it->second;
+    }
+
+    // Shards are launched with their own global size and offset, so the
+    // global range and group ids seen by the kernel are those of the shard.
+    // Only kernels which don't depend on them may be split.
+    if (!isSplitKernel(hKernel)) {
+        return std::nullopt;
+    }
+
+    auto split = planSplit(workDim, pGlobalWorkSize, pLocalWorkSize);
+    if (!split ||
+        split->numGroups < minGroups * queue->balancer.getNumMembers()) {
+        return std::nullopt;
+    }
+
+    std::scoped_lock<std::mutex> lock(queue->mutex);
+    collectShards(*queue, false);
+    auto counts = queue->balancer.split(split->numGroups);
+
+    // Shards wait on a single event standing in for the wait list, which
+    // also orders them after earlier commands of an in-order queue.
+    ur_event_handle_t hStart = nullptr;
+    ur_result_t result = urDdiTable.Enqueue.pfnEventsWait(
+        hQueue, numEventsInWaitList, phEventWaitList, &hStart);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto &members = queue->members;
+    std::vector<ur_event_handle_t> shardEvents(members.size(), nullptr);
+    std::vector<std::future<ur_result_t>> submitted(members.size());
+    size_t firstGroup = 0;
+    for (size_t i = 0; i < members.size(); i++) {
+        if (counts[i] == 0) {
+            continue;
+        }
+
+        std::array<size_t, 3> offset = {0, 0, 0};
+        std::array<size_t, 3> size = {1, 1, 1};
+        for (uint32_t dim = 0; dim < workDim; dim++) {
+            offset[dim] = pGlobalWorkOffset ? pGlobalWorkOffset[dim] : 0;
+            size[dim] = pGlobalWorkSize[dim];
+        }
+        offset[split->dim] += firstGroup * split->groupSize;
+        size[split->dim] = counts[i] * split->groupSize;
+        firstGroup += counts[i];
+
+        auto launch = [this, hQueue = members[i].hQueue, hKernel, workDim,
+                       offset, size, pLocalWorkSize, &hStart,
+                       phShardEvent = &shardEvents[i]] {
+            return urDdiTable.Enqueue.pfnKernelLaunch(
+                hQueue, hKernel, workDim, offset.data(), size.data(),
+                pLocalWorkSize, 1, &hStart, phShardEvent);
+        };
+        if (members[i].submitter) {
+            submitted[i] = members[i].submitter->submit(launch);
+        } else {
+            result = launch();
+        }
+    }
+    for (auto &future : submitted) {
+        if (future.valid()) {
+            auto shardResult = future.get();
+            if (result == UR_RESULT_SUCCESS) {
+                result = shardResult;
+            }
+        }
+    }
+    urDdiTable.Event.pfnRelease(hStart);
+
+    std::vector<ur_event_handle_t> joined;
+    for (size_t i = 0; i < members.size(); i++) {
+        if (shardEvents[i]) {
+            joined.push_back(shardEvents[i]);
+            queue->pendingShards.push_back({i, counts[i], shardEvents[i]});
+        }
+    }
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    // The launch completes once all of its shards have.
+    return urDdiTable.Enqueue.pfnEventsWait(
+        hQueue, static_cast<uint32_t>(joined.size()), joined.data(), phEvent);
+}
+
+ur_result_t context_t::tearDown() {
+    if (!enabled) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    // Composite queues leaked by the application.
+    std::unordered_map<ur_queue_handle_t, std::shared_ptr<composite_queue_t>>
+        leaked;
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        leaked.swap(queues);
+    }
+    for (auto &[hQueue, queue] : leaked) {
+        destroyQueue(*queue);
+    }
+    enabled = false;
+
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace ur_composite_layer
@@ -0,0 +1,152 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_composite_layer.hpp
+ *
+ */
+
+#ifndef UR_COMPOSITE_LAYER_H
+#define UR_COMPOSITE_LAYER_H 1
+
+#include "logger/ur_logger.hpp"
+#include "ur_composite.hpp"
+#include "ur_ddi.h"
+#include "ur_proxy_layer.hpp"
+#include "ur_util.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace ur_composite_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Thread submitting the shards of one member of a composite queue.
+///
+/// Adapters may run commands on the enqueuing thread, shards of different
+/// members are submitted from different threads so that they run
+/// concurrently.
+class submitter_t {
+  public:
+    submitter_t();
+    ~submitter_t();
+    submitter_t(const submitter_t &) = delete;
+    submitter_t &operator=(const submitter_t &) = delete;
+
+    std::future<ur_result_t> submit(std::function<ur_result_t()> task);
+
+  private:
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    bool stopping = false;
+    std::thread thread;
+};
+
+struct member_t {
+    ur_device_handle_t hDevice;
+    ur_queue_handle_t hQueue;
+    // The first member's shards are submitted by the enqueuing thread.
+    std::unique_ptr<submitter_t> submitter;
+};
+
+// Shard whose profiling timestamps have not been read yet.
+struct pending_shard_t {
+    size_t member;
+    size_t groups;
+    ur_event_handle_t hEvent;
+};
+
+// Queue created by the application, whose launches are split across the
+// queues of its members.
+struct composite_queue_t {
+    explicit composite_queue_t(std::vector<double> weights)
+        : balancer(std::move(weights)) {}
+
+    std::vector<member_t> members;
+    // References held by the application.
+    uint32_t refCount = 1;
+
+    // Serializes the launches on the queue.
+    std::mutex mutex;
+    balancer_t balancer;
+    std::deque<pending_shard_t> pendingShards;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+class __urdlllocal context_t : public proxy_layer_context_t {
+  public:
+    ur_dditable_t urDdiTable = {};
+    logger::Logger logger;
+    bool enabled = false;
+
+    context_t();
+    ~context_t();
+
+    bool isAvailable() const override { return true; }
+    std::vector<std::string> getNames() const override { return {name}; }
+    ur_result_t init(ur_dditable_t *dditable,
+                     const std::set<std::string> &enabledLayerNames,
+                     codeloc_data codelocData) override;
+    ur_result_t tearDown() override;
+
+    // Makes hQueue, a queue created on hDevice, a composite queue if there
+    // are at least two member devices.
+    void insertQueue(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+                     const ur_queue_properties_t *pProperties,
+                     ur_queue_handle_t hQueue);
+    // Returns false if hQueue is not a composite queue.
+    bool retainQueue(ur_queue_handle_t hQueue);
+    // Releases the members once the last reference to hQueue is gone.
+    void releaseQueue(ur_queue_handle_t hQueue);
+
+    // Returns std::nullopt if the launch is not split, the caller then
+    // launches it on hQueue itself.
+    std::optional<ur_result_t>
+    launchKernel(ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel,
+                 uint32_t workDim, const size_t *pGlobalWorkOffset,
+                 const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+                 uint32_t numEventsInWaitList,
+                 const ur_event_handle_t *phEventWaitList,
+                 ur_event_handle_t *phEvent);
+
+  private:
+    enum class members_t { SUB_DEVICES, CONTEXT };
+
+    std::vector<ur_device_handle_t> getMembers(ur_context_handle_t hContext,
+                                               ur_device_handle_t hDevice);
+    // Returns true if the application allowed launches of hKernel to be
+    // split.
+    bool isSplitKernel(ur_kernel_handle_t hKernel);
+    void collectShards(composite_queue_t &queue, bool all);
+    void destroyQueue(composite_queue_t &queue);
+
+    const std::string name = "UR_LAYER_COMPOSITE";
+
+    members_t membersMode = members_t::SUB_DEVICES;
+    size_t minGroups;
+    std::set<std::string> splitKernels;
+
+    std::mutex mutex;
+    std::unordered_map<ur_queue_handle_t, std::shared_ptr<composite_queue_t>>
+        queues;
+};
+
+extern context_t context;
+} // namespace ur_composite_layer
+
+#endif /* UR_COMPOSITE_LAYER_H */
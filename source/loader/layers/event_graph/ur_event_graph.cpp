@@ -0,0 +1,502 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_event_graph.cpp
+ *
+ */
+
+#include "ur_event_graph.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace ur_event_graph_layer {
+
+// Upper bound of the commands visited when checking whether a dependency is
+// implied by another one, keeps the cost per command constant.
+constexpr size_t REACHABILITY_BUDGET = 64;
+
+// Upper bound of the implicit dependencies of a barrier on an out-of-order
+// queue.
+constexpr size_t MAX_BARRIER_DEPENDENCIES = 256;
+
+// A queue is reported as serialized behind another one when at least
+// SERIALIZED_MIN_WAITS and SERIALIZED_PERCENT percent of its commands wait on
+// the most recent command of the other queue.
+constexpr uint64_t SERIALIZED_MIN_WAITS = 8;
+constexpr uint64_t SERIALIZED_PERCENT = 90;
+
+static bool isBarrier(ur_function_t function, uint32_t numEventsInWaitList) {
+    return function == UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER ||
+           (function == UR_FUNCTION_ENQUEUE_EVENTS_WAIT &&
+            numEventsInWaitList == 0);
+}
+
+std::optional<uint32_t>
+event_graph_t::findQueue(ur_queue_handle_t hQueue) const {
+    auto it = queueIndices.find(hQueue);
+    if (it == queueIndices.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+uint32_t event_graph_t::addQueue(ur_queue_handle_t hQueue, bool inOrder) {
+    auto index = static_cast<uint32_t>(queues.size());
+    queue_t queue;
+    queue.handle = hQueue;
+    queue.inOrder = inOrder;
+    queues.push_back(std::move(queue));
+    queueIndices[hQueue] = index;
+    return index;
+}
+
+void event_graph_t::forgetQueue(ur_queue_handle_t hQueue) {
+    queueIndices.erase(hQueue);
+}
+
+std::optional<command_id_t>
+event_graph_t::addCommand(ur_function_t function, const char *name,
+                          uint32_t queueIndex, uint32_t numEventsInWaitList,
+                          const ur_event_handle_t *phEventWaitList,
+                          ur_event_handle_t hEvent, uint64_t submitTime) {
+    if (commands.size() >= maxCommands) {
+        return std::nullopt;
+    }
+
+    auto &queue = queues[queueIndex];
+    command_id_t id = commands.size();
+    command_t command;
+    command.function = function;
+    command.name = name;
+    command.queue = queueIndex;
+    command.submitTime = submitTime;
+
+    // Dependencies implied by the queue.
+    if (queue.inOrder) {
+        if (queue.last) {
+            command.dependencies.push_back(
+                {*queue.last, DEPENDENCY_FLAG_QUEUE_ORDER});
+        }
+    } else if (isBarrier(function, numEventsInWaitList)) {
+        if (queue.lastBarrier) {
+            command.dependencies.push_back(
+                {*queue.lastBarrier, DEPENDENCY_FLAG_QUEUE_ORDER});
+        }
+        for (auto source : queue.sinceBarrier) {
+            command.dependencies.push_back(
+                {source, DEPENDENCY_FLAG_QUEUE_ORDER});
+        }
+    } else if (queue.lastBarrier) {
+        command.dependencies.push_back(
+            {*queue.lastBarrier, DEPENDENCY_FLAG_QUEUE_ORDER});
+    }
+    size_t numImplicit = command.dependencies.size();
+
+    for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+        auto it = eventCommands.find(phEventWaitList[i]);
+        if (it == eventCommands.end()) {
+            command.unknownDependencies++;
+            continue;
+        }
+
+        auto source = it->second;
+        uint8_t flags = 0;
+        for (size_t j = numImplicit; j < command.dependencies.size(); j++) {
+            if (command.dependencies[j].source == source) {
+                flags |= DEPENDENCY_FLAG_DUPLICATE;
+            }
+        }
+
+        auto sourceQueue = commands[source].queue;
+        if (sourceQueue == queueIndex && queue.inOrder) {
+            flags |= DEPENDENCY_FLAG_REDUNDANT_QUEUE_ORDER;
+        } else if (sourceQueue != queueIndex &&
+                   queues[sourceQueue].last == source) {
+            flags |= DEPENDENCY_FLAG_LATEST_OF_QUEUE;
+            latestWaits[{sourceQueue, queueIndex}]++;
+        }
+        command.dependencies.push_back({source, flags});
+    }
+
+    // An explicit dependency is redundant when it can be reached from any of
+    // the other ones.
+    for (size_t i = numImplicit; i < command.dependencies.size(); i++) {
+        auto &dependency = command.dependencies[i];
+        if (dependency.flags & DEPENDENCY_FLAGS_REDUNDANT) {
+            continue;
+        }
+        for (size_t j = 0; j < command.dependencies.size(); j++) {
+            auto &other = command.dependencies[j];
+            if (j == i || other.source <= dependency.source ||
+                (other.flags & DEPENDENCY_FLAGS_REDUNDANT)) {
+                continue;
+            }
+            if (reaches(other.source, dependency.source)) {
+                dependency.flags |= DEPENDENCY_FLAG_REDUNDANT_TRANSITIVE;
+                break;
+            }
+        }
+    }
+
+    commands.push_back(std::move(command));
+
+    queue.commandCount++;
+    queue.last = id;
+    if (!queue.inOrder) {
+        if (function == UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER) {
+            queue.lastBarrier = id;
+            queue.sinceBarrier.clear();
+        } else {
+            // Older commands are most likely complete by the time a barrier
+            // gets submitted, don't let a barrier-free queue grow this
+            // forever.
+            if (queue.sinceBarrier.size() == MAX_BARRIER_DEPENDENCIES) {
+                queue.sinceBarrier.erase(queue.sinceBarrier.begin());
+            }
+            queue.sinceBarrier.push_back(id);
+        }
+    }
+    if (hEvent) {
+        eventCommands[hEvent] = id;
+    }
+
+    return id;
+}
+
+void event_graph_t::setDeviceToHostOffset(uint32_t queue, int64_t offset) {
+    queues[queue].deviceToHostOffset = offset;
+}
+
+void event_graph_t::setTimestamps(command_id_t id, uint64_t startTime,
+                                  uint64_t endTime) {
+    commands[id].startTime = startTime;
+    commands[id].endTime = endTime;
+}
+
+bool event_graph_t::reaches(command_id_t from, command_id_t target) const {
+    std::vector<command_id_t> stack = {from};
+    std::vector<command_id_t> visited;
+    while (!stack.empty() && visited.size() < REACHABILITY_BUDGET) {
+        auto current = stack.back();
+        stack.pop_back();
+        if (std::find(visited.begin(), visited.end(), current) !=
+            visited.end()) {
+            continue;
+        }
+        visited.push_back(current);
+
+        for (auto &dependency : commands[current].dependencies) {
+            if (dependency.source == target) {
+                return true;
+            }
+            // Commands are only ever added after their dependencies.
+            if (dependency.source > target) {
+                stack.push_back(dependency.source);
+            }
+        }
+    }
+    return false;
+}
+
+std::vector<std::pair<uint32_t, uint32_t>>
+event_graph_t::getSerializedQueues() const {
+    std::vector<std::pair<uint32_t, uint32_t>> serialized;
+    for (auto &[queuePair, waits] : latestWaits) {
+        auto commandCount = queues[queuePair.second].commandCount;
+        if (waits >= SERIALIZED_MIN_WAITS &&
+            waits * 100 >= commandCount * SERIALIZED_PERCENT) {
+            serialized.push_back(queuePair);
+        }
+    }
+    return serialized;
+}
+
+bool event_graph_t::isSerializedEdge(
+    const command_t &command, const dependency_t &dependency,
+    const std::vector<std::pair<uint32_t, uint32_t>> &serialized) const {
+    if (!(dependency.flags & DEPENDENCY_FLAG_LATEST_OF_QUEUE)) {
+        return false;
+    }
+    return std::find(serialized.begin(), serialized.end(),
+                     std::make_pair(commands[dependency.source].queue,
+                                    command.queue)) != serialized.end();
+}
+
+std::vector<std::string> event_graph_t::getFindings(size_t maxPerKind) const {
+    std::vector<std::string> findings;
+    size_t duplicates = 0;
+    size_t queueOrder = 0;
+    size_t transitive = 0;
+
+    for (command_id_t id = 0; id < commands.size(); id++) {
+        auto &command = commands[id];
+        for (auto &dependency : command.dependencies) {
+            const char *reason = nullptr;
+            size_t *count = nullptr;
+            if (dependency.flags & DEPENDENCY_FLAG_DUPLICATE) {
+                reason = "appears more than once in the wait list";
+                count = &duplicates;
+            } else if (dependency.flags &
+                       DEPENDENCY_FLAG_REDUNDANT_QUEUE_ORDER) {
+                reason = "is already ordered by the in-order queue";
+                count = &queueOrder;
+            } else if (dependency.flags &
+                       DEPENDENCY_FLAG_REDUNDANT_TRANSITIVE) {
+                reason = "is already implied by another wait";
+                count = &transitive;
+            } else {
+                continue;
+            }
+            if ((*count)++ < maxPerKind) {
+                std::stringstream ss;
+                ss << "redundant wait: command #" << id << " (" << command.name
+                   << ") waits on command #" << dependency.source << " ("
+                   << commands[dependency.source].name << "), which "
+                   << reason;
+                findings.push_back(ss.str());
+            }
+        }
+    }
+
+    auto summarize = [&](size_t count, const char *what) {
+        if (count > maxPerKind) {
+            std::stringstream ss;
+            ss << count << " redundant waits in total where the wait " << what;
+            findings.push_back(ss.str());
+        }
+    };
+    summarize(duplicates, "appears more than once in the wait list");
+    summarize(queueOrder, "is already ordered by the in-order queue");
+    summarize(transitive, "is already implied by another wait");
+
+    for (auto &[source, waiting] : getSerializedQueues()) {
+        std::stringstream ss;
+        ss << "cross-queue serialization: " << latestWaits.at({source, waiting})
+           << " of " << queues[waiting].commandCount << " commands on queue "
+           << waiting << " (" << queues[waiting].handle
+           << ") wait on the most recent command of queue " << source << " ("
+           << queues[source].handle << "), so they cannot overlap with it";
+        findings.push_back(ss.str());
+    }
+
+    return findings;
+}
+
+namespace {
+
+// Placement of a command on the timeline, in microseconds. Device timestamps
+// are used when profiling was enabled on the queue, otherwise the command is
+// shown as an instant at its submission time. Device timestamps of queues
+// whose device clock couldn't be correlated with the host clock are kept off
+// the host time axis, on separate tracks with their own origin.
+struct placement_t {
+    double start;
+    double duration;
+    bool device;
+    bool hostAxis;
+};
+
+std::vector<placement_t> placeCommands(const std::vector<command_t> &commands,
+                                       const std::vector<queue_t> &queues) {
+    int64_t minHost = std::numeric_limits<int64_t>::max();
+    int64_t minDevice = std::numeric_limits<int64_t>::max();
+    for (auto &command : commands) {
+        minHost = (std::min)(minHost, int64_t(command.submitTime));
+        if (command.endTime) {
+            auto &offset = queues[command.queue].deviceToHostOffset;
+            if (offset) {
+                minHost =
+                    (std::min)(minHost, int64_t(command.startTime) + *offset);
+            } else {
+                minDevice = (std::min)(minDevice, int64_t(command.startTime));
+            }
+        }
+    }
+
+    std::vector<placement_t> placements;
+    placements.reserve(commands.size());
+    for (auto &command : commands) {
+        if (!command.endTime) {
+            placements.push_back(
+                {(int64_t(command.submitTime) - minHost) / 1000.0, 0.0, false,
+                 true});
+            continue;
+        }
+        double duration = (command.endTime - command.startTime) / 1000.0;
+        auto &offset = queues[command.queue].deviceToHostOffset;
+        if (offset) {
+            placements.push_back(
+                {(int64_t(command.startTime) + *offset - minHost) / 1000.0,
+                 duration, true, true});
+        } else {
+            placements.push_back(
+                {(int64_t(command.startTime) - minDevice) / 1000.0, duration,
+                 true, false});
+        }
+    }
+    return placements;
+}
+
+// Chrome trace process of the host time axis and of the device clocks which
+// are not aligned with it.
+constexpr int HOST_AXIS_PID = 1;
+constexpr int DEVICE_CLOCK_PID = 2;
+
+int pidOf(const placement_t &placement) {
+    return placement.hostAxis ? HOST_AXIS_PID : DEVICE_CLOCK_PID;
+}
+
+const char *edgeName(uint8_t flags, bool serialized) {
+    if (flags & DEPENDENCY_FLAGS_REDUNDANT) {
+        return "redundant wait";
+    }
+    if (serialized) {
+        return "cross-queue serialization";
+    }
+    return "dependency";
+}
+
+} // namespace
+
+void event_graph_t::writeChromeTrace(std::ostream &os) const {
+    auto placements = placeCommands(commands, queues);
+    auto serialized = getSerializedQueues();
+    auto flags = os.flags();
+    os << std::fixed << std::setprecision(3);
+
+    std::vector<bool> deviceClockTracks(queues.size());
+    for (command_id_t id = 0; id < commands.size(); id++) {
+        if (!placements[id].hostAxis) {
+            deviceClockTracks[commands[id].queue] = true;
+        }
+    }
+    bool anyDeviceClockTrack =
+        std::find(deviceClockTracks.begin(), deviceClockTracks.end(), true) !=
+        deviceClockTracks.end();
+
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    const char *separator = "\n";
+    os << separator << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":"
+       << HOST_AXIS_PID << ",\"args\":{\"name\":\"host time\"}}";
+    separator = ",\n";
+    if (anyDeviceClockTrack) {
+        os << separator
+           << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":"
+           << DEVICE_CLOCK_PID
+           << ",\"args\":{\"name\":\"device time, not aligned with the "
+              "host\"}}";
+    }
+    for (uint32_t q = 0; q < queues.size(); q++) {
+        for (int pid : {HOST_AXIS_PID, DEVICE_CLOCK_PID}) {
+            if (pid == DEVICE_CLOCK_PID && !deviceClockTracks[q]) {
+                continue;
+            }
+            os << separator
+               << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+               << ",\"tid\":" << q << ",\"args\":{\"name\":\"queue " << q
+               << " (" << queues[q].handle << ")"
+               << (queues[q].inOrder ? " in-order" : " out-of-order")
+               << "\"}}";
+        }
+    }
+
+    for (command_id_t id = 0; id < commands.size(); id++) {
+        auto &command = commands[id];
+        auto &placement = placements[id];
+        os << separator << "{\"name\":\"" << command.name
+           << "\",\"cat\":\"command\",\"ph\":\"X\",\"pid\":"
+           << pidOf(placement) << ",\"tid\":" << command.queue
+           << ",\"ts\":" << placement.start
+           << ",\"dur\":" << placement.duration << ",\"args\":{\"id\":" << id
+           << ",\"timing\":\"" << (placement.device ? "device" : "submission")
+           << "\",\"unknown_waits\":" << command.unknownDependencies << "}}";
+    }
+
+    // Flow arrows for the explicit waits, queue ordering is already visible
+    // as the order of the slices on each queue's track.
+    uint64_t flowId = 0;
+    for (command_id_t id = 0; id < commands.size(); id++) {
+        auto &command = commands[id];
+        for (auto &dependency : command.dependencies) {
+            if (dependency.flags & DEPENDENCY_FLAG_QUEUE_ORDER) {
+                continue;
+            }
+            auto &source = placements[dependency.source];
+            auto name = edgeName(dependency.flags,
+                                 isSerializedEdge(command, dependency,
+                                                  serialized));
+            os << separator << "{\"name\":\"" << name
+               << "\",\"cat\":\"dependency\",\"ph\":\"s\",\"id\":" << flowId
+               << ",\"pid\":" << pidOf(source)
+               << ",\"tid\":" << commands[dependency.source].queue
+               << ",\"ts\":" << source.start + source.duration << "}";
+            os << separator << "{\"name\":\"" << name
+               << "\",\"cat\":\"dependency\",\"ph\":\"f\",\"bp\":\"e\",\"id\":"
+               << flowId << ",\"pid\":" << pidOf(placements[id])
+               << ",\"tid\":" << command.queue
+               << ",\"ts\":" << placements[id].start << "}";
+            flowId++;
+        }
+    }
+    os << "\n]}\n";
+    os.flags(flags);
+}
+
+void event_graph_t::writeDot(std::ostream &os) const {
+    auto placements = placeCommands(commands, queues);
+    auto serialized = getSerializedQueues();
+    auto flags = os.flags();
+    os << std::fixed << std::setprecision(3);
+
+    os << "digraph ur_event_graph {\n";
+    os << "  rankdir=LR;\n";
+    os << "  node [shape=box];\n";
+    for (uint32_t q = 0; q < queues.size(); q++) {
+        os << "  subgraph cluster_queue" << q << " {\n";
+        os << "    label=\"queue " << q << " (" << queues[q].handle << ")"
+           << (queues[q].inOrder ? " in-order" : " out-of-order") << "\";\n";
+        for (command_id_t id = 0; id < commands.size(); id++) {
+            if (commands[id].queue != q) {
+                continue;
+            }
+            os << "    c" << id << " [label=\"#" << id << " "
+               << commands[id].name;
+            if (placements[id].device) {
+                os << "\\n" << placements[id].duration << " us";
+            }
+            if (commands[id].unknownDependencies) {
+                os << "\\n" << commands[id].unknownDependencies
+                   << " unknown waits";
+            }
+            os << "\"];\n";
+        }
+        os << "  }\n";
+    }
+
+    for (command_id_t id = 0; id < commands.size(); id++) {
+        auto &command = commands[id];
+        for (auto &dependency : command.dependencies) {
+            os << "  c" << dependency.source << " -> c" << id;
+            if (dependency.flags & DEPENDENCY_FLAG_QUEUE_ORDER) {
+                os << " [style=dotted, color=gray]";
+            } else if (dependency.flags & DEPENDENCY_FLAGS_REDUNDANT) {
+                os << " [style=dashed, color=red, label=\"redundant\"]";
+            } else if (isSerializedEdge(command, dependency, serialized)) {
+                os << " [color=orange, label=\"serializing\"]";
+            }
+            os << ";\n";
+        }
+    }
+    os << "}\n";
+    os.flags(flags);
+}
+
+} // namespace ur_event_graph_layer
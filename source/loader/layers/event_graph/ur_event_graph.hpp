@@ -0,0 +1,144 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_event_graph.hpp
+ *
+ */
+
+#ifndef UR_EVENT_GRAPH_HPP
+#define UR_EVENT_GRAPH_HPP 1
+
+#include "ur_api.h"
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ur_event_graph_layer {
+
+using command_id_t = uint64_t;
+
+enum dependency_flag_t : uint8_t {
+    // Implied by the queue: in-order execution or a barrier.
+    DEPENDENCY_FLAG_QUEUE_ORDER = 1 << 0,
+    // The same event appears more than once in the wait list.
+    DEPENDENCY_FLAG_DUPLICATE = 1 << 1,
+    // An explicit wait on an earlier command of the same in-order queue.
+    DEPENDENCY_FLAG_REDUNDANT_QUEUE_ORDER = 1 << 2,
+    // Already implied by another dependency of the same command.
+    DEPENDENCY_FLAG_REDUNDANT_TRANSITIVE = 1 << 3,
+    // A wait on the most recent command of another queue.
+    DEPENDENCY_FLAG_LATEST_OF_QUEUE = 1 << 4,
+};
+
+constexpr uint8_t DEPENDENCY_FLAGS_REDUNDANT =
+    DEPENDENCY_FLAG_DUPLICATE | DEPENDENCY_FLAG_REDUNDANT_QUEUE_ORDER |
+    DEPENDENCY_FLAG_REDUNDANT_TRANSITIVE;
+
+struct dependency_t {
+    command_id_t source;
+    uint8_t flags;
+};
+
+struct command_t {
+    ur_function_t function;
+    const char *name;
+    uint32_t queue;
+    // Host time of the submission, in nanoseconds.
+    uint64_t submitTime;
+    // Device profiling timestamps, both 0 when unknown.
+    uint64_t startTime = 0;
+    uint64_t endTime = 0;
+    std::vector<dependency_t> dependencies;
+    // Waits on events which were not returned by a recorded command, e.g.
+    // user events or events of commands recorded before the limit was hit.
+    uint32_t unknownDependencies = 0;
+};
+
+struct queue_t {
+    ur_queue_handle_t handle;
+    bool inOrder;
+    // Host time minus device time of the device of the queue, puts device
+    // timestamps on the host time axis. Unset if the clocks weren't
+    // correlated.
+    std::optional<int64_t> deviceToHostOffset;
+    uint64_t commandCount = 0;
+    std::optional<command_id_t> last;
+    // Out-of-order queues only.
+    std::optional<command_id_t> lastBarrier;
+    std::vector<command_id_t> sinceBarrier;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Dependency graph of the commands submitted to queues.
+///
+/// Commands are nodes, waits on their events are edges. False dependencies
+/// are detected while commands are added, with a bounded amount of work per
+/// command, so that the layer can stay enabled on real workloads. The class
+/// is not thread safe.
+class event_graph_t {
+  public:
+    explicit event_graph_t(size_t maxCommands) : maxCommands(maxCommands) {}
+
+    std::optional<uint32_t> findQueue(ur_queue_handle_t hQueue) const;
+    uint32_t addQueue(ur_queue_handle_t hQueue, bool inOrder);
+    // The queue keeps its index and commands, but the handle no longer
+    // refers to it.
+    void forgetQueue(ur_queue_handle_t hQueue);
+
+    // Returns std::nullopt once maxCommands commands have been recorded.
+    std::optional<command_id_t>
+    addCommand(ur_function_t function, const char *name, uint32_t queue,
+               uint32_t numEventsInWaitList,
+               const ur_event_handle_t *phEventWaitList,
+               ur_event_handle_t hEvent, uint64_t submitTime);
+
+    void setDeviceToHostOffset(uint32_t queue, int64_t offset);
+    void setTimestamps(command_id_t id, uint64_t startTime, uint64_t endTime);
+
+    size_t getMaxCommands() const { return maxCommands; }
+    const std::vector<command_t> &getCommands() const { return commands; }
+    const std::vector<queue_t> &getQueues() const { return queues; }
+
+    // Pairs of (source queue, waiting queue) where the waiting queue is
+    // serialized behind the source queue: nearly every command on it waits
+    // on the most recent command of the source queue.
+    std::vector<std::pair<uint32_t, uint32_t>> getSerializedQueues() const;
+
+    // Human readable description of every problem found in the graph.
+    std::vector<std::string> getFindings(size_t maxPerKind) const;
+
+    void writeChromeTrace(std::ostream &os) const;
+    void writeDot(std::ostream &os) const;
+
+  private:
+    bool reaches(command_id_t from, command_id_t target) const;
+    bool isSerializedEdge(
+        const command_t &command, const dependency_t &dependency,
+        const std::vector<std::pair<uint32_t, uint32_t>> &serialized) const;
+
+    const size_t maxCommands;
+    std::vector<command_t> commands;
+    std::vector<queue_t> queues;
+    std::unordered_map<ur_queue_handle_t, uint32_t> queueIndices;
+    // Command which returned an event. Events released by the application may
+    // have their handle reused, so a newer command simply overwrites the entry.
+    std::unordered_map<ur_event_handle_t, command_id_t> eventCommands;
+    // Number of waits on the most recent command of another queue, keyed by
+    // (source queue, waiting queue).
+    std::map<std::pair<uint32_t, uint32_t>, uint64_t> latestWaits;
+};
+
+} // namespace ur_event_graph_layer
+
+#endif /* UR_EVENT_GRAPH_HPP */
@@ -0,0 +1,246 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_event_graph_layer.cpp
+ *
+ */
+
+#include "ur_event_graph_layer.hpp"
+
+#include <chrono>
+#include <fstream>
+
+namespace ur_event_graph_layer {
+context_t context;
+
+constexpr size_t DEFAULT_MAX_COMMANDS = 1 << 20;
+constexpr auto DEFAULT_OUTPUT_PATH = "ur_event_graph.json";
+// Completed events are collected every COLLECT_INTERVAL recorded commands,
+// and at most MAX_PENDING_EVENTS events are kept retained by the layer.
+constexpr uint64_t COLLECT_INTERVAL = 64;
+constexpr size_t MAX_PENDING_EVENTS = 4096;
+constexpr size_t MAX_FINDINGS_PER_KIND = 16;
+
+static uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::context_t()
+    : logger(logger::create_logger("event_graph")),
+      outputPath(DEFAULT_OUTPUT_PATH) {
+    size_t maxCommands = DEFAULT_MAX_COMMANDS;
+    try {
+        auto config = getenv_to_map("UR_EVENT_GRAPH");
+        if (config.has_value()) {
+            auto kv = config->find("output");
+            if (kv != config->end()) {
+                outputPath = kv->second.front();
+            }
+            kv = config->find("max_commands");
+            if (kv != config->end()) {
+                maxCommands = std::stoull(kv->second.front());
+            }
+        }
+    } catch (std::exception &e) {
+        logger.error("Invalid UR_EVENT_GRAPH value: {}", e.what());
+    }
+    graph = std::make_unique<event_graph_t>(maxCommands);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::~context_t() {}
+
+uint32_t context_t::getQueue(ur_queue_handle_t hQueue, bool &profiling) {
+    if (auto index = graph->findQueue(hQueue)) {
+        profiling = profilingQueues[*index];
+        return *index;
+    }
+
+    // Treat queues we can't query as in-order ones without profiling, which
+    // at worst reports too few redundant waits.
+    ur_queue_flags_t flags = 0;
+    if (urDdiTable.Queue.pfnGetInfo(hQueue, UR_QUEUE_INFO_FLAGS, sizeof(flags),
+                                    &flags, nullptr) != UR_RESULT_SUCCESS) {
+        flags = 0;
+    }
+    profiling = flags & UR_QUEUE_FLAG_PROFILING_ENABLE;
+    profilingQueues.push_back(profiling);
+    auto index = graph->addQueue(
+        hQueue, !(flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE));
+    if (profiling) {
+        if (auto offset = queryDeviceToHostOffset(hQueue)) {
+            graph->setDeviceToHostOffset(index, *offset);
+        }
+    }
+    return index;
+}
+
+// Profiling timestamps use the device clock, which urDeviceGetGlobalTimestamps
+// reads too. Reading it along with the host clock of the submission times
+// lets both share one time axis.
+std::optional<int64_t>
+context_t::queryDeviceToHostOffset(ur_queue_handle_t hQueue) {
+    ur_device_handle_t hDevice = nullptr;
+    if (!urDdiTable.Device.pfnGetGlobalTimestamps ||
+        urDdiTable.Queue.pfnGetInfo(hQueue, UR_QUEUE_INFO_DEVICE,
+                                    sizeof(hDevice), &hDevice,
+                                    nullptr) != UR_RESULT_SUCCESS) {
+        return std::nullopt;
+    }
+
+    uint64_t deviceTime = 0;
+    auto before = now();
+    if (urDdiTable.Device.pfnGetGlobalTimestamps(hDevice, &deviceTime,
+                                                 nullptr) !=
+            UR_RESULT_SUCCESS ||
+        deviceTime == 0) {
+        logger.info("Unable to read the device clock of queue {}, its device "
+                    "timestamps are not aligned with the host",
+                    reinterpret_cast<void *>(hQueue));
+        return std::nullopt;
+    }
+    auto after = now();
+
+    // Assume the device clock was read half way through the call.
+    return static_cast<int64_t>(before + (after - before) / 2) -
+           static_cast<int64_t>(deviceTime);
+}
+
+void context_t::recordCommand(ur_function_t function,
+                              const char *functionName,
+                              ur_queue_handle_t hQueue,
+                              uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList,
+                              ur_event_handle_t *phEvent) {
+    auto submitTime = now();
+    auto hEvent = phEvent ? *phEvent : nullptr;
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    bool profiling = false;
+    auto queue = getQueue(hQueue, profiling);
+    auto id = graph->addCommand(function, functionName, queue,
+                                numEventsInWaitList, phEventWaitList, hEvent,
+                                submitTime);
+    if (!id) {
+        if (!limitReported) {
+            logger.warning("Recorded the maximum number of commands, "
+                           "further commands are ignored");
+            limitReported = true;
+        }
+        return;
+    }
+
+    // Profiling information is only available once the command completes,
+    // keep the event alive until then.
+    if (hEvent && profiling &&
+        urDdiTable.Event.pfnRetain(hEvent) == UR_RESULT_SUCCESS) {
+        pendingEvents.push_back({*id, hEvent});
+    }
+
+    if (++recordsSinceCollect >= COLLECT_INTERVAL) {
+        recordsSinceCollect = 0;
+        collectTimestamps(false);
+    }
+}
+
+void context_t::queueRetained(ur_queue_handle_t hQueue) {
+    std::scoped_lock<std::mutex> lock(mutex);
+    queueRetains[hQueue]++;
+}
+
+// The adapter may hand out the handle of a destroyed queue for a new one,
+// which must not inherit the recorded flags and clock offset.
+void context_t::queueReleased(ur_queue_handle_t hQueue) {
+    std::scoped_lock<std::mutex> lock(mutex);
+    auto it = queueRetains.find(hQueue);
+    if (it != queueRetains.end()) {
+        if (--it->second == 0) {
+            queueRetains.erase(it);
+        }
+        return;
+    }
+    graph->forgetQueue(hQueue);
+}
+
+void context_t::collectTimestamps(bool all) {
+    auto &eventDdi = urDdiTable.Event;
+    while (!pendingEvents.empty()) {
+        auto pending = pendingEvents.front();
+
+        bool complete = true;
+        if (!all) {
+            ur_event_status_t status = UR_EVENT_STATUS_QUEUED;
+            complete = eventDdi.pfnGetInfo(
+                           pending.hEvent,
+                           UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                           sizeof(status), &status,
+                           nullptr) == UR_RESULT_SUCCESS &&
+                       status == UR_EVENT_STATUS_COMPLETE;
+        }
+        if (!complete && pendingEvents.size() <= MAX_PENDING_EVENTS) {
+            break;
+        }
+
+        uint64_t startTime = 0;
+        uint64_t endTime = 0;
+        if (complete &&
+            eventDdi.pfnGetProfilingInfo(
+                pending.hEvent, UR_PROFILING_INFO_COMMAND_START,
+                sizeof(startTime), &startTime, nullptr) == UR_RESULT_SUCCESS &&
+            eventDdi.pfnGetProfilingInfo(
+                pending.hEvent, UR_PROFILING_INFO_COMMAND_END, sizeof(endTime),
+                &endTime, nullptr) == UR_RESULT_SUCCESS &&
+            endTime >= startTime) {
+            graph->setTimestamps(pending.command, startTime, endTime);
+        }
+
+        eventDdi.pfnRelease(pending.hEvent);
+        pendingEvents.pop_front();
+    }
+}
+
+ur_result_t context_t::tearDown() {
+    if (!enabled) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    collectTimestamps(true);
+
+    for (auto &finding : graph->getFindings(MAX_FINDINGS_PER_KIND)) {
+        logger.warning("{}", finding);
+    }
+
+    std::ofstream file(outputPath);
+    if (file) {
+        auto dotSuffix = std::string(".dot");
+        if (outputPath.size() >= dotSuffix.size() &&
+            outputPath.compare(outputPath.size() - dotSuffix.size(),
+                               dotSuffix.size(), dotSuffix) == 0) {
+            graph->writeDot(file);
+        } else {
+            graph->writeChromeTrace(file);
+        }
+        logger.info("Wrote {} commands on {} queues to {}",
+                    graph->getCommands().size(), graph->getQueues().size(),
+                    outputPath);
+    } else {
+        logger.error("Unable to open {} for writing", outputPath);
+    }
+
+    // The loader only initializes the layers once, so the graph is kept as is.
+    // Don't write it again on a repeated urLoaderTearDown.
+    enabled = false;
+
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace ur_event_graph_layer
@@ -0,0 +1,82 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_event_graph_layer.hpp
+ *
+ */
+
+#ifndef UR_EVENT_GRAPH_LAYER_H
+#define UR_EVENT_GRAPH_LAYER_H 1
+
+#include "logger/ur_logger.hpp"
+#include "ur_ddi.h"
+#include "ur_event_graph.hpp"
+#include "ur_proxy_layer.hpp"
+#include "ur_util.hpp"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace ur_event_graph_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+class __urdlllocal context_t : public proxy_layer_context_t {
+  public:
+    ur_dditable_t urDdiTable = {};
+    logger::Logger logger;
+    bool enabled = false;
+
+    context_t();
+    ~context_t();
+
+    bool isAvailable() const override { return true; }
+    std::vector<std::string> getNames() const override { return {name}; }
+    ur_result_t init(ur_dditable_t *dditable,
+                     const std::set<std::string> &enabledLayerNames,
+                     codeloc_data codelocData) override;
+    ur_result_t tearDown() override;
+
+    void recordCommand(ur_function_t function, const char *functionName,
+                       ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+                       const ur_event_handle_t *phEventWaitList,
+                       ur_event_handle_t *phEvent);
+    void queueRetained(ur_queue_handle_t hQueue);
+    void queueReleased(ur_queue_handle_t hQueue);
+
+  private:
+    struct pending_event_t {
+        command_id_t command;
+        ur_event_handle_t hEvent;
+    };
+
+    uint32_t getQueue(ur_queue_handle_t hQueue, bool &profiling);
+    std::optional<int64_t> queryDeviceToHostOffset(ur_queue_handle_t hQueue);
+    void collectTimestamps(bool all);
+
+    const std::string name = "UR_LAYER_EVENT_GRAPH";
+
+    std::mutex mutex;
+    std::unique_ptr<event_graph_t> graph;
+    // Queues with profiling enabled, by index in the graph.
+    std::vector<bool> profilingQueues;
+    // References taken with urQueueRetain and not released yet, the handle
+    // of a queue is forgotten once it's released with none of them left.
+    std::unordered_map<ur_queue_handle_t, uint32_t> queueRetains;
+    // Retained events of profiled commands whose timestamps have not been
+    // read yet, roughly in completion order.
+    std::deque<pending_event_t> pendingEvents;
+    uint64_t recordsSinceCollect = 0;
+    bool limitReported = false;
+    std::string outputPath;
+};
+
+extern context_t context;
+} // namespace ur_event_graph_layer
+
+#endif /* UR_EVENT_GRAPH_LAYER_H */
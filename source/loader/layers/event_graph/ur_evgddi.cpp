@@ -0,0 +1,1604 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_evgddi.cpp
+ *
+ */
+
+#include "ur_event_graph_layer.hpp"
+
+namespace ur_event_graph_layer {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueRetain
+__urdlllocal ur_result_t UR_APICALL urQueueRetain(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue object to get access
+) {
+    auto pfnRetain = context.urDdiTable.Queue.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnRetain(hQueue);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.queueRetained(hQueue);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueRelease
+__urdlllocal ur_result_t UR_APICALL urQueueRelease(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue object to release
+) {
+    auto pfnRelease = context.urDdiTable.Queue.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnRelease(hQueue);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.queueReleased(hQueue);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueKernelLaunch
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function.
+    ///< If nullptr, the runtime implementation will choose the work-group
+    ///< size.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnKernelLaunch = context.urDdiTable.Enqueue.pfnKernelLaunch;
+
+    if (nullptr == pfnKernelLaunch) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnKernelLaunch(
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH,
+                              "urEnqueueKernelLaunch", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueEventsWait
+__urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnEventsWait = context.urDdiTable.Enqueue.pfnEventsWait;
+
+    if (nullptr == pfnEventsWait) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_EVENTS_WAIT,
+                              "urEnqueueEventsWait", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueEventsWaitWithBarrier
+__urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnEventsWaitWithBarrier =
+        context.urDdiTable.Enqueue.pfnEventsWaitWithBarrier;
+
+    if (nullptr == pfnEventsWaitWithBarrier) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
+                              "urEnqueueEventsWaitWithBarrier", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    size_t offset,     ///< [in] offset in bytes in the buffer object
+    size_t size,       ///< [in] size in bytes of data being read
+    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferRead = context.urDdiTable.Enqueue.pfnMemBufferRead;
+
+    if (nullptr == pfnMemBufferRead) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
+                         numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ,
+                              "urEnqueueMemBufferRead", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    size_t offset,     ///< [in] offset in bytes in the buffer object
+    size_t size,       ///< [in] size in bytes of data being written
+    const void
+        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferWrite = context.urDdiTable.Enqueue.pfnMemBufferWrite;
+
+    if (nullptr == pfnMemBufferWrite) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
+                              "urEnqueueMemBufferWrite", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferReadRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
+    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+    size_t
+        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+    size_t
+        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being read
+    size_t
+        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
+                      ///< dst
+    size_t
+        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
+                        ///< pointed by dst
+    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferReadRect = context.urDdiTable.Enqueue.pfnMemBufferReadRect;
+
+    if (nullptr == pfnMemBufferReadRect) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnMemBufferReadRect(
+        hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
+                              "urEnqueueMemBufferReadRect", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferWriteRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
+    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+    size_t
+        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+    size_t
+        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being
+                          ///< written
+    size_t
+        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
+                      ///< src
+    size_t
+        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
+                        ///< pointed by src
+    void
+        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] points to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferWriteRect =
+        context.urDdiTable.Enqueue.pfnMemBufferWriteRect;
+
+    if (nullptr == pfnMemBufferWriteRect) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnMemBufferWriteRect(
+        hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
+                              "urEnqueueMemBufferWriteRect", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferCopy
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBufferSrc, ///< [in][bounds(srcOffset, size)] handle of the src buffer object
+    ur_mem_handle_t
+        hBufferDst, ///< [in][bounds(dstOffset, size)] handle of the dest buffer object
+    size_t srcOffset, ///< [in] offset into hBufferSrc to begin copying from
+    size_t dstOffset, ///< [in] offset info hBufferDst to begin copying into
+    size_t size,      ///< [in] size in bytes of data being copied
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferCopy = context.urDdiTable.Enqueue.pfnMemBufferCopy;
+
+    if (nullptr == pfnMemBufferCopy) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset,
+                         size, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY,
+                              "urEnqueueMemBufferCopy", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferCopyRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBufferSrc, ///< [in][bounds(srcOrigin, region)] handle of the source buffer object
+    ur_mem_handle_t
+        hBufferDst, ///< [in][bounds(dstOrigin, region)] handle of the dest buffer object
+    ur_rect_offset_t srcOrigin, ///< [in] 3D offset in the source buffer
+    ur_rect_offset_t dstOrigin, ///< [in] 3D offset in the destination buffer
+    ur_rect_region_t
+        region, ///< [in] source 3D rectangular region descriptor: width, height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferCopyRect = context.urDdiTable.Enqueue.pfnMemBufferCopyRect;
+
+    if (nullptr == pfnMemBufferCopyRect) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnMemBufferCopyRect(
+        hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
+                              "urEnqueueMemBufferCopyRect", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferFill
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    const void *pPattern, ///< [in] pointer to the fill pattern
+    size_t patternSize,   ///< [in] size in bytes of the pattern
+    size_t offset,        ///< [in] offset into the buffer
+    size_t size, ///< [in] fill size in bytes, must be a multiple of patternSize
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferFill = context.urDdiTable.Enqueue.pfnMemBufferFill;
+
+    if (nullptr == pfnMemBufferFill) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset, size,
+                         numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL,
+                              "urEnqueueMemBufferFill", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemImageRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImage, ///< [in][bounds(origin, region)] handle of the image object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t
+        origin, ///< [in] defines the (x,y,z) offset in pixels in the 1D, 2D, or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    size_t rowPitch,   ///< [in] length of each row in bytes
+    size_t slicePitch, ///< [in] length of each 2D slice of the 3D image
+    void *pDst, ///< [in] pointer to host memory where image is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemImageRead = context.urDdiTable.Enqueue.pfnMemImageRead;
+
+    if (nullptr == pfnMemImageRead) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnMemImageRead(
+        hQueue, hImage, blockingRead, origin, region, rowPitch, slicePitch,
+        pDst, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ,
+                              "urEnqueueMemImageRead", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemImageWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImage, ///< [in][bounds(origin, region)] handle of the image object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t
+        origin, ///< [in] defines the (x,y,z) offset in pixels in the 1D, 2D, or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    size_t rowPitch,   ///< [in] length of each row in bytes
+    size_t slicePitch, ///< [in] length of each 2D slice of the 3D image
+    void *pSrc, ///< [in] pointer to host memory where image is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemImageWrite = context.urDdiTable.Enqueue.pfnMemImageWrite;
+
+    if (nullptr == pfnMemImageWrite) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnMemImageWrite(
+        hQueue, hImage, blockingWrite, origin, region, rowPitch, slicePitch,
+        pSrc, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE,
+                              "urEnqueueMemImageWrite", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemImageCopy
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImageSrc, ///< [in][bounds(srcOrigin, region)] handle of the src image object
+    ur_mem_handle_t
+        hImageDst, ///< [in][bounds(dstOrigin, region)] handle of the dest image object
+    ur_rect_offset_t
+        srcOrigin, ///< [in] defines the (x,y,z) offset in pixels in the source 1D, 2D, or 3D
+                   ///< image
+    ur_rect_offset_t
+        dstOrigin, ///< [in] defines the (x,y,z) offset in pixels in the destination 1D, 2D,
+                   ///< or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemImageCopy = context.urDdiTable.Enqueue.pfnMemImageCopy;
+
+    if (nullptr == pfnMemImageCopy) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
+                        region, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY,
+                              "urEnqueueMemImageCopy", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferMap
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool blockingMap, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_map_flags_t mapFlags, ///< [in] flags for read, write, readwrite mapping
+    size_t offset, ///< [in] offset in bytes of the buffer region being mapped
+    size_t size,   ///< [in] size in bytes of the buffer region being mapped
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent, ///< [out][optional] return an event object that identifies this particular
+                 ///< command instance.
+    void **ppRetMap ///< [out] return mapped pointer.  TODO: move it before
+                    ///< numEventsInWaitList?
+) {
+    auto pfnMemBufferMap = context.urDdiTable.Enqueue.pfnMemBufferMap;
+
+    if (nullptr == pfnMemBufferMap) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags,
+                                         offset, size, numEventsInWaitList,
+                                         phEventWaitList, phEvent, ppRetMap);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP,
+                              "urEnqueueMemBufferMap", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemUnmap
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hMem,         ///< [in] handle of the memory (buffer or image) object
+    void *pMappedPtr, ///< [in] mapped host address
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemUnmap = context.urDdiTable.Enqueue.pfnMemUnmap;
+
+    if (nullptr == pfnMemUnmap) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
+                    phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_MEM_UNMAP,
+                              "urEnqueueMemUnmap", hQueue, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMFill
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *pMem, ///< [in][bounds(0, size)] pointer to USM memory object
+    size_t
+        patternSize, ///< [in] the size in bytes of the pattern. Must be a power of 2 and less
+                     ///< than or equal to width.
+    const void
+        *pPattern, ///< [in] pointer with the bytes of the pattern to set.
+    size_t
+        size, ///< [in] size in bytes to be set. Must be a multiple of patternSize.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnUSMFill = context.urDdiTable.Enqueue.pfnUSMFill;
+
+    if (nullptr == pfnUSMFill) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
+                   numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_USM_FILL, "urEnqueueUSMFill",
+                              hQueue, numEventsInWaitList, phEventWaitList,
+                              phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMMemcpy
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool blocking,            ///< [in] blocking or non-blocking copy
+    void *
+        pDst, ///< [in][bounds(0, size)] pointer to the destination USM memory object
+    const void *
+        pSrc, ///< [in][bounds(0, size)] pointer to the source USM memory object
+    size_t size,                  ///< [in] size in bytes to be copied
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnUSMMemcpy = context.urDdiTable.Enqueue.pfnUSMMemcpy;
+
+    if (nullptr == pfnUSMMemcpy) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
+                     phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_USM_MEMCPY,
+                              "urEnqueueUSMMemcpy", hQueue, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMPrefetch
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void
+        *pMem,   ///< [in][bounds(0, size)] pointer to the USM memory object
+    size_t size, ///< [in] size in bytes to be fetched
+    ur_usm_migration_flags_t flags, ///< [in] USM prefetch flags
+    uint32_t numEventsInWaitList,   ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnUSMPrefetch = context.urDdiTable.Enqueue.pfnUSMPrefetch;
+
+    if (nullptr == pfnUSMPrefetch) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
+                       phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_USM_PREFETCH,
+                              "urEnqueueUSMPrefetch", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMAdvise
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void
+        *pMem,   ///< [in][bounds(0, size)] pointer to the USM memory object
+    size_t size, ///< [in] size in bytes to be advised
+    ur_usm_advice_flags_t advice, ///< [in] USM memory advice
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnUSMAdvise = context.urDdiTable.Enqueue.pfnUSMAdvise;
+
+    if (nullptr == pfnUSMAdvise) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_USM_ADVISE,
+                              "urEnqueueUSMAdvise", hQueue, 0, nullptr,
+                              phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMFill2D
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    void *
+        pMem, ///< [in][bounds(0, pitch * height)] pointer to memory to be filled.
+    size_t
+        pitch, ///< [in] the total width of the destination memory including padding.
+    size_t
+        patternSize, ///< [in] the size in bytes of the pattern. Must be a power of 2 and less
+                     ///< than or equal to width.
+    const void
+        *pPattern, ///< [in] pointer with the bytes of the pattern to set.
+    size_t
+        width, ///< [in] the width in bytes of each row to fill. Must be a multiple of
+               ///< patternSize.
+    size_t height,                ///< [in] the height of the columns to fill.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnUSMFill2D = context.urDdiTable.Enqueue.pfnUSMFill2D;
+
+    if (nullptr == pfnUSMFill2D) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width, height,
+                     numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_USM_FILL_2D,
+                              "urEnqueueUSMFill2D", hQueue, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMMemcpy2D
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    bool blocking, ///< [in] indicates if this operation should block the host.
+    void *
+        pDst, ///< [in][bounds(0, dstPitch * height)] pointer to memory where data will
+              ///< be copied.
+    size_t
+        dstPitch, ///< [in] the total width of the source memory including padding.
+    const void *
+        pSrc, ///< [in][bounds(0, srcPitch * height)] pointer to memory to be copied.
+    size_t
+        srcPitch, ///< [in] the total width of the source memory including padding.
+    size_t width,  ///< [in] the width in bytes of each row to be copied.
+    size_t height, ///< [in] the height of columns to be copied.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnUSMMemcpy2D = context.urDdiTable.Enqueue.pfnUSMMemcpy2D;
+
+    if (nullptr == pfnUSMMemcpy2D) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch, width,
+                       height, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D,
+                              "urEnqueueUSMMemcpy2D", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueDeviceGlobalVariableWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program containing the device global variable.
+    const char
+        *name, ///< [in] the unique identifier for the device global variable.
+    bool blockingWrite, ///< [in] indicates if this operation should block.
+    size_t count,       ///< [in] the number of bytes to copy.
+    size_t
+        offset, ///< [in] the byte offset into the device global variable to start copying.
+    const void *pSrc, ///< [in] pointer to where the data must be copied from.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnDeviceGlobalVariableWrite =
+        context.urDdiTable.Enqueue.pfnDeviceGlobalVariableWrite;
+
+    if (nullptr == pfnDeviceGlobalVariableWrite) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnDeviceGlobalVariableWrite(
+        hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
+                              "urEnqueueDeviceGlobalVariableWrite", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueDeviceGlobalVariableRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program containing the device global variable.
+    const char
+        *name, ///< [in] the unique identifier for the device global variable.
+    bool blockingRead, ///< [in] indicates if this operation should block.
+    size_t count,      ///< [in] the number of bytes to copy.
+    size_t
+        offset, ///< [in] the byte offset into the device global variable to start copying.
+    void *pDst, ///< [in] pointer to where the data must be copied to.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnDeviceGlobalVariableRead =
+        context.urDdiTable.Enqueue.pfnDeviceGlobalVariableRead;
+
+    if (nullptr == pfnDeviceGlobalVariableRead) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnDeviceGlobalVariableRead(
+        hQueue, hProgram, name, blockingRead, count, offset, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
+                              "urEnqueueDeviceGlobalVariableRead", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueReadHostPipe
+__urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
+    ur_queue_handle_t
+        hQueue, ///< [in] a valid host command-queue in which the read command
+    ///< will be queued. hQueue and hProgram must be created with the same
+    ///< UR context.
+    ur_program_handle_t
+        hProgram, ///< [in] a program object with a successfully built executable.
+    const char *
+        pipe_symbol, ///< [in] the name of the program scope pipe global variable.
+    bool
+        blocking, ///< [in] indicate if the read operation is blocking or non-blocking.
+    void *
+        pDst, ///< [in] a pointer to buffer in host memory that will hold resulting data
+              ///< from pipe.
+    size_t size, ///< [in] size of the memory region to read, in bytes.
+    uint32_t numEventsInWaitList, ///< [in] number of events in the wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host pipe read.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] returns an event object that identifies this read
+                ///< command
+    ///< and can be used to query or queue a wait for this command to complete.
+) {
+    auto pfnReadHostPipe = context.urDdiTable.Enqueue.pfnReadHostPipe;
+
+    if (nullptr == pfnReadHostPipe) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst, size,
+                        numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE,
+                              "urEnqueueReadHostPipe", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueWriteHostPipe
+__urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
+    ur_queue_handle_t
+        hQueue, ///< [in] a valid host command-queue in which the write command
+    ///< will be queued. hQueue and hProgram must be created with the same
+    ///< UR context.
+    ur_program_handle_t
+        hProgram, ///< [in] a program object with a successfully built executable.
+    const char *
+        pipe_symbol, ///< [in] the name of the program scope pipe global variable.
+    bool
+        blocking, ///< [in] indicate if the read and write operations are blocking or
+                  ///< non-blocking.
+    void *
+        pSrc, ///< [in] a pointer to buffer in host memory that holds data to be written
+              ///< to the host pipe.
+    size_t size, ///< [in] size of the memory region to read or write, in bytes.
+    uint32_t numEventsInWaitList, ///< [in] number of events in the wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host pipe write.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] returns an event object that identifies this write command
+    ///< and can be used to query or queue a wait for this command to complete.
+) {
+    auto pfnWriteHostPipe = context.urDdiTable.Enqueue.pfnWriteHostPipe;
+
+    if (nullptr == pfnWriteHostPipe) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result =
+        pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc, size,
+                         numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE,
+                              "urEnqueueWriteHostPipe", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urBindlessImagesImageCopyExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *pDst,               ///< [in] location the data will be copied to
+    void *pSrc,               ///< [in] location the data will be copied from
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_exp_image_copy_flags_t
+        imageCopyFlags, ///< [in] flags describing copy direction e.g. H2D or D2H
+    ur_rect_offset_t
+        srcOffset, ///< [in] defines the (x,y,z) source offset in pixels in the 1D, 2D, or 3D
+                   ///< image
+    ur_rect_offset_t
+        dstOffset, ///< [in] defines the (x,y,z) destination offset in pixels in the 1D, 2D,
+                   ///< or 3D image
+    ur_rect_region_t
+        copyExtent, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                    ///< region to copy
+    ur_rect_region_t
+        hostExtent, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                    ///< region on the host
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnImageCopyExp = context.urDdiTable.BindlessImagesExp.pfnImageCopyExp;
+
+    if (nullptr == pfnImageCopyExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnImageCopyExp(
+        hQueue, pDst, pSrc, pImageFormat, pImageDesc, imageCopyFlags, srcOffset,
+        dstOffset, copyExtent, hostExtent, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
+                              "urBindlessImagesImageCopyExp", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urBindlessImagesWaitExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_interop_semaphore_handle_t
+        hSemaphore,               ///< [in] interop semaphore handle
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnWaitExternalSemaphoreExp =
+        context.urDdiTable.BindlessImagesExp.pfnWaitExternalSemaphoreExp;
+
+    if (nullptr == pfnWaitExternalSemaphoreExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnWaitExternalSemaphoreExp(
+        hQueue, hSemaphore, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(
+            UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
+            "urBindlessImagesWaitExternalSemaphoreExp", hQueue,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urBindlessImagesSignalExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_interop_semaphore_handle_t
+        hSemaphore,               ///< [in] interop semaphore handle
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnSignalExternalSemaphoreExp =
+        context.urDdiTable.BindlessImagesExp.pfnSignalExternalSemaphoreExp;
+
+    if (nullptr == pfnSignalExternalSemaphoreExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnSignalExternalSemaphoreExp(
+        hQueue, hSemaphore, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(
+            UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
+            "urBindlessImagesSignalExternalSemaphoreExp", hQueue,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferEnqueueExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t
+        hQueue, ///< [in] The queue to submit this command-buffer for execution.
+    uint32_t numEventsInWaitList, ///< [in] Size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the command-buffer execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command-buffer execution instance.
+) {
+    auto pfnEnqueueExp = context.urDdiTable.CommandBufferExp.pfnEnqueueExp;
+
+    if (nullptr == pfnEnqueueExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnEnqueueExp(
+        hCommandBuffer, hQueue, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP,
+                              "urCommandBufferEnqueueExp", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueCooperativeKernelLaunchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function.
+    ///< If nullptr, the runtime implementation will choose the work-group
+    ///< size.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnCooperativeKernelLaunchExp =
+        context.urDdiTable.EnqueueExp.pfnCooperativeKernelLaunchExp;
+
+    if (nullptr == pfnCooperativeKernelLaunchExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_result_t result = pfnCooperativeKernelLaunchExp(
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+
+    if (UR_RESULT_SUCCESS == result) {
+        context.recordCommand(UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
+                              "urEnqueueCooperativeKernelLaunchExp", hQueue,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's BindlessImagesExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_bindless_images_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_event_graph_layer::context.urDdiTable.BindlessImagesExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_event_graph_layer::context.version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_event_graph_layer::context.version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnImageCopyExp = pDdiTable->pfnImageCopyExp;
+    pDdiTable->pfnImageCopyExp =
+        ur_event_graph_layer::urBindlessImagesImageCopyExp;
+
+    dditable.pfnWaitExternalSemaphoreExp =
+        pDdiTable->pfnWaitExternalSemaphoreExp;
+    pDdiTable->pfnWaitExternalSemaphoreExp =
+        ur_event_graph_layer::urBindlessImagesWaitExternalSemaphoreExp;
+
+    dditable.pfnSignalExternalSemaphoreExp =
+        pDdiTable->pfnSignalExternalSemaphoreExp;
+    pDdiTable->pfnSignalExternalSemaphoreExp =
+        ur_event_graph_layer::urBindlessImagesSignalExternalSemaphoreExp;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's CommandBufferExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_command_buffer_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_event_graph_layer::context.urDdiTable.CommandBufferExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_event_graph_layer::context.version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_event_graph_layer::context.version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnEnqueueExp = pDdiTable->pfnEnqueueExp;
+    pDdiTable->pfnEnqueueExp = ur_event_graph_layer::urCommandBufferEnqueueExp;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Enqueue table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_enqueue_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_event_graph_layer::context.urDdiTable.Enqueue;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_event_graph_layer::context.version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_event_graph_layer::context.version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnKernelLaunch = pDdiTable->pfnKernelLaunch;
+    pDdiTable->pfnKernelLaunch = ur_event_graph_layer::urEnqueueKernelLaunch;
+
+    dditable.pfnEventsWait = pDdiTable->pfnEventsWait;
+    pDdiTable->pfnEventsWait = ur_event_graph_layer::urEnqueueEventsWait;
+
+    dditable.pfnEventsWaitWithBarrier = pDdiTable->pfnEventsWaitWithBarrier;
+    pDdiTable->pfnEventsWaitWithBarrier =
+        ur_event_graph_layer::urEnqueueEventsWaitWithBarrier;
+
+    dditable.pfnMemBufferRead = pDdiTable->pfnMemBufferRead;
+    pDdiTable->pfnMemBufferRead = ur_event_graph_layer::urEnqueueMemBufferRead;
+
+    dditable.pfnMemBufferWrite = pDdiTable->pfnMemBufferWrite;
+    pDdiTable->pfnMemBufferWrite =
+        ur_event_graph_layer::urEnqueueMemBufferWrite;
+
+    dditable.pfnMemBufferReadRect = pDdiTable->pfnMemBufferReadRect;
+    pDdiTable->pfnMemBufferReadRect =
+        ur_event_graph_layer::urEnqueueMemBufferReadRect;
+
+    dditable.pfnMemBufferWriteRect = pDdiTable->pfnMemBufferWriteRect;
+    pDdiTable->pfnMemBufferWriteRect =
+        ur_event_graph_layer::urEnqueueMemBufferWriteRect;
+
+    dditable.pfnMemBufferCopy = pDdiTable->pfnMemBufferCopy;
+    pDdiTable->pfnMemBufferCopy = ur_event_graph_layer::urEnqueueMemBufferCopy;
+
+    dditable.pfnMemBufferCopyRect = pDdiTable->pfnMemBufferCopyRect;
+    pDdiTable->pfnMemBufferCopyRect =
+        ur_event_graph_layer::urEnqueueMemBufferCopyRect;
+
+    dditable.pfnMemBufferFill = pDdiTable->pfnMemBufferFill;
+    pDdiTable->pfnMemBufferFill = ur_event_graph_layer::urEnqueueMemBufferFill;
+
+    dditable.pfnMemImageRead = pDdiTable->pfnMemImageRead;
+    pDdiTable->pfnMemImageRead = ur_event_graph_layer::urEnqueueMemImageRead;
+
+    dditable.pfnMemImageWrite = pDdiTable->pfnMemImageWrite;
+    pDdiTable->pfnMemImageWrite = ur_event_graph_layer::urEnqueueMemImageWrite;
+
+    dditable.pfnMemImageCopy = pDdiTable->pfnMemImageCopy;
+    pDdiTable->pfnMemImageCopy = ur_event_graph_layer::urEnqueueMemImageCopy;
+
+    dditable.pfnMemBufferMap = pDdiTable->pfnMemBufferMap;
+    pDdiTable->pfnMemBufferMap = ur_event_graph_layer::urEnqueueMemBufferMap;
+
+    dditable.pfnMemUnmap = pDdiTable->pfnMemUnmap;
+    pDdiTable->pfnMemUnmap = ur_event_graph_layer::urEnqueueMemUnmap;
+
+    dditable.pfnUSMFill = pDdiTable->pfnUSMFill;
+    pDdiTable->pfnUSMFill = ur_event_graph_layer::urEnqueueUSMFill;
+
+    dditable.pfnUSMMemcpy = pDdiTable->pfnUSMMemcpy;
+    pDdiTable->pfnUSMMemcpy = ur_event_graph_layer::urEnqueueUSMMemcpy;
+
+    dditable.pfnUSMPrefetch = pDdiTable->pfnUSMPrefetch;
+    pDdiTable->pfnUSMPrefetch = ur_event_graph_layer::urEnqueueUSMPrefetch;
+
+    dditable.pfnUSMAdvise = pDdiTable->pfnUSMAdvise;
+    pDdiTable->pfnUSMAdvise = ur_event_graph_layer::urEnqueueUSMAdvise;
+
+    dditable.pfnUSMFill2D = pDdiTable->pfnUSMFill2D;
+    pDdiTable->pfnUSMFill2D = ur_event_graph_layer::urEnqueueUSMFill2D;
+
+    dditable.pfnUSMMemcpy2D = pDdiTable->pfnUSMMemcpy2D;
+    pDdiTable->pfnUSMMemcpy2D = ur_event_graph_layer::urEnqueueUSMMemcpy2D;
+
+    dditable.pfnDeviceGlobalVariableWrite =
+        pDdiTable->pfnDeviceGlobalVariableWrite;
+    pDdiTable->pfnDeviceGlobalVariableWrite =
+        ur_event_graph_layer::urEnqueueDeviceGlobalVariableWrite;
+
+    dditable.pfnDeviceGlobalVariableRead =
+        pDdiTable->pfnDeviceGlobalVariableRead;
+    pDdiTable->pfnDeviceGlobalVariableRead =
+        ur_event_graph_layer::urEnqueueDeviceGlobalVariableRead;
+
+    dditable.pfnReadHostPipe = pDdiTable->pfnReadHostPipe;
+    pDdiTable->pfnReadHostPipe = ur_event_graph_layer::urEnqueueReadHostPipe;
+
+    dditable.pfnWriteHostPipe = pDdiTable->pfnWriteHostPipe;
+    pDdiTable->pfnWriteHostPipe = ur_event_graph_layer::urEnqueueWriteHostPipe;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EnqueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_enqueue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_event_graph_layer::context.urDdiTable.EnqueueExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_event_graph_layer::context.version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_event_graph_layer::context.version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnCooperativeKernelLaunchExp =
+        pDdiTable->pfnCooperativeKernelLaunchExp;
+    pDdiTable->pfnCooperativeKernelLaunchExp =
+        ur_event_graph_layer::urEnqueueCooperativeKernelLaunchExp;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Queue table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetQueueProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_event_graph_layer::context.urDdiTable.Queue;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_event_graph_layer::context.version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_event_graph_layer::context.version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnRetain = pDdiTable->pfnRetain;
+    pDdiTable->pfnRetain = ur_event_graph_layer::urQueueRetain;
+
+    dditable.pfnRelease = pDdiTable->pfnRelease;
+    pDdiTable->pfnRelease = ur_event_graph_layer::urQueueRelease;
+
+    return result;
+}
+
+ur_result_t context_t::init(ur_dditable_t *dditable,
+                            const std::set<std::string> &enabledLayerNames,
+                            codeloc_data) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    if (!enabledLayerNames.count(name)) {
+        return result;
+    }
+
+    // The layer queries events and queues directly, keep the complete
+    // table of the layers below.
+    ur_event_graph_layer::context.urDdiTable = *dditable;
+    ur_event_graph_layer::context.enabled = true;
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_event_graph_layer::urGetBindlessImagesExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->BindlessImagesExp);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_event_graph_layer::urGetCommandBufferExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->CommandBufferExp);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_event_graph_layer::urGetEnqueueProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->Enqueue);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_event_graph_layer::urGetEnqueueExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->EnqueueExp);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_event_graph_layer::urGetQueueProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->Queue);
+    }
+
+    return result;
+}
+} /* namespace ur_event_graph_layer */
@@ -46,6 +46,20 @@ uptr MemToShadow_CPU(uptr USM_SHADOW_BASE, uptr UPtr) {
     return USM_SHADOW_BASE + (UPtr >> 3);
 }
 
+void RetainShadow_CPU(const AllocInfo &AI) {
+    RetainShadowMem(
+        MemToShadow_CPU(LOW_SHADOW_BEGIN, AI.AllocBegin),
+        MemToShadow_CPU(LOW_SHADOW_BEGIN, AI.AllocBegin + AI.AllocSize - 1) +
+            1);
+}
+
+void ReleaseShadow_CPU(const AllocInfo &AI) {
+    ReleaseShadowMem(
+        MemToShadow_CPU(LOW_SHADOW_BEGIN, AI.AllocBegin),
+        MemToShadow_CPU(LOW_SHADOW_BEGIN, AI.AllocBegin + AI.AllocSize - 1) +
+            1);
+}
+
 uptr MemToShadow_PVC(uptr USM_SHADOW_BASE, uptr UPtr) {
     if (UPtr & 0xFF00000000000000ULL) { // Device USM
         return USM_SHADOW_BASE + 0x200000000000ULL +
@@ -190,8 +204,25 @@ ur_result_t SanitizerInterceptor::allocateMemory(
 
     *ResultPtr = reinterpret_cast<void *>(UserBegin);
 
-    auto AI = std::make_shared<AllocInfo>(
-        AllocInfo{AllocBegin, UserBegin, UserEnd, NeededSize, Type});
+    // Host USM is poisoned on all devices, it uses the shadow of the layer if
+    // any of them is a CPU.
+    bool IsShadowRetained = false;
+    if (!m_IsInASanContext) {
+        if (DeviceInfo) {
+            IsShadowRetained = DeviceInfo->Type == DeviceType::CPU;
+        } else {
+            std::shared_lock<ur_shared_mutex> Guard(ContextInfo->Mutex);
+            for (auto &pair : ContextInfo->DeviceMap) {
+                IsShadowRetained |= pair.second->Type == DeviceType::CPU;
+            }
+        }
+    }
+
+    auto AI = std::make_shared<AllocInfo>(AllocInfo{
+        AllocBegin, UserBegin, UserEnd, NeededSize, Type, IsShadowRetained});
+    if (IsShadowRetained) {
+        RetainShadow_CPU(*AI);
+    }
 
     // For updating shadow memory
     if (DeviceInfo) { // device/shared USM
@@ -211,7 +242,8 @@ ur_result_t SanitizerInterceptor::allocateMemory(
         ContextInfo->AllocatedUSMMap[AllocBegin] = std::move(AI);
     }
 
-    context.logger.info(
+    UR_LOG_RATE_LIMITED(
+        context.logger, logger::Level::INFO,
         "AllocInfos(AllocBegin={},  User={}-{}, NeededSize={}, Type={})",
         (void *)AllocBegin, (void *)UserBegin, (void *)UserEnd, NeededSize,
         ToString(Type));
@@ -223,29 +255,51 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
                                                 void *Ptr) {
     auto ContextInfo = getContextInfo(Context);
 
-    std::shared_lock<ur_shared_mutex> Guard(ContextInfo->Mutex);
+    std::shared_ptr<AllocInfo> AllocInfo;
+    std::vector<std::shared_ptr<DeviceInfo>> DeviceInfos;
+    {
+        std::scoped_lock<ur_shared_mutex> Guard(ContextInfo->Mutex);
 
-    auto Addr = reinterpret_cast<uptr>(Ptr);
-    // Find the last element is not greater than key
-    auto AllocInfoIt = ContextInfo->AllocatedUSMMap.upper_bound((uptr)Addr);
-    if (AllocInfoIt == ContextInfo->AllocatedUSMMap.begin()) {
-        context.logger.error(
-            "Can't find release pointer({}) in AllocatedAddressesMap", Ptr);
-        return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        auto Addr = reinterpret_cast<uptr>(Ptr);
+        // Find the last element is not greater than key
+        auto AllocInfoIt = ContextInfo->AllocatedUSMMap.upper_bound((uptr)Addr);
+        if (AllocInfoIt == ContextInfo->AllocatedUSMMap.begin()) {
+            context.logger.error(
+                "Can't find release pointer({}) in AllocatedAddressesMap", Ptr);
+            return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        --AllocInfoIt;
+        AllocInfo = AllocInfoIt->second;
+
+        context.logger.debug("USMAllocInfo(AllocBegin={}, UserBegin={})",
+                             AllocInfo->AllocBegin, AllocInfo->UserBegin);
+
+        if (Addr != AllocInfo->UserBegin) {
+            context.logger.error("Releasing pointer({}) is not match to {}",
+                                 Ptr, AllocInfo->UserBegin);
+            return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+
+        ContextInfo->AllocatedUSMMap.erase(AllocInfoIt);
+        for (auto &pair : ContextInfo->DeviceMap) {
+            DeviceInfos.push_back(pair.second);
+        }
     }
-    --AllocInfoIt;
-    auto &AllocInfo = AllocInfoIt->second;
 
-    context.logger.debug("USMAllocInfo(AllocBegin={}, UserBegin={})",
-                         AllocInfo->AllocBegin, AllocInfo->UserBegin);
+    // Don't poison the shadow of the allocation if no kernel was launched
+    // since it was made, that would make the pages resident again.
+    for (auto &DeviceInfo : DeviceInfos) {
+        std::scoped_lock<ur_shared_mutex> Guard(DeviceInfo->Mutex);
+        auto &AllocInfos = DeviceInfo->AllocInfos;
+        AllocInfos.erase(
+            std::remove(AllocInfos.begin(), AllocInfos.end(), AllocInfo),
+            AllocInfos.end());
+    }
 
-    if (Addr != AllocInfo->UserBegin) {
-        context.logger.error("Releasing pointer({}) is not match to {}", Ptr,
-                             AllocInfo->UserBegin);
-        return UR_RESULT_ERROR_INVALID_ARGUMENT;
+    if (AllocInfo->IsShadowRetained) {
+        ReleaseShadow_CPU(*AllocInfo);
     }
 
-    // TODO: Update shadow memory
     return context.urDdiTable.USM.pfnFree(Context,
                                           (void *)AllocInfo->AllocBegin);
 }
@@ -618,11 +672,18 @@ SanitizerInterceptor::registerDeviceGlobals(ur_context_handle_t Context,
 
         auto ContextInfo = getContextInfo(Context);
         auto DeviceInfo = ContextInfo->getDeviceInfo(Device);
+        // Device globals live as long as the program, their shadow is never
+        // released.
+        bool IsShadowRetained =
+            !m_IsInASanContext && DeviceInfo->Type == DeviceType::CPU;
         for (size_t i = 0; i < NumOfDeviceGlobal; i++) {
             auto AI = std::make_shared<AllocInfo>(AllocInfo{
                 GVInfos[i].Addr, GVInfos[i].Addr,
                 GVInfos[i].Addr + GVInfos[i].Size, GVInfos[i].SizeWithRedZone,
-                AllocType::DEVICE_GLOBAL});
+                AllocType::DEVICE_GLOBAL, IsShadowRetained});
+            if (IsShadowRetained) {
+                RetainShadow_CPU(*AI);
+            }
 
             std::scoped_lock<ur_shared_mutex> Guard(DeviceInfo->Mutex);
             DeviceInfo->AllocInfos.emplace_back(AI);
@@ -760,7 +821,8 @@ ur_result_t SanitizerInterceptor::prepareLaunch(ur_queue_handle_t Queue,
         auto LocalShadowMemorySize =
             (numWorkgroup * LocalMemorySize) >> ASAN_SHADOW_SCALE;
 
-        context.logger.info("LocalInfo(WorkGroup={}, LocalMemorySize={}, "
+        UR_LOG_RATE_LIMITED(context.logger, logger::Level::INFO,
+                            "LocalInfo(WorkGroup={}, LocalMemorySize={}, "
                             "LocalShadowMemorySize={})",
                             numWorkgroup, LocalMemorySize,
                             LocalShadowMemorySize);
@@ -801,7 +863,8 @@ ur_result_t SanitizerInterceptor::prepareLaunch(ur_queue_handle_t Queue,
             LastEvent = NewEvent;
         }
 
-        context.logger.info("ShadowMemory(Local, {} - {})",
+        UR_LOG_RATE_LIMITED(context.logger, logger::Level::INFO,
+                            "ShadowMemory(Local, {} - {})",
                             (void *)LaunchInfo.LocalShadowOffset,
                             (void *)LaunchInfo.LocalShadowOffsetEnd);
     } while (false);
@@ -36,6 +36,8 @@ struct AllocInfo {
     uptr UserEnd;
     size_t AllocSize;
     AllocType Type;
+    // Whether the allocation holds references on its CPU shadow pages
+    bool IsShadowRetained;
 };
 
 enum class DeviceType { UNKNOWN, CPU, GPU_PVC, GPU_DG2 };
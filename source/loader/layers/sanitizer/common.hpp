@@ -106,6 +106,18 @@ bool SetupShadowMem();
 
 bool DestroyShadowMem();
 
+// Marks the CPU shadow pages in [ShadowBegin, ShadowEnd) as used by a live
+// allocation.
+void RetainShadowMem(uptr ShadowBegin, uptr ShadowEnd);
+
+// Drops the references taken by RetainShadowMem. Pages which no live
+// allocation uses anymore are returned to the system in batches, they read as
+// zero afterwards.
+void ReleaseShadowMem(uptr ShadowBegin, uptr ShadowEnd);
+
+// Number of CPU shadow pages used by live allocations.
+size_t GetRetainedShadowPages();
+
 void *GetMemFunctionPointer(const char *);
 
 std::string DemangleName(const std::string &name);
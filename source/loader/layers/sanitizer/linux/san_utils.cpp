@@ -14,12 +14,15 @@
 #include "common.hpp"
 #include "ur_sanitizer_layer.hpp"
 
+#include <algorithm>
 #include <asm/param.h>
 #include <cxxabi.h>
 #include <dlfcn.h>
 #include <gnu/lib-names.h>
 #include <string>
 #include <sys/mman.h>
+#include <unordered_map>
+#include <vector>
 
 extern "C" __attribute__((weak)) void __asan_init(void);
 
@@ -27,6 +30,70 @@ namespace ur_sanitizer_layer {
 
 bool IsInASanContext() { return (void *)__asan_init != nullptr; }
 
+namespace {
+
+// Unused shadow pages are returned to the system once there are this many, so
+// that freeing small allocations doesn't cost a madvise each.
+constexpr size_t SHADOW_RECLAIM_BATCH_PAGES = 256;
+
+struct ShadowPages {
+    ur_mutex Mutex;
+    // Number of live allocations using each shadow page, by page address.
+    std::unordered_map<uptr, u32> RefCounts;
+    // Pages whose count dropped to zero since the last reclaim.
+    std::vector<uptr> Unused;
+};
+
+ShadowPages &getShadowPages() {
+    static ShadowPages Pages;
+    return Pages;
+}
+
+bool IsInShadow(uptr Addr) {
+    return (Addr >= LOW_SHADOW_BEGIN && Addr <= LOW_SHADOW_END) ||
+           (Addr >= HIGH_SHADOW_BEGIN && Addr <= HIGH_SHADOW_END);
+}
+
+void ReclaimUnusedPages(ShadowPages &Pages) {
+    auto &Unused = Pages.Unused;
+    std::sort(Unused.begin(), Unused.end());
+    Unused.erase(std::unique(Unused.begin(), Unused.end()), Unused.end());
+
+    size_t Reclaimed = 0;
+    uptr RangeBegin = 0;
+    uptr RangeEnd = 0;
+    auto Reclaim = [&]() {
+        if (RangeBegin == RangeEnd) {
+            return;
+        }
+        if (madvise((void *)RangeBegin, RangeEnd - RangeBegin,
+                    MADV_DONTNEED) != 0) {
+            context.logger.warning("Failed to reclaim shadow memory {} - {}",
+                                   (void *)RangeBegin, (void *)RangeEnd);
+        } else {
+            Reclaimed += RangeEnd - RangeBegin;
+        }
+    };
+
+    // Coalesce adjacent pages, skipping those used again by a new allocation.
+    for (auto Page : Unused) {
+        if (Pages.RefCounts.count(Page)) {
+            continue;
+        }
+        if (Page != RangeEnd) {
+            Reclaim();
+            RangeBegin = Page;
+        }
+        RangeEnd = Page + EXEC_PAGESIZE;
+    }
+    Reclaim();
+    Unused.clear();
+
+    context.logger.debug("Reclaimed {} bytes of shadow memory", Reclaimed);
+}
+
+} // namespace
+
 static bool ReserveShadowMem(uptr Addr, uptr Size) {
     Size = RoundUpTo(Size, EXEC_PAGESIZE);
     Addr = RoundDownTo(Addr, EXEC_PAGESIZE);
@@ -73,6 +140,42 @@ bool DestroyShadowMem() {
     return true;
 }
 
+void RetainShadowMem(uptr ShadowBegin, uptr ShadowEnd) {
+    auto &Pages = getShadowPages();
+    std::scoped_lock<ur_mutex> Guard(Pages.Mutex);
+    for (uptr Page = RoundDownTo(ShadowBegin, EXEC_PAGESIZE); Page < ShadowEnd;
+         Page += EXEC_PAGESIZE) {
+        if (IsInShadow(Page)) {
+            Pages.RefCounts[Page]++;
+        }
+    }
+}
+
+void ReleaseShadowMem(uptr ShadowBegin, uptr ShadowEnd) {
+    auto &Pages = getShadowPages();
+    std::scoped_lock<ur_mutex> Guard(Pages.Mutex);
+    for (uptr Page = RoundDownTo(ShadowBegin, EXEC_PAGESIZE); Page < ShadowEnd;
+         Page += EXEC_PAGESIZE) {
+        auto It = Pages.RefCounts.find(Page);
+        if (It == Pages.RefCounts.end()) {
+            continue;
+        }
+        if (--It->second == 0) {
+            Pages.RefCounts.erase(It);
+            Pages.Unused.push_back(Page);
+        }
+    }
+    if (Pages.Unused.size() >= SHADOW_RECLAIM_BATCH_PAGES) {
+        ReclaimUnusedPages(Pages);
+    }
+}
+
+size_t GetRetainedShadowPages() {
+    auto &Pages = getShadowPages();
+    std::scoped_lock<ur_mutex> Guard(Pages.Mutex);
+    return Pages.RefCounts.size();
+}
+
 void *GetMemFunctionPointer(const char *FuncName) {
     void *handle = dlopen(LIBC_SO, RTLD_LAZY | RTLD_NOLOAD);
     if (!handle) {
@@ -0,0 +1,264 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_stats.cpp
+ *
+ */
+
+#include "ur_stats.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ur_stats_layer {
+
+constexpr auto SEGMENT_PREFIX = "ur_stats.";
+
+std::string segmentName(uint32_t pid) {
+    return "/" + std::string(SEGMENT_PREFIX) + std::to_string(pid);
+}
+
+std::vector<uint32_t> listSegments() {
+    std::vector<uint32_t> pids;
+    DIR *dir = opendir("/dev/shm");
+    if (!dir) {
+        return pids;
+    }
+    size_t prefixLength = strlen(SEGMENT_PREFIX);
+    while (auto *entry = readdir(dir)) {
+        const char *name = entry->d_name;
+        if (strncmp(name, SEGMENT_PREFIX, prefixLength) != 0) {
+            continue;
+        }
+        char *end = nullptr;
+        unsigned long pid = strtoul(name + prefixLength, &end, 10);
+        if (end != name + prefixLength && *end == '\0') {
+            pids.push_back(static_cast<uint32_t>(pid));
+        }
+    }
+    closedir(dir);
+    std::sort(pids.begin(), pids.end());
+    return pids;
+}
+
+uint32_t latencyBucket(uint64_t ns) {
+    // Number of significant bits, 0 for 0ns.
+    uint32_t bucket = 0;
+    while (ns) {
+        bucket++;
+        ns >>= 1;
+    }
+    return std::min(bucket, LATENCY_BUCKETS - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+segment_mapping_t segment_mapping_t::create(uint32_t pid) {
+    segment_mapping_t mapping;
+    mapping.name = segmentName(pid);
+
+    // A segment left behind by a crashed process with a recycled pid.
+    shm_unlink(mapping.name.c_str());
+    int fd = shm_open(mapping.name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        return mapping;
+    }
+    if (ftruncate(fd, sizeof(segment_t)) != 0) {
+        close(fd);
+        shm_unlink(mapping.name.c_str());
+        return mapping;
+    }
+    void *addr = mmap(nullptr, sizeof(segment_t), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        shm_unlink(mapping.name.c_str());
+        return mapping;
+    }
+
+    // The new pages are zeroed, which is the initial value of all counters.
+    auto segment = static_cast<segment_t *>(addr);
+    segment->version = SEGMENT_VERSION;
+    segment->pid = pid;
+    segment->createTimeNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    // Readers check the magic last.
+    std::atomic_thread_fence(std::memory_order_release);
+    segment->magic = SEGMENT_MAGIC;
+
+    mapping.segment = segment;
+    mapping.owner = true;
+    return mapping;
+}
+
+segment_mapping_t segment_mapping_t::attach(uint32_t pid) {
+    segment_mapping_t mapping;
+    mapping.name = segmentName(pid);
+
+    int fd = shm_open(mapping.name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return mapping;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(segment_t)) {
+        close(fd);
+        return mapping;
+    }
+    void *addr = mmap(nullptr, sizeof(segment_t), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return mapping;
+    }
+
+    auto segment = static_cast<segment_t *>(addr);
+    if (segment->magic != SEGMENT_MAGIC ||
+        segment->version != SEGMENT_VERSION) {
+        munmap(addr, sizeof(segment_t));
+        return mapping;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    mapping.segment = segment;
+    return mapping;
+}
+
+segment_mapping_t::segment_mapping_t(segment_mapping_t &&other)
+    : segment(other.segment), name(std::move(other.name)),
+      owner(other.owner) {
+    other.segment = nullptr;
+    other.owner = false;
+}
+
+segment_mapping_t &segment_mapping_t::operator=(segment_mapping_t &&other) {
+    if (this != &other) {
+        reset();
+        segment = other.segment;
+        name = std::move(other.name);
+        owner = other.owner;
+        other.segment = nullptr;
+        other.owner = false;
+    }
+    return *this;
+}
+
+segment_mapping_t::~segment_mapping_t() { reset(); }
+
+void segment_mapping_t::reset() {
+    if (segment) {
+        munmap(segment, sizeof(segment_t));
+        segment = nullptr;
+    }
+    // Viewers which are attached keep their mapping, only the name goes.
+    if (owner) {
+        shm_unlink(name.c_str());
+        owner = false;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void counters_snapshot_t::add(const counters_t &counters) {
+    calls += counters.calls.load(std::memory_order_relaxed);
+    errors += counters.errors.load(std::memory_order_relaxed);
+    totalNs += counters.totalNs.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < LATENCY_BUCKETS; i++) {
+        latency[i] += counters.latency[i].load(std::memory_order_relaxed);
+    }
+}
+
+counters_snapshot_t
+counters_snapshot_t::operator-(const counters_snapshot_t &earlier) const {
+    // The counters are read one by one while other threads update them, so
+    // clamp at zero rather than wrap around.
+    auto sub = [](uint64_t a, uint64_t b) { return a > b ? a - b : 0; };
+
+    counters_snapshot_t delta;
+    delta.calls = sub(calls, earlier.calls);
+    delta.errors = sub(errors, earlier.errors);
+    delta.totalNs = sub(totalNs, earlier.totalNs);
+    for (uint32_t i = 0; i < LATENCY_BUCKETS; i++) {
+        delta.latency[i] = sub(latency[i], earlier.latency[i]);
+    }
+    return delta;
+}
+
+uint64_t counters_snapshot_t::percentileNs(double percentile) const {
+    uint64_t count = 0;
+    for (auto bucketCount : latency) {
+        count += bucketCount;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    auto rank = static_cast<uint64_t>(percentile / 100.0 * count);
+    rank = std::clamp<uint64_t>(rank, 1, count);
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < LATENCY_BUCKETS; i++) {
+        if (latency[i] == 0) {
+            continue;
+        }
+        if (seen + latency[i] >= rank) {
+            if (i == 0) {
+                return 0;
+            }
+            // Interpolate linearly within [2^(i-1), 2^i).
+            uint64_t low = uint64_t(1) << (i - 1);
+            double fraction = double(rank - seen) / double(latency[i]);
+            return low + static_cast<uint64_t>(fraction * double(low));
+        }
+        seen += latency[i];
+    }
+    return uint64_t(1) << (LATENCY_BUCKETS - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+snapshot_t snapshot_t::read(const segment_t &segment) {
+    snapshot_t snapshot;
+    snapshot.threadCount =
+        std::min(segment.threadCount.load(std::memory_order_acquire),
+                 MAX_THREADS);
+    snapshot.functions.resize(MAX_FUNCTIONS);
+    for (uint32_t t = 0; t < snapshot.threadCount; t++) {
+        for (uint32_t f = 0; f < MAX_FUNCTIONS; f++) {
+            snapshot.functions[f].add(segment.threads[t].functions[f]);
+        }
+    }
+
+    uint32_t queueCount = std::min(
+        segment.queueCount.load(std::memory_order_acquire), MAX_QUEUES);
+    for (uint32_t q = 0; q < queueCount; q++) {
+        auto &slot = segment.queues[q];
+        uint64_t handle = slot.handle.load(std::memory_order_acquire);
+        if (!handle) {
+            continue;
+        }
+        queue_snapshot_t queue;
+        queue.handle = handle;
+        queue.backend = static_cast<ur_platform_backend_t>(
+            slot.backend.load(std::memory_order_relaxed));
+        queue.counters.add(slot.counters);
+        snapshot.queues.push_back(queue);
+    }
+
+    snapshot.backends.resize(MAX_BACKENDS);
+    for (uint32_t b = 0; b < MAX_BACKENDS; b++) {
+        snapshot.backends[b].add(segment.backends[b]);
+    }
+    return snapshot;
+}
+
+} // namespace ur_stats_layer
@@ -0,0 +1,151 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_stats.hpp
+ *
+ */
+
+#ifndef UR_STATS_HPP
+#define UR_STATS_HPP 1
+
+#include "ur_api.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ur_stats_layer {
+
+constexpr uint64_t SEGMENT_MAGIC = 0x3153544154535255; // "URSTATS1"
+constexpr uint32_t SEGMENT_VERSION = 1;
+
+// Calls of functions with a larger ur_function_t are not recorded.
+constexpr uint32_t MAX_FUNCTIONS = 256;
+// Threads past the last slot share it.
+constexpr uint32_t MAX_THREADS = 64;
+// Queues created past the last slot are not recorded.
+constexpr uint32_t MAX_QUEUES = 256;
+// Indexed by ur_platform_backend_t.
+constexpr uint32_t MAX_BACKENDS = 8;
+// Bucket 0 counts calls under 1ns, bucket N calls in [2^(N-1), 2^N) ns and
+// the last bucket everything above.
+constexpr uint32_t LATENCY_BUCKETS = 40;
+
+// Everything in the segment is only ever incremented, readers compute rates
+// from the difference between two snapshots.
+struct counters_t {
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> errors;
+    std::atomic<uint64_t> totalNs;
+    std::atomic<uint64_t> latency[LATENCY_BUCKETS];
+};
+
+struct queue_slot_t {
+    // Set once the slot is claimed, with release ordering.
+    std::atomic<uint64_t> handle;
+    std::atomic<uint32_t> backend;
+    uint32_t reserved;
+    counters_t counters;
+};
+
+struct thread_slot_t {
+    std::atomic<uint64_t> tid;
+    counters_t functions[MAX_FUNCTIONS];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Layout of the shared memory segment.
+///
+/// Written by a single process, read by any number of viewers mapping it
+/// read-only. Viewers never write to the segment nor signal the process, so
+/// attaching and detaching does not affect it.
+struct segment_t {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t pid;
+    // Wall clock time the segment was created at, in nanoseconds.
+    uint64_t createTimeNs;
+    std::atomic<uint32_t> threadCount;
+    std::atomic<uint32_t> queueCount;
+    counters_t backends[MAX_BACKENDS];
+    queue_slot_t queues[MAX_QUEUES];
+    thread_slot_t threads[MAX_THREADS];
+};
+
+// Name of the segment of a process, passed to shm_open. On Linux the segment
+// shows up as /dev/shm/ur_stats.<pid>.
+std::string segmentName(uint32_t pid);
+
+// Returns the pids of the processes which have a segment.
+std::vector<uint32_t> listSegments();
+
+uint32_t latencyBucket(uint64_t ns);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Maps a segment, either creating it for writing or attaching to the
+///        segment of another process for reading.
+class segment_mapping_t {
+  public:
+    static segment_mapping_t create(uint32_t pid);
+    static segment_mapping_t attach(uint32_t pid);
+
+    segment_mapping_t() = default;
+    segment_mapping_t(segment_mapping_t &&other);
+    segment_mapping_t &operator=(segment_mapping_t &&other);
+    segment_mapping_t(const segment_mapping_t &) = delete;
+    segment_mapping_t &operator=(const segment_mapping_t &) = delete;
+    // Unmaps the segment, and removes it if it was created by this mapping.
+    ~segment_mapping_t();
+
+    segment_t *get() const { return segment; }
+    explicit operator bool() const { return segment != nullptr; }
+
+  private:
+    void reset();
+
+    segment_t *segment = nullptr;
+    std::string name;
+    bool owner = false;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Plain copy of a counters_t, summed over threads.
+struct counters_snapshot_t {
+    uint64_t calls = 0;
+    uint64_t errors = 0;
+    uint64_t totalNs = 0;
+    std::array<uint64_t, LATENCY_BUCKETS> latency = {};
+
+    void add(const counters_t &counters);
+    counters_snapshot_t operator-(const counters_snapshot_t &earlier) const;
+
+    // Estimated from the histogram, percentile in [0, 100].
+    uint64_t percentileNs(double percentile) const;
+};
+
+struct queue_snapshot_t {
+    uint64_t handle;
+    ur_platform_backend_t backend;
+    counters_snapshot_t counters;
+};
+
+struct snapshot_t {
+    // Indexed by ur_function_t.
+    std::vector<counters_snapshot_t> functions;
+    std::vector<queue_snapshot_t> queues;
+    std::vector<counters_snapshot_t> backends;
+    uint32_t threadCount = 0;
+
+    static snapshot_t read(const segment_t &segment);
+};
+
+} // namespace ur_stats_layer
+
+#endif /* UR_STATS_HPP */
@@ -0,0 +1,205 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_stats_layer.cpp
+ *
+ */
+
+#include "ur_stats_layer.hpp"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace ur_stats_layer {
+context_t context;
+
+namespace {
+struct thread_state_t {
+    uint64_t generation = 0;
+    thread_slot_t *slot = nullptr;
+    // Whether other threads write to the slot too.
+    bool shared = false;
+    // Last queue the thread recorded a call on.
+    ur_queue_handle_t hQueue = nullptr;
+    queue_slot_t *queueSlot = nullptr;
+};
+
+thread_local thread_state_t threadState;
+
+// Slots owned by a single thread don't need atomic read-modify-writes, which
+// keeps the cost of a call at a few uncontended stores.
+void bump(std::atomic<uint64_t> &counter, uint64_t value, bool shared) {
+    if (shared) {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    } else {
+        counter.store(counter.load(std::memory_order_relaxed) + value,
+                      std::memory_order_relaxed);
+    }
+}
+
+void bump(counters_t &counters, uint64_t ns, bool error, bool shared) {
+    bump(counters.calls, 1, shared);
+    if (error) {
+        bump(counters.errors, 1, shared);
+    }
+    bump(counters.totalNs, ns, shared);
+    bump(counters.latency[latencyBucket(ns)], 1, shared);
+}
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::context_t() : logger(logger::create_logger("stats")) {}
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::~context_t() {}
+
+thread_slot_t *context_t::getThreadSlot() {
+    auto &state = threadState;
+    uint64_t current = generation.load(std::memory_order_acquire);
+    if (state.generation == current) {
+        return state.slot;
+    }
+
+    segment_t *segment = mapping.get();
+    if (!segment) {
+        return nullptr;
+    }
+    uint32_t index = segment->threadCount.load(std::memory_order_relaxed);
+    do {
+        if (index >= MAX_THREADS) {
+            break;
+        }
+    } while (!segment->threadCount.compare_exchange_weak(
+        index, index + 1, std::memory_order_release,
+        std::memory_order_relaxed));
+
+    state = thread_state_t{};
+    state.generation = current;
+    if (index < MAX_THREADS) {
+        state.slot = &segment->threads[index];
+        state.slot->tid.store(syscall(SYS_gettid), std::memory_order_relaxed);
+    } else {
+        // Too many threads, the remaining ones share the last slot.
+        state.slot = &segment->threads[MAX_THREADS - 1];
+        state.shared = true;
+    }
+    if (index == MAX_THREADS - 1) {
+        state.shared = true;
+    }
+    return state.slot;
+}
+
+ur_platform_backend_t context_t::queryBackend(ur_queue_handle_t hQueue) {
+    ur_device_handle_t hDevice = nullptr;
+    ur_platform_handle_t hPlatform = nullptr;
+    ur_platform_backend_t backend = UR_PLATFORM_BACKEND_UNKNOWN;
+    if (urDdiTable.Queue.pfnGetInfo(hQueue, UR_QUEUE_INFO_DEVICE,
+                                    sizeof(hDevice), &hDevice,
+                                    nullptr) != UR_RESULT_SUCCESS ||
+        urDdiTable.Device.pfnGetInfo(hDevice, UR_DEVICE_INFO_PLATFORM,
+                                     sizeof(hPlatform), &hPlatform,
+                                     nullptr) != UR_RESULT_SUCCESS ||
+        urDdiTable.Platform.pfnGetInfo(hPlatform, UR_PLATFORM_INFO_BACKEND,
+                                       sizeof(backend), &backend,
+                                       nullptr) != UR_RESULT_SUCCESS) {
+        return UR_PLATFORM_BACKEND_UNKNOWN;
+    }
+    return backend;
+}
+
+queue_slot_t *context_t::getQueueSlot(ur_function_t function,
+                                      ur_queue_handle_t hQueue) {
+    auto &state = threadState;
+    if (state.hQueue == hQueue) {
+        return state.queueSlot;
+    }
+
+    std::scoped_lock<std::mutex> lock(queuesMutex);
+    auto it = queues.find(hQueue);
+    if (it == queues.end()) {
+        // The queue may already be destroyed, don't query it.
+        if (function == UR_FUNCTION_QUEUE_RELEASE) {
+            return nullptr;
+        }
+        // A handle reused by a new queue keeps the slot of the old one, the
+        // segment has no room to track queue lifetimes.
+        segment_t *segment = mapping.get();
+        uint32_t index = segment->queueCount.load(std::memory_order_relaxed);
+        queue_slot_t *slot = nullptr;
+        if (index < MAX_QUEUES) {
+            slot = &segment->queues[index];
+            slot->backend.store(queryBackend(hQueue),
+                                std::memory_order_relaxed);
+            slot->handle.store(reinterpret_cast<uintptr_t>(hQueue),
+                               std::memory_order_release);
+            segment->queueCount.store(index + 1, std::memory_order_release);
+        }
+        it = queues.emplace(hQueue, slot).first;
+    }
+
+    state.hQueue = hQueue;
+    state.queueSlot = it->second;
+    return it->second;
+}
+
+void context_t::record(ur_function_t function, uint64_t start,
+                       ur_result_t result, ur_queue_handle_t hQueue) {
+    uint64_t ns = now() - start;
+    bool error = result != UR_RESULT_SUCCESS;
+
+    thread_slot_t *slot = getThreadSlot();
+    if (!slot) {
+        return;
+    }
+    if (static_cast<uint32_t>(function) < MAX_FUNCTIONS) {
+        bump(slot->functions[function], ns, error, threadState.shared);
+    }
+
+    if (hQueue) {
+        if (queue_slot_t *queueSlot = getQueueSlot(function, hQueue)) {
+            bump(queueSlot->counters, ns, error, true);
+            uint32_t backend =
+                queueSlot->backend.load(std::memory_order_relaxed);
+            if (backend < MAX_BACKENDS) {
+                bump(mapping.get()->backends[backend], ns, error, true);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ur_result_t context_t::tearDown() {
+    if (!enabled) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    if (auto segment = mapping.get()) {
+        auto snapshot = snapshot_t::read(*segment);
+        uint64_t calls = 0;
+        uint64_t errors = 0;
+        for (auto &function : snapshot.functions) {
+            calls += function.calls;
+            errors += function.errors;
+        }
+        logger.info("Recorded {} calls, {} errors, on {} threads and {} "
+                    "queues",
+                    calls, errors, snapshot.threadCount,
+                    snapshot.queues.size());
+    }
+
+    // The loader only initializes the layers once and the intercepts stay in
+    // the dispatch table, so make threads drop their cached slots before the
+    // segment goes away. Calls made after the teardown are not recorded.
+    generation.fetch_add(1, std::memory_order_release);
+    queues.clear();
+    mapping = segment_mapping_t{};
+    enabled = false;
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace ur_stats_layer
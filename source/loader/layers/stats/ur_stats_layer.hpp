@@ -0,0 +1,75 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_stats_layer.hpp
+ *
+ */
+
+#ifndef UR_STATS_LAYER_H
+#define UR_STATS_LAYER_H 1
+
+#include "logger/ur_logger.hpp"
+#include "ur_ddi.h"
+#include "ur_proxy_layer.hpp"
+#include "ur_stats.hpp"
+#include "ur_util.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+namespace ur_stats_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+class __urdlllocal context_t : public proxy_layer_context_t {
+  public:
+    ur_dditable_t urDdiTable = {};
+    logger::Logger logger;
+    bool enabled = false;
+
+    context_t();
+    ~context_t();
+
+    bool isAvailable() const override { return true; }
+    std::vector<std::string> getNames() const override { return {name}; }
+    ur_result_t init(ur_dditable_t *dditable,
+                     const std::set<std::string> &enabledLayerNames,
+                     codeloc_data codelocData) override;
+    ur_result_t tearDown() override;
+
+    static uint64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // Records a call which started at start and returned result, and
+    // attributes it to hQueue and its adapter when given.
+    void record(ur_function_t function, uint64_t start, ur_result_t result,
+                ur_queue_handle_t hQueue = nullptr);
+
+  private:
+    thread_slot_t *getThreadSlot();
+    queue_slot_t *getQueueSlot(ur_function_t function,
+                               ur_queue_handle_t hQueue);
+    ur_platform_backend_t queryBackend(ur_queue_handle_t hQueue);
+
+    const std::string name = "UR_LAYER_STATS";
+
+    segment_mapping_t mapping;
+    // Bumped on every init, so threads claim a new slot in a new segment.
+    std::atomic<uint64_t> generation = 0;
+
+    std::mutex queuesMutex;
+    std::unordered_map<ur_queue_handle_t, queue_slot_t *> queues;
+};
+
+extern context_t context;
+} // namespace ur_stats_layer
+
+#endif /* UR_STATS_LAYER_H */
@@ -6069,6 +6069,31 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelCloneExp
+__urdlllocal ur_result_t UR_APICALL urKernelCloneExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object to clone
+    ur_kernel_handle_t
+        *phKernelClone ///< [out] pointer to handle of the cloned kernel object
+) {
+    auto pfnCloneExp = context.urDdiTable.KernelExp.pfnCloneExp;
+
+    if (nullptr == pfnCloneExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_kernel_clone_exp_params_t params = {&hKernel, &phKernelClone};
+    uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_CLONE_EXP,
+                                             "urKernelCloneExp", &params);
+
+    ur_result_t result = pfnCloneExp(hKernel, phKernelClone);
+
+    context.notify_end(UR_FUNCTION_KERNEL_CLONE_EXP, "urKernelCloneExp",
+                       &params, &result, instance);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urProgramBuildExp
 __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
@@ -6165,6 +6190,95 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_program_handle_t hProgram, ///< [in] handle of the program object
+    const char *pOptions,         ///< [in][optional] string of build options
+    ur_exp_program_build_callback_t
+        pfnNotify, ///< [in] callback called once the build has finished
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to pfnNotify
+) {
+    auto pfnBuildAsyncExp = context.urDdiTable.ProgramExp.pfnBuildAsyncExp;
+
+    if (nullptr == pfnBuildAsyncExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_program_build_async_exp_params_t params = {
+        &hContext, &hProgram, &pOptions, &pfnNotify, &pUserData};
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP, "urProgramBuildAsyncExp", &params);
+
+    ur_result_t result =
+        pfnBuildAsyncExp(hContext, hProgram, pOptions, pfnNotify, pUserData);
+
+    context.notify_end(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP,
+                       "urProgramBuildAsyncExp", &params, &result, instance);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMExportExp
+__urdlllocal ur_result_t UR_APICALL urUSMExportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem, ///< [in] pointer to the start of the USM allocation
+    ur_exp_usm_export_type_t exportType, ///< [in] type of OS handle to return
+    ur_native_handle_t *phOsHandle       ///< [out] OS handle of the allocation
+) {
+    auto pfnExportExp = context.urDdiTable.USMExp.pfnExportExp;
+
+    if (nullptr == pfnExportExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_usm_export_exp_params_t params = {&hContext, &pMem, &exportType,
+                                         &phOsHandle};
+    uint64_t instance = context.notify_begin(UR_FUNCTION_USM_EXPORT_EXP,
+                                             "urUSMExportExp", &params);
+
+    ur_result_t result = pfnExportExp(hContext, pMem, exportType, phOsHandle);
+
+    context.notify_end(UR_FUNCTION_USM_EXPORT_EXP, "urUSMExportExp", &params,
+                       &result, instance);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMImportHandleExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportHandleExp(
+    ur_context_handle_t hContext,        ///< [in] handle of the context object
+    ur_exp_usm_export_type_t exportType, ///< [in] type of hOsHandle
+    ur_native_handle_t
+        hOsHandle, ///< [in][nocheck] OS handle returned by ::urUSMExportExp in the exporting
+                   ///< process
+    size_t size,   ///< [in] size in bytes of the exported allocation
+    void **ppMem   ///< [out] pointer to the imported memory
+) {
+    auto pfnImportHandleExp = context.urDdiTable.USMExp.pfnImportHandleExp;
+
+    if (nullptr == pfnImportHandleExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ur_usm_import_handle_exp_params_t params = {&hContext, &exportType,
+                                                &hOsHandle, &size, &ppMem};
+    uint64_t instance = context.notify_begin(UR_FUNCTION_USM_IMPORT_HANDLE_EXP,
+                                             "urUSMImportHandleExp", &params);
+
+    ur_result_t result =
+        pfnImportHandleExp(hContext, exportType, hOsHandle, size, ppMem);
+
+    context.notify_end(UR_FUNCTION_USM_IMPORT_HANDLE_EXP,
+                       "urUSMImportHandleExp", &params, &result, instance);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urUSMImportExp
 __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
@@ -6944,6 +7058,9 @@ __urdlllocal ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
         ur_tracing_layer::urKernelSuggestMaxCooperativeGroupCountExp;
 
+    dditable.pfnCloneExp = pDdiTable->pfnCloneExp;
+    pDdiTable->pfnCloneExp = ur_tracing_layer::urKernelCloneExp;
+
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
@@ -7210,6 +7327,9 @@ __urdlllocal ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     dditable.pfnLinkExp = pDdiTable->pfnLinkExp;
     pDdiTable->pfnLinkExp = ur_tracing_layer::urProgramLinkExp;
 
+    dditable.pfnBuildAsyncExp = pDdiTable->pfnBuildAsyncExp;
+    pDdiTable->pfnBuildAsyncExp = ur_tracing_layer::urProgramBuildAsyncExp;
+
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
@@ -7404,6 +7524,12 @@ __urdlllocal ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     dditable.pfnPitchedAllocExp = pDdiTable->pfnPitchedAllocExp;
     pDdiTable->pfnPitchedAllocExp = ur_tracing_layer::urUSMPitchedAllocExp;
 
+    dditable.pfnExportExp = pDdiTable->pfnExportExp;
+    pDdiTable->pfnExportExp = ur_tracing_layer::urUSMExportExp;
+
+    dditable.pfnImportHandleExp = pDdiTable->pfnImportHandleExp;
+    pDdiTable->pfnImportHandleExp = ur_tracing_layer::urUSMImportHandleExp;
+
     dditable.pfnImportExp = pDdiTable->pfnImportExp;
     pDdiTable->pfnImportExp = ur_tracing_layer::urUSMImportExp;
 
@@ -0,0 +1,97 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_usdt.hpp
+ *
+ */
+
+#ifndef UR_USDT_HPP
+#define UR_USDT_HPP 1
+
+#include <cstdint>
+
+// Semaphores of the probes, incremented by the kernel for as long as a tracer
+// is attached to the probe. Named the way sys/sdt.h expects them.
+#define UR_USDT_SEMAPHORE(probe) ur_##probe##_semaphore
+
+extern "C" {
+extern volatile unsigned short UR_USDT_SEMAPHORE(function_begin);
+extern volatile unsigned short UR_USDT_SEMAPHORE(function_end);
+}
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define UR_USDT_SYS_SDT 1
+#elif defined(__x86_64__) || defined(__aarch64__)
+#define UR_USDT_INLINE_NOTE 1
+#endif
+#endif
+
+#if UR_USDT_SYS_SDT
+
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+#define UR_USDT_PROBE3(probe, a1, a2, a3) STAP_PROBE3(ur, probe, a1, a2, a3)
+#define UR_USDT_PROBE4(probe, a1, a2, a3, a4)                                  \
+    STAP_PROBE4(ur, probe, a1, a2, a3, a4)
+
+#elif UR_USDT_INLINE_NOTE
+
+// Same probe site and ELF note as sys/sdt.h generates, for toolchains which
+// don't ship it. The arguments are always passed as 8 byte registers.
+#define UR_USDT_NOTE(probe, args)                                              \
+    "990: nop\n"                                                               \
+    ".pushsection .note.stapsdt,\"?\",\"note\"\n"                              \
+    ".balign 4\n"                                                              \
+    ".4byte 992f-991f, 994f-993f, 3\n"                                         \
+    "991: .asciz \"stapsdt\"\n"                                                \
+    "992: .balign 4\n"                                                         \
+    "993: .8byte 990b\n"                                                       \
+    ".8byte _.stapsdt.base\n"                                                  \
+    ".8byte ur_" #probe "_semaphore\n"                                         \
+    ".asciz \"ur\"\n"                                                          \
+    ".asciz \"" #probe "\"\n"                                                  \
+    ".asciz \"" args "\"\n"                                                    \
+    "994: .balign 4\n"                                                         \
+    ".popsection\n"                                                            \
+    ".ifndef _.stapsdt.base\n"                                                 \
+    ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"    \
+    ".weak _.stapsdt.base\n"                                                   \
+    ".hidden _.stapsdt.base\n"                                                 \
+    "_.stapsdt.base: .space 1\n"                                               \
+    ".size _.stapsdt.base, 1\n"                                                \
+    ".popsection\n"                                                            \
+    ".endif\n"
+
+#define UR_USDT_ARG(a) "r"((uint64_t)(a))
+
+#define UR_USDT_PROBE3(probe, a1, a2, a3)                                      \
+    __asm__ __volatile__(UR_USDT_NOTE(probe, "8@%0 8@%1 8@%2")                 \
+                         :                                                     \
+                         : UR_USDT_ARG(a1), UR_USDT_ARG(a2), UR_USDT_ARG(a3))
+#define UR_USDT_PROBE4(probe, a1, a2, a3, a4)                                  \
+    __asm__ __volatile__(UR_USDT_NOTE(probe, "8@%0 8@%1 8@%2 -8@%3")           \
+                         :                                                     \
+                         : UR_USDT_ARG(a1), UR_USDT_ARG(a2), UR_USDT_ARG(a3),  \
+                           "r"((int64_t)(a4)))
+
+#endif
+
+#if UR_USDT_SYS_SDT || UR_USDT_INLINE_NOTE
+// Builds the probe arguments only while a tracer is attached, otherwise a
+// probe site costs a load, a not taken branch and a nop.
+#define UR_USDT_ENABLED(probe) __builtin_expect(UR_USDT_SEMAPHORE(probe), 0)
+#else
+#define UR_USDT_ENABLED(probe) false
+#define UR_USDT_PROBE3(probe, a1, a2, a3) ((void)(a1), (void)(a2), (void)(a3))
+#define UR_USDT_PROBE4(probe, a1, a2, a3, a4)                                  \
+    ((void)(a1), (void)(a2), (void)(a3), (void)(a4))
+#endif
+
+#endif /* UR_USDT_HPP */
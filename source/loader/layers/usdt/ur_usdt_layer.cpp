@@ -0,0 +1,44 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_usdt_layer.cpp
+ *
+ */
+
+#include "ur_usdt_layer.hpp"
+
+#if UR_USDT_SYS_SDT || UR_USDT_INLINE_NOTE
+// Tracers find the semaphores through the probe notes and expect them in the
+// .probes section, they don't need to be exported.
+#define UR_USDT_SEMAPHORE_ATTRS                                                \
+    __attribute__((section(".probes"), visibility("hidden")))
+
+extern "C" {
+UR_USDT_SEMAPHORE_ATTRS volatile unsigned short
+    UR_USDT_SEMAPHORE(function_begin) = 0;
+UR_USDT_SEMAPHORE_ATTRS volatile unsigned short
+    UR_USDT_SEMAPHORE(function_end) = 0;
+}
+#endif
+
+namespace ur_usdt_layer {
+context_t context;
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::context_t() : logger(logger::create_logger("usdt")) {}
+
+///////////////////////////////////////////////////////////////////////////////
+context_t::~context_t() {}
+
+///////////////////////////////////////////////////////////////////////////////
+ur_result_t context_t::tearDown() {
+    enabled = false;
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace ur_usdt_layer
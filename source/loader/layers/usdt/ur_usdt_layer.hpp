@@ -0,0 +1,48 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_usdt_layer.hpp
+ *
+ */
+
+#ifndef UR_USDT_LAYER_H
+#define UR_USDT_LAYER_H 1
+
+#include "logger/ur_logger.hpp"
+#include "ur_ddi.h"
+#include "ur_proxy_layer.hpp"
+#include "ur_usdt.hpp"
+#include "ur_util.hpp"
+
+namespace ur_usdt_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+class __urdlllocal context_t : public proxy_layer_context_t {
+  public:
+    ur_dditable_t urDdiTable = {};
+    logger::Logger logger;
+    bool enabled = false;
+
+    context_t();
+    ~context_t();
+
+    bool isAvailable() const override { return true; }
+    std::vector<std::string> getNames() const override { return {name}; }
+    ur_result_t init(ur_dditable_t *dditable,
+                     const std::set<std::string> &enabledLayerNames,
+                     codeloc_data codelocData) override;
+    ur_result_t tearDown() override;
+
+  private:
+    const std::string name = "UR_LAYER_USDT";
+};
+
+extern context_t context;
+} // namespace ur_usdt_layer
+
+#endif /* UR_USDT_LAYER_H */
@@ -73,7 +73,8 @@ struct RefCountContext {
             break;
         case REFCOUNT_INCREASE:
             if (it == counts.end()) {
-                context.logger.error(
+                UR_LOG_RATE_LIMITED(
+                    context.logger, logger::Level::ERR,
                     "Attempting to retain nonexistent handle {}", ptr);
                 return;
             } else {
@@ -90,7 +91,8 @@ struct RefCountContext {
             }
 
             if (it->second.refCount < 0) {
-                context.logger.error(
+                UR_LOG_RATE_LIMITED(
+                    context.logger, logger::Level::ERR,
                     "Attempting to release nonexistent handle {}", ptr);
             } else if (it->second.refCount == 0 && isAdapterHandle) {
                 adapterCount--;
@@ -120,7 +120,10 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("global");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -134,7 +137,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hAdapter)) {
         refCountContext.logInvalidReference(hAdapter);
     }
@@ -165,7 +168,10 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("global");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -187,7 +193,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hAdapter)) {
         refCountContext.logInvalidReference(hAdapter);
     }
@@ -259,7 +265,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("platform");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -299,7 +308,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("platform");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -327,7 +339,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("platform");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -387,7 +402,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("platform");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -483,7 +501,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("device");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -505,7 +526,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -590,7 +611,10 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("device");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -604,7 +628,7 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -635,7 +659,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("device");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -653,7 +680,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -677,7 +704,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("device");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -687,7 +717,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -753,13 +783,16 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("device");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -887,7 +920,10 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("context");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -909,7 +945,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -933,7 +969,10 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("context");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -943,7 +982,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -1009,7 +1048,10 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("context");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1019,7 +1061,7 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -1233,7 +1275,10 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("mem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1255,7 +1300,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -1281,7 +1326,10 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("mem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1295,12 +1343,12 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hMem)) {
         refCountContext.logInvalidReference(hMem);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -1430,7 +1478,10 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("mem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hMemory) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1452,7 +1503,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hMemory)) {
         refCountContext.logInvalidReference(hMemory);
     }
@@ -1485,7 +1536,10 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("mem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hMemory) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1507,7 +1561,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hMemory)) {
         refCountContext.logInvalidReference(hMemory);
     }
@@ -1642,7 +1696,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("sampler");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1664,7 +1721,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hSampler)) {
         refCountContext.logInvalidReference(hSampler);
     }
@@ -1688,7 +1745,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("sampler");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1698,7 +1758,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hSampler)) {
         refCountContext.logInvalidReference(hSampler);
     }
@@ -1769,7 +1829,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1792,12 +1855,12 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(pool)) {
         refCountContext.logInvalidReference(pool);
     }
@@ -1826,7 +1889,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1853,17 +1919,17 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(pool)) {
         refCountContext.logInvalidReference(pool);
     }
@@ -1893,7 +1959,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1920,17 +1989,17 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(pool)) {
         refCountContext.logInvalidReference(pool);
     }
@@ -1953,7 +2022,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1963,7 +2035,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -1994,7 +2066,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2008,7 +2083,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -2136,7 +2211,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hPool) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2158,7 +2236,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hPool)) {
         refCountContext.logInvalidReference(hPool);
     }
@@ -2195,7 +2273,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("virtualmem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2217,12 +2298,12 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -2253,7 +2334,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("virtualmem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2263,7 +2347,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -2287,7 +2371,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("virtualmem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2297,7 +2384,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -2327,7 +2414,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("virtualmem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2345,12 +2435,12 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hPhysicalMem)) {
         refCountContext.logInvalidReference(hPhysicalMem);
     }
@@ -2375,7 +2465,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("virtualmem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2385,7 +2478,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -2411,7 +2504,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("virtualmem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2425,7 +2521,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -2459,7 +2555,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("virtualmem");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2473,7 +2572,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -2737,7 +2836,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2747,12 +2849,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -2777,7 +2879,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2787,12 +2892,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -2820,7 +2925,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2838,7 +2946,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -2922,7 +3030,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2940,12 +3051,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -2978,7 +3089,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3000,7 +3114,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -3035,7 +3149,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3049,12 +3166,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -3081,7 +3198,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3095,7 +3215,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -3119,7 +3239,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3129,7 +3252,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -3241,7 +3364,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3251,7 +3377,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -3278,13 +3404,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -3318,7 +3447,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3331,7 +3463,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (UR_KERNEL_INFO_NUM_REGS < propName) {
+        if (UR_KERNEL_INFO_VARIANT_EXP < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -3340,7 +3472,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -3372,7 +3504,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3386,12 +3521,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -3423,7 +3558,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3437,12 +3575,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -3522,13 +3660,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -3557,7 +3698,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3571,7 +3715,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -3597,7 +3741,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3607,12 +3754,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hArgValue)) {
         refCountContext.logInvalidReference(hArgValue);
     }
@@ -3638,7 +3785,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3649,12 +3799,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hArgValue)) {
         refCountContext.logInvalidReference(hArgValue);
     }
@@ -3680,7 +3830,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3694,7 +3847,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -3718,7 +3871,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3728,7 +3884,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -3811,7 +3967,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("queue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3833,7 +3992,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -3976,7 +4135,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("queue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3986,7 +4148,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -4060,13 +4222,16 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("queue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -4087,13 +4252,16 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("queue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -4120,7 +4288,10 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("event");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4142,7 +4313,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hEvent)) {
         refCountContext.logInvalidReference(hEvent);
     }
@@ -4173,12 +4344,15 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("event");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (UR_PROFILING_INFO_COMMAND_COMPLETE < propName) {
+        if (UR_PROFILING_INFO_BRANCH_MISSES_EXP < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -4187,7 +4361,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hEvent)) {
         refCountContext.logInvalidReference(hEvent);
     }
@@ -4212,7 +4386,10 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("event");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == phEventWaitList) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
@@ -4292,7 +4469,10 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("event");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4302,7 +4482,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hEvent)) {
         refCountContext.logInvalidReference(hEvent);
     }
@@ -4370,7 +4550,10 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("event");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4388,7 +4571,7 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hEvent)) {
         refCountContext.logInvalidReference(hEvent);
     }
@@ -4436,7 +4619,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4470,12 +4656,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -4508,7 +4694,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4530,7 +4719,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -4563,7 +4752,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4585,7 +4777,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -4622,7 +4814,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4657,12 +4852,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -4702,7 +4897,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4737,12 +4935,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -4792,7 +4990,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4867,12 +5068,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -4927,7 +5128,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5002,12 +5206,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -5047,7 +5251,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5087,17 +5294,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBufferSrc)) {
         refCountContext.logInvalidReference(hBufferSrc);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBufferDst)) {
         refCountContext.logInvalidReference(hBufferDst);
     }
@@ -5145,7 +5352,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5221,17 +5431,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBufferSrc)) {
         refCountContext.logInvalidReference(hBufferSrc);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBufferDst)) {
         refCountContext.logInvalidReference(hBufferDst);
     }
@@ -5270,7 +5480,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5325,12 +5538,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -5373,7 +5586,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5412,12 +5628,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hImage)) {
         refCountContext.logInvalidReference(hImage);
     }
@@ -5461,7 +5677,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5500,12 +5719,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hImage)) {
         refCountContext.logInvalidReference(hImage);
     }
@@ -5550,7 +5769,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5594,17 +5816,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hImageSrc)) {
         refCountContext.logInvalidReference(hImageSrc);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hImageDst)) {
         refCountContext.logInvalidReference(hImageDst);
     }
@@ -5644,7 +5866,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5683,12 +5908,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -5723,7 +5948,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5753,12 +5981,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hMem)) {
         refCountContext.logInvalidReference(hMem);
     }
@@ -5798,7 +6026,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5849,7 +6080,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -5887,7 +6118,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5931,7 +6165,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -5967,7 +6201,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6006,7 +6243,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -6036,7 +6273,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6059,7 +6299,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -6102,7 +6342,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6169,7 +6412,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -6213,7 +6456,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6273,7 +6519,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -6315,7 +6561,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6349,12 +6598,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -6396,7 +6645,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6430,12 +6682,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -6480,7 +6732,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6514,12 +6769,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -6564,7 +6819,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6598,12 +6856,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -6638,7 +6896,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6669,17 +6930,17 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(pool)) {
         refCountContext.logInvalidReference(pool);
     }
@@ -6707,7 +6968,10 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6721,12 +6985,12 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -6753,7 +7017,10 @@ urBindlessImagesSampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6767,12 +7034,12 @@ urBindlessImagesSampledImageHandleDestroyExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -6801,7 +7068,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6827,12 +7097,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -6857,7 +7127,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6871,12 +7144,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -7079,7 +7352,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7117,7 +7393,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -7145,7 +7421,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hImageMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7183,7 +7462,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7201,12 +7483,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -7231,7 +7513,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7245,12 +7530,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -7278,7 +7563,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportOpaqueFDExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7296,12 +7584,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportOpaqueFDExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -7332,7 +7620,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7362,12 +7653,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -7393,7 +7684,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseInteropExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7407,12 +7701,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseInteropExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -7441,7 +7735,10 @@ urBindlessImagesImportExternalSemaphoreOpaqueFDExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7459,12 +7756,12 @@ urBindlessImagesImportExternalSemaphoreOpaqueFDExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -7490,7 +7787,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesDestroyExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7504,12 +7804,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesDestroyExternalSemaphoreExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDevice)) {
         refCountContext.logInvalidReference(hDevice);
     }
@@ -7544,7 +7844,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7562,7 +7865,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -7597,7 +7900,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("bindlessimages");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7615,7 +7921,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -7684,7 +7990,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7707,7 +8016,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7730,7 +8042,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7770,7 +8085,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7800,7 +8118,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -7835,7 +8153,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7892,7 +8213,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7961,7 +8285,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7983,12 +8310,12 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hSrcMem)) {
         refCountContext.logInvalidReference(hSrcMem);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDstMem)) {
         refCountContext.logInvalidReference(hDstMem);
     }
@@ -8024,7 +8351,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8046,7 +8376,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -8081,7 +8411,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8103,7 +8436,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -8146,7 +8479,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8168,12 +8504,12 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hSrcMem)) {
         refCountContext.logInvalidReference(hSrcMem);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hDstMem)) {
         refCountContext.logInvalidReference(hDstMem);
     }
@@ -8223,7 +8559,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8245,7 +8584,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -8293,7 +8632,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8315,7 +8657,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -8353,7 +8695,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8375,7 +8720,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hBuffer)) {
         refCountContext.logInvalidReference(hBuffer);
     }
@@ -8409,7 +8754,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8464,7 +8812,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8519,7 +8870,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8545,7 +8899,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
@@ -8569,7 +8923,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8593,7 +8950,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8619,7 +8979,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8656,7 +9019,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8706,7 +9072,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("commandbuffer");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8772,7 +9141,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("enqueue");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8806,12 +9178,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hQueue)) {
         refCountContext.logInvalidReference(hQueue);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -8842,7 +9214,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("kernel");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8852,7 +9227,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hKernel)) {
         refCountContext.logInvalidReference(hKernel);
     }
@@ -8863,6 +9238,38 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelCloneExp
+__urdlllocal ur_result_t UR_APICALL urKernelCloneExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object to clone
+    ur_kernel_handle_t
+        *phKernelClone ///< [out] pointer to handle of the cloned kernel object
+) {
+    auto pfnCloneExp = context.urDdiTable.KernelExp.pfnCloneExp;
+
+    if (nullptr == pfnCloneExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (context.enableParameterValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phKernelClone) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    ur_result_t result = pfnCloneExp(hKernel, phKernelClone);
+
+    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        refCountContext.createRefCount(*phKernelClone);
+    }
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urProgramBuildExp
 __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
@@ -8879,7 +9286,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8889,7 +9299,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -8916,7 +9326,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8926,7 +9339,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hProgram)) {
         refCountContext.logInvalidReference(hProgram);
     }
@@ -8958,7 +9371,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8980,7 +9396,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -8991,6 +9407,150 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_program_handle_t hProgram, ///< [in] handle of the program object
+    const char *pOptions,         ///< [in][optional] string of build options
+    ur_exp_program_build_callback_t
+        pfnNotify, ///< [in] callback called once the build has finished
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to pfnNotify
+) {
+    auto pfnBuildAsyncExp = context.urDdiTable.ProgramExp.pfnBuildAsyncExp;
+
+    if (nullptr == pfnBuildAsyncExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    static auto &sampler = context.getSampler("program");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pfnNotify) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (validate && context.enableLifetimeValidation &&
+        !refCountContext.isReferenceValid(hContext)) {
+        refCountContext.logInvalidReference(hContext);
+    }
+
+    if (validate && context.enableLifetimeValidation &&
+        !refCountContext.isReferenceValid(hProgram)) {
+        refCountContext.logInvalidReference(hProgram);
+    }
+
+    ur_result_t result =
+        pfnBuildAsyncExp(hContext, hProgram, pOptions, pfnNotify, pUserData);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMExportExp
+__urdlllocal ur_result_t UR_APICALL urUSMExportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem, ///< [in] pointer to the start of the USM allocation
+    ur_exp_usm_export_type_t exportType, ///< [in] type of OS handle to return
+    ur_native_handle_t *phOsHandle       ///< [out] OS handle of the allocation
+) {
+    auto pfnExportExp = context.urDdiTable.USMExp.pfnExportExp;
+
+    if (nullptr == pfnExportExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phOsHandle) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (UR_EXP_USM_EXPORT_TYPE_FD < exportType) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (validate && context.enableLifetimeValidation &&
+        !refCountContext.isReferenceValid(hContext)) {
+        refCountContext.logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnExportExp(hContext, pMem, exportType, phOsHandle);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMImportHandleExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportHandleExp(
+    ur_context_handle_t hContext,        ///< [in] handle of the context object
+    ur_exp_usm_export_type_t exportType, ///< [in] type of hOsHandle
+    ur_native_handle_t
+        hOsHandle, ///< [in][nocheck] OS handle returned by ::urUSMExportExp in the exporting
+                   ///< process
+    size_t size,   ///< [in] size in bytes of the exported allocation
+    void **ppMem   ///< [out] pointer to the imported memory
+) {
+    auto pfnImportHandleExp = context.urDdiTable.USMExp.pfnImportHandleExp;
+
+    if (nullptr == pfnImportHandleExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (UR_EXP_USM_EXPORT_TYPE_FD < exportType) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+    }
+
+    if (validate && context.enableLifetimeValidation &&
+        !refCountContext.isReferenceValid(hContext)) {
+        refCountContext.logInvalidReference(hContext);
+    }
+
+    ur_result_t result =
+        pfnImportHandleExp(hContext, exportType, hOsHandle, size, ppMem);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urUSMImportExp
 __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
@@ -9004,7 +9564,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9014,7 +9577,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -9036,7 +9599,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usm");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9046,7 +9612,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(hContext)) {
         refCountContext.logInvalidReference(hContext);
     }
@@ -9070,7 +9636,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usmp2p");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9080,12 +9649,12 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(commandDevice)) {
         refCountContext.logInvalidReference(commandDevice);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(peerDevice)) {
         refCountContext.logInvalidReference(peerDevice);
     }
@@ -9109,7 +9678,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usmp2p");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9119,12 +9691,12 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(commandDevice)) {
         refCountContext.logInvalidReference(commandDevice);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(peerDevice)) {
         refCountContext.logInvalidReference(peerDevice);
     }
@@ -9159,7 +9731,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (context.enableParameterValidation) {
+    static auto &sampler = context.getSampler("usmp2p");
+    const bool validate = sampler.sample();
+
+    if (validate && context.enableParameterValidation) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9185,12 +9760,12 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         }
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(commandDevice)) {
         refCountContext.logInvalidReference(commandDevice);
     }
 
-    if (context.enableLifetimeValidation &&
+    if (validate && context.enableLifetimeValidation &&
         !refCountContext.isReferenceValid(peerDevice)) {
         refCountContext.logInvalidReference(peerDevice);
     }
@@ -9846,6 +10421,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
         ur_validation_layer::urKernelSuggestMaxCooperativeGroupCountExp;
 
+    dditable.pfnCloneExp = pDdiTable->pfnCloneExp;
+    pDdiTable->pfnCloneExp = ur_validation_layer::urKernelCloneExp;
+
     return result;
 }
 
@@ -10119,6 +10697,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     dditable.pfnLinkExp = pDdiTable->pfnLinkExp;
     pDdiTable->pfnLinkExp = ur_validation_layer::urProgramLinkExp;
 
+    dditable.pfnBuildAsyncExp = pDdiTable->pfnBuildAsyncExp;
+    pDdiTable->pfnBuildAsyncExp = ur_validation_layer::urProgramBuildAsyncExp;
+
     return result;
 }
 
@@ -10318,6 +10899,12 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     dditable.pfnPitchedAllocExp = pDdiTable->pfnPitchedAllocExp;
     pDdiTable->pfnPitchedAllocExp = ur_validation_layer::urUSMPitchedAllocExp;
 
+    dditable.pfnExportExp = pDdiTable->pfnExportExp;
+    pDdiTable->pfnExportExp = ur_validation_layer::urUSMExportExp;
+
+    dditable.pfnImportHandleExp = pDdiTable->pfnImportHandleExp;
+    pDdiTable->pfnImportHandleExp = ur_validation_layer::urUSMImportHandleExp;
+
     dditable.pfnImportExp = pDdiTable->pfnImportExp;
     pDdiTable->pfnImportExp = ur_validation_layer::urUSMImportExp;
 
@@ -10623,6 +11210,8 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
 ur_result_t context_t::tearDown() {
     ur_result_t result = UR_RESULT_SUCCESS;
 
+    logSamplingCounters();
+
     if (enableLeakChecking) {
         refCountContext.logInvalidReferences();
         refCountContext.clear();
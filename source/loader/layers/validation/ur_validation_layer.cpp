@@ -17,11 +17,59 @@ namespace ur_validation_layer {
 context_t context;
 
 ///////////////////////////////////////////////////////////////////////////////
-context_t::context_t() : logger(logger::create_logger("validation")) {}
+context_t::context_t() : logger(logger::create_logger("validation")) {
+    try {
+        auto config = getenv_to_map("UR_VALIDATION_SAMPLING");
+        if (config.has_value()) {
+            // Once sampling is configured, unlisted families are counted too.
+            defaultSamplingRate = 1;
+            for (auto &[family, values] : *config) {
+                auto rate = ur_parse_uint(values.front());
+                if (!rate || *rate == 0) {
+                    throw std::invalid_argument(
+                        "invalid rate '" + values.front() + "' for " +
+                        family + ", it must be an integer of at least 1");
+                }
+                if (family == "default") {
+                    defaultSamplingRate = *rate;
+                } else {
+                    samplingRates[family] = *rate;
+                }
+            }
+        }
+    } catch (std::exception &e) {
+        logger.error("Invalid UR_VALIDATION_SAMPLING value: {}", e.what());
+        samplingRates.clear();
+        defaultSamplingRate = 0;
+    }
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 context_t::~context_t() {}
 
+///////////////////////////////////////////////////////////////////////////////
+sampler_t &context_t::getSampler(const std::string &family) {
+    std::scoped_lock<std::mutex> lock(samplersMutex);
+    auto [it, inserted] = samplers.try_emplace(family);
+    if (inserted) {
+        auto rate = samplingRates.find(family);
+        it->second.setRate(rate != samplingRates.end() ? rate->second
+                                                       : defaultSamplingRate);
+    }
+    return it->second;
+}
+
+void context_t::logSamplingCounters() {
+    std::scoped_lock<std::mutex> lock(samplersMutex);
+    for (auto &[family, sampler] : samplers) {
+        if (uint64_t calls = sampler.getCalls()) {
+            uint64_t validated = sampler.getValidated();
+            logger.info("Validated {} and skipped {} of {} {} calls", validated,
+                        calls - validated, calls, family);
+        }
+    }
+}
+
 // Some adapters don't support all the queries yet, we should be lenient and
 // just not attempt to validate in those cases to preserve functionality.
 #define RETURN_ON_FAILURE(result)                                              \
@@ -15,8 +15,43 @@
 #include "ur_proxy_layer.hpp"
 #include "ur_util.hpp"
 
+#include <atomic>
+#include <map>
+#include <mutex>
+
 namespace ur_validation_layer {
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Decides which calls of a family of functions are validated.
+///
+/// With a rate of N, the first call and every Nth call after it are
+/// validated, a rate of 0 validates every call without counting it. Calls
+/// creating, retaining or releasing handles don't go through a sampler, so
+/// that lifetime tracking sees every handle.
+class sampler_t {
+  public:
+    bool sample() {
+        uint64_t n = rate.load(std::memory_order_relaxed);
+        if (n == 0) {
+            return true;
+        }
+        if (calls.fetch_add(1, std::memory_order_relaxed) % n) {
+            return false;
+        }
+        validated.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void setRate(uint64_t newRate) { rate = newRate; }
+    uint64_t getCalls() const { return calls; }
+    uint64_t getValidated() const { return validated; }
+
+  private:
+    std::atomic<uint64_t> rate{0};
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> validated{0};
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 class __urdlllocal context_t : public proxy_layer_context_t {
   public:
@@ -40,11 +75,24 @@ class __urdlllocal context_t : public proxy_layer_context_t {
                      codeloc_data codelocData) override;
     ur_result_t tearDown() override;
 
+    // Returns the sampler of a family of functions, named after their function
+    // table, e.g. "enqueue". The sampler lives as long as the layer.
+    sampler_t &getSampler(const std::string &family);
+
   private:
+    void logSamplingCounters();
+
     const std::string nameFullValidation = "UR_LAYER_FULL_VALIDATION";
     const std::string nameParameterValidation = "UR_LAYER_PARAMETER_VALIDATION";
     const std::string nameLeakChecking = "UR_LAYER_LEAK_CHECKING";
     const std::string nameLifetimeValidation = "UR_LAYER_LIFETIME_VALIDATION";
+
+    // Rates configured with UR_VALIDATION_SAMPLING, 0 if sampling is off.
+    std::map<std::string, uint64_t> samplingRates;
+    uint64_t defaultSamplingRate = 0;
+
+    std::mutex samplersMutex;
+    std::map<std::string, sampler_t> samplers;
 };
 
 ur_result_t bounds(ur_mem_handle_t buffer, size_t offset, size_t size);
@@ -0,0 +1,29 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_device_selector.hpp
+ *
+ */
+
+#ifndef UR_DEVICE_SELECTOR_HPP
+#define UR_DEVICE_SELECTOR_HPP 1
+
+#include "ur_api.h"
+
+namespace ur_lib {
+// Filters the devices of hPlatform with ONEAPI_DEVICE_SELECTOR. Devices are
+// queried through the public API, so that this also works without the loader
+// in the static single-adapter build.
+ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
+                                ur_device_type_t DeviceType,
+                                uint32_t NumEntries,
+                                ur_device_handle_t *phDevices,
+                                uint32_t *pNumDevices);
+} // namespace ur_lib
+
+#endif /* UR_DEVICE_SELECTOR_HPP */
@@ -0,0 +1,278 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_kernel_clone.cpp
+ *
+ */
+
+#include "ur_kernel_clone.hpp"
+#include "ur_loader.hpp"
+
+#include <string>
+
+namespace ur_loader {
+namespace kernel_clone {
+
+namespace {
+
+ur_result_t setArg(kernel_object_t *pKernel, uint32_t argIndex,
+                   kernel_arg_t &&arg) {
+    try {
+        std::scoped_lock<std::mutex> lock(pKernel->mutex);
+        pKernel->record.args[argIndex] = std::move(arg);
+    } catch (std::bad_alloc &) {
+        return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t replay(dditable_t *dditable, ur_kernel_handle_t hKernel,
+                   const kernel_record_t &record) {
+    auto &kernelDdi = dditable->ur.Kernel;
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    for (auto &[index, arg] : record.args) {
+        switch (arg.kind) {
+        case kernel_arg_t::VALUE:
+            result = kernelDdi.pfnSetArgValue(hKernel, index, arg.value.size(),
+                                              nullptr, arg.value.data());
+            break;
+        case kernel_arg_t::LOCAL:
+            result =
+                kernelDdi.pfnSetArgLocal(hKernel, index, arg.size, nullptr);
+            break;
+        case kernel_arg_t::POINTER:
+            result = kernelDdi.pfnSetArgPointer(hKernel, index, nullptr,
+                                                arg.pointer);
+            break;
+        case kernel_arg_t::MEM_OBJ:
+            result = kernelDdi.pfnSetArgMemObj(
+                hKernel, index,
+                arg.memProperties ? &*arg.memProperties : nullptr, arg.hMem);
+            break;
+        case kernel_arg_t::SAMPLER:
+            result = kernelDdi.pfnSetArgSampler(hKernel, index, nullptr,
+                                                arg.hSampler);
+            break;
+        }
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    for (auto &[propName, value] : record.execInfo) {
+        result = kernelDdi.pfnSetExecInfo(hKernel, propName, value.size(),
+                                          nullptr, value.data());
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    if (!record.specConstants.empty()) {
+        std::vector<ur_specialization_constant_info_t> specConstants;
+        specConstants.reserve(record.specConstants.size());
+        for (auto &[id, value] : record.specConstants) {
+            specConstants.push_back({id, value.size(), value.data()});
+        }
+        result = kernelDdi.pfnSetSpecializationConstants(
+            hKernel, static_cast<uint32_t>(specConstants.size()),
+            specConstants.data());
+    }
+
+    return result;
+}
+
+} // namespace
+
+ur_result_t urKernelSetArgValue(kernel_object_t *pKernel, uint32_t argIndex,
+                                size_t argSize,
+                                const ur_kernel_arg_value_properties_t *,
+                                const void *pArgValue) {
+    kernel_arg_t arg;
+    arg.kind = kernel_arg_t::VALUE;
+    auto bytes = static_cast<const char *>(pArgValue);
+    arg.value.assign(bytes, bytes + argSize);
+    return setArg(pKernel, argIndex, std::move(arg));
+}
+
+ur_result_t urKernelSetArgLocal(kernel_object_t *pKernel, uint32_t argIndex,
+                                size_t argSize,
+                                const ur_kernel_arg_local_properties_t *) {
+    kernel_arg_t arg;
+    arg.kind = kernel_arg_t::LOCAL;
+    arg.size = argSize;
+    return setArg(pKernel, argIndex, std::move(arg));
+}
+
+ur_result_t urKernelSetArgPointer(kernel_object_t *pKernel, uint32_t argIndex,
+                                  const ur_kernel_arg_pointer_properties_t *,
+                                  const void *pArgValue) {
+    kernel_arg_t arg;
+    arg.kind = kernel_arg_t::POINTER;
+    arg.pointer = pArgValue;
+    return setArg(pKernel, argIndex, std::move(arg));
+}
+
+ur_result_t urKernelSetArgSampler(kernel_object_t *pKernel, uint32_t argIndex,
+                                  const ur_kernel_arg_sampler_properties_t *,
+                                  ur_sampler_handle_t hArgValue) {
+    kernel_arg_t arg;
+    arg.kind = kernel_arg_t::SAMPLER;
+    arg.hSampler = hArgValue;
+    return setArg(pKernel, argIndex, std::move(arg));
+}
+
+ur_result_t
+urKernelSetArgMemObj(kernel_object_t *pKernel, uint32_t argIndex,
+                     const ur_kernel_arg_mem_obj_properties_t *pProperties,
+                     ur_mem_handle_t hArgValue) {
+    kernel_arg_t arg;
+    arg.kind = kernel_arg_t::MEM_OBJ;
+    arg.hMem = hArgValue;
+    if (pProperties) {
+        // The memory access flags matter for the replay, extensions chained
+        // through pNext can't be copied generically.
+        arg.memProperties = *pProperties;
+        arg.memProperties->pNext = nullptr;
+    }
+    return setArg(pKernel, argIndex, std::move(arg));
+}
+
+ur_result_t urKernelSetExecInfo(kernel_object_t *pKernel,
+                                ur_kernel_exec_info_t propName,
+                                size_t propSize,
+                                const ur_kernel_exec_info_properties_t *,
+                                const void *pPropValue) {
+    try {
+        auto bytes = static_cast<const char *>(pPropValue);
+        std::scoped_lock<std::mutex> lock(pKernel->mutex);
+        pKernel->record.execInfo[propName].assign(bytes, bytes + propSize);
+    } catch (std::bad_alloc &) {
+        return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urKernelSetSpecializationConstants(
+    kernel_object_t *pKernel, uint32_t count,
+    const ur_specialization_constant_info_t *pSpecConstants) {
+    try {
+        std::scoped_lock<std::mutex> lock(pKernel->mutex);
+        auto &specConstants = pKernel->record.specConstants;
+        for (uint32_t i = 0; i < count; i++) {
+            auto bytes = static_cast<const char *>(pSpecConstants[i].pValue);
+            specConstants[pSpecConstants[i].id].assign(
+                bytes, bytes + pSpecConstants[i].size);
+        }
+    } catch (std::bad_alloc &) {
+        return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+void retain(kernel_object_t *pKernel) { pKernel->refCount++; }
+
+ur_result_t urKernelRelease(kernel_object_t *pKernel) {
+    // The record is dropped before the release is forwarded: once the adapter
+    // destroyed the kernel, it may create another one at the same address,
+    // which gets this object.
+    std::optional<kernel_record_t> dropped;
+    uint32_t refCount = pKernel->refCount.load();
+    while (refCount > 0 && !pKernel->refCount.compare_exchange_weak(
+                               refCount, refCount - 1)) {
+    }
+    if (refCount == 1) {
+        std::scoped_lock<std::mutex> lock(pKernel->mutex);
+        dropped = std::move(pKernel->record);
+        pKernel->record = {};
+    }
+
+    auto result = pKernel->dditable->ur.Kernel.pfnRelease(pKernel->handle);
+    if (result != UR_RESULT_SUCCESS) {
+        // The kernel is still alive, and nothing else holds a reference.
+        if (dropped) {
+            std::scoped_lock<std::mutex> lock(pKernel->mutex);
+            pKernel->record = std::move(*dropped);
+        }
+        if (refCount > 0) {
+            pKernel->refCount++;
+        }
+    }
+    return result;
+}
+
+ur_result_t urKernelCloneExp(kernel_object_t *pKernel,
+                             ur_kernel_handle_t *phKernelClone) {
+    auto dditable = pKernel->dditable;
+    auto &kernelDdi = dditable->ur.Kernel;
+    if (nullptr == kernelDdi.pfnGetInfo || nullptr == kernelDdi.pfnCreate) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto hKernel = pKernel->handle;
+    ur_program_handle_t hProgram = nullptr;
+    auto result =
+        kernelDdi.pfnGetInfo(hKernel, UR_KERNEL_INFO_PROGRAM, sizeof(hProgram),
+                             &hProgram, nullptr);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    size_t nameSize = 0;
+    result = kernelDdi.pfnGetInfo(hKernel, UR_KERNEL_INFO_FUNCTION_NAME, 0,
+                                  nullptr, &nameSize);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    try {
+        std::vector<char> name(nameSize + 1, '\0');
+        result = kernelDdi.pfnGetInfo(hKernel, UR_KERNEL_INFO_FUNCTION_NAME,
+                                      nameSize, name.data(), nullptr);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+
+        // Copy the record so that the replay doesn't hold the lock while
+        // calling into the adapter.
+        kernel_record_t record;
+        {
+            std::scoped_lock<std::mutex> lock(pKernel->mutex);
+            record = pKernel->record;
+        }
+
+        ur_kernel_handle_t hClone = nullptr;
+        result = kernelDdi.pfnCreate(hProgram, name.data(), &hClone);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+
+        result = replay(dditable, hClone, record);
+        if (result != UR_RESULT_SUCCESS) {
+            kernelDdi.pfnRelease(hClone);
+            return result;
+        }
+
+        // The caller converts hClone to this same object.
+        auto pClone = reinterpret_cast<kernel_object_t *>(
+            ur_kernel_factory.getInstance(hClone, dditable));
+        {
+            std::scoped_lock<std::mutex> lock(pClone->mutex);
+            pClone->record = std::move(record);
+        }
+        pClone->refCount++;
+        *phKernelClone = hClone;
+    } catch (std::bad_alloc &) {
+        return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace kernel_clone
+} // namespace ur_loader
@@ -0,0 +1,122 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_kernel_clone.hpp
+ *
+ */
+
+#ifndef UR_LOADER_KERNEL_CLONE_HPP
+#define UR_LOADER_KERNEL_CLONE_HPP 1
+
+#include "ur_object.hpp"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace ur_loader {
+namespace kernel_clone {
+
+// Emulation of urKernelCloneExp for adapters which do not implement it.
+// Kernel objects don't allow reading their arguments back, so the loader
+// records every successful urKernelSetArg*, urKernelSetExecInfo and
+// urKernelSetSpecializationConstants call on such adapters in the loader's
+// kernel object, and replays them on a new kernel created from the same
+// program and function name. Recording needs loader objects, so the
+// emulation is only available when the loader intercepts the calls.
+
+struct kernel_arg_t {
+    enum kind_t { VALUE, LOCAL, POINTER, MEM_OBJ, SAMPLER };
+
+    kind_t kind = VALUE;
+    // Bytes of a value argument.
+    std::vector<char> value;
+    // Size of a local argument.
+    size_t size = 0;
+    const void *pointer = nullptr;
+    ur_mem_handle_t hMem = nullptr;
+    std::optional<ur_kernel_arg_mem_obj_properties_t> memProperties;
+    ur_sampler_handle_t hSampler = nullptr;
+};
+
+struct kernel_record_t {
+    // Ordered maps so that the replay is deterministic.
+    std::map<uint32_t, kernel_arg_t> args;
+    std::map<ur_kernel_exec_info_t, std::vector<char>> execInfo;
+    std::map<uint32_t, std::vector<char>> specConstants;
+};
+
+// Loader object of a kernel.
+class __urdlllocal kernel_object_t : public object_t<ur_kernel_handle_t> {
+  public:
+    using object_t::object_t;
+
+    // References to the kernel taken through the loader. The loader keeps
+    // its objects after the adapter destroyed the kernel, and hands them out
+    // again for kernels created at the same address, so the record is
+    // dropped together with the last reference.
+    std::atomic<uint32_t> refCount = 0;
+    // Guards the record, arguments may be set from several threads at once.
+    std::mutex mutex;
+    kernel_record_t record;
+};
+
+ur_result_t urKernelSetArgValue(
+    kernel_object_t *pKernel, uint32_t argIndex, size_t argSize,
+    const ur_kernel_arg_value_properties_t *pProperties, const void *pArgValue);
+
+ur_result_t
+urKernelSetArgLocal(kernel_object_t *pKernel, uint32_t argIndex,
+                    size_t argSize,
+                    const ur_kernel_arg_local_properties_t *pProperties);
+
+ur_result_t
+urKernelSetArgPointer(kernel_object_t *pKernel, uint32_t argIndex,
+                      const ur_kernel_arg_pointer_properties_t *pProperties,
+                      const void *pArgValue);
+
+ur_result_t
+urKernelSetArgSampler(kernel_object_t *pKernel, uint32_t argIndex,
+                      const ur_kernel_arg_sampler_properties_t *pProperties,
+                      ur_sampler_handle_t hArgValue);
+
+ur_result_t
+urKernelSetArgMemObj(kernel_object_t *pKernel, uint32_t argIndex,
+                     const ur_kernel_arg_mem_obj_properties_t *pProperties,
+                     ur_mem_handle_t hArgValue);
+
+ur_result_t
+urKernelSetExecInfo(kernel_object_t *pKernel, ur_kernel_exec_info_t propName,
+                    size_t propSize,
+                    const ur_kernel_exec_info_properties_t *pProperties,
+                    const void *pPropValue);
+
+ur_result_t urKernelSetSpecializationConstants(
+    kernel_object_t *pKernel, uint32_t count,
+    const ur_specialization_constant_info_t *pSpecConstants);
+
+// Counts a reference to the kernel taken through the loader by
+// urKernelCreate, urKernelCreateWithNativeHandle or urKernelRetain. Called
+// after the adapter succeeded.
+void retain(kernel_object_t *pKernel);
+
+// Forwards the release to the adapter and drops the recorded state with the
+// last reference.
+ur_result_t urKernelRelease(kernel_object_t *pKernel);
+
+// Returns the adapter handle of the clone in phKernelClone, whose loader
+// object already holds the replayed state.
+ur_result_t urKernelCloneExp(kernel_object_t *pKernel,
+                             ur_kernel_handle_t *phKernelClone);
+
+} // namespace kernel_clone
+} // namespace ur_loader
+
+#endif /* UR_LOADER_KERNEL_CLONE_HPP */
@@ -9,8 +9,10 @@
  * @file ur_ldrddi.cpp
  *
  */
+#include "ur_kernel_clone.hpp"
 #include "ur_lib_loader.hpp"
 #include "ur_loader.hpp"
+#include "ur_program_build_async.hpp"
 
 namespace ur_loader {
 ///////////////////////////////////////////////////////////////////////////////
@@ -2921,6 +2923,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
 
+    // count the references to the arguments recorded for urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        kernel_clone::retain(reinterpret_cast<ur_kernel_object_t *>(*phKernel));
+    }
+
     return result;
 }
 
@@ -2944,12 +2952,23 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
     // forward to device-platform
     result = pfnSetArgValue(hKernel, argIndex, argSize, pProperties, pArgValue);
 
+    // record the arguments for emulating urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        result = kernel_clone::urKernelSetArgValue(
+            pKernelObject, argIndex, argSize, pProperties, pArgValue);
+    }
+
     return result;
 }
 
@@ -2972,12 +2991,23 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
     // forward to device-platform
     result = pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
 
+    // record the arguments for emulating urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        result = kernel_clone::urKernelSetArgLocal(pKernelObject, argIndex,
+                                                   argSize, pProperties);
+    }
+
     return result;
 }
 
@@ -3149,12 +3179,22 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
     // forward to device-platform
     result = pfnRetain(hKernel);
 
+    // count the references to the arguments recorded for urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        kernel_clone::retain(pKernelObject);
+    }
+
     return result;
 }
 
@@ -3172,11 +3212,20 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
     // forward to device-platform
-    result = pfnRelease(hKernel);
+    if (nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        // release and drop the arguments recorded for urKernelCloneExp
+        result = kernel_clone::urKernelRelease(pKernelObject);
+    } else {
+        result = pfnRelease(hKernel);
+    }
 
     return result;
 }
@@ -3201,12 +3250,23 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
     // forward to device-platform
     result = pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
 
+    // record the arguments for emulating urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        result = kernel_clone::urKernelSetArgPointer(pKernelObject, argIndex,
+                                                     pProperties, pArgValue);
+    }
+
     return result;
 }
 
@@ -3231,6 +3291,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
@@ -3238,6 +3302,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
     result =
         pfnSetExecInfo(hKernel, propName, propSize, pProperties, pPropValue);
 
+    // record the arguments for emulating urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        result = kernel_clone::urKernelSetExecInfo(
+            pKernelObject, propName, propSize, pProperties, pPropValue);
+    }
+
     return result;
 }
 
@@ -3259,6 +3330,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
@@ -3268,6 +3343,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
     // forward to device-platform
     result = pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
 
+    // record the arguments for emulating urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        result = kernel_clone::urKernelSetArgSampler(pKernelObject, argIndex,
+                                                     pProperties, hArgValue);
+    }
+
     return result;
 }
 
@@ -3289,6 +3371,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
@@ -3300,6 +3386,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
     // forward to device-platform
     result = pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
 
+    // record the arguments for emulating urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        result = kernel_clone::urKernelSetArgMemObj(pKernelObject, argIndex,
+                                                    pProperties, hArgValue);
+    }
+
     return result;
 }
 
@@ -3321,12 +3414,23 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
     // convert loader handle to platform handle
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
     // forward to device-platform
     result = pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
 
+    // record the arguments for emulating urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        result = kernel_clone::urKernelSetSpecializationConstants(
+            pKernelObject, count, pSpecConstants);
+    }
+
     return result;
 }
 
@@ -3404,6 +3508,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
 
+    // count the references to the arguments recorded for urKernelCloneExp
+    if (UR_RESULT_SUCCESS == result &&
+        nullptr == dditable->ur.KernelExp.pfnCloneExp) {
+        kernel_clone::retain(reinterpret_cast<ur_kernel_object_t *>(*phKernel));
+    }
+
     return result;
 }
 
@@ -7599,6 +7709,65 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelCloneExp
+__urdlllocal ur_result_t UR_APICALL urKernelCloneExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object to clone
+    ur_kernel_handle_t
+        *phKernelClone ///< [out] pointer to handle of the cloned kernel object
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto pfnCloneExp = dditable->ur.KernelExp.pfnCloneExp;
+
+    // keep the loader object, which holds the state recorded for emulating
+    // urKernelCloneExp
+    auto pKernelObject = reinterpret_cast<ur_kernel_object_t *>(hKernel);
+
+    // convert loader handle to platform handle
+    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+
+    // forward to device-platform
+    if (nullptr == pfnCloneExp) {
+        // emulate the clone with the arguments recorded by the loader
+        result =
+            kernel_clone::urKernelCloneExp(pKernelObject, phKernelClone);
+    } else {
+        result = pfnCloneExp(hKernel, phKernelClone);
+    }
+
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    try {
+        // convert platform handle to loader handle
+        *phKernelClone = reinterpret_cast<ur_kernel_handle_t>(
+            ur_kernel_factory.getInstance(*phKernelClone, dditable));
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Fallback for urKernelCloneExp installed in the DDI table of the
+///        only platform, when the loader doesn't intercept its calls
+__urdlllocal ur_result_t UR_APICALL urKernelCloneExpDirect(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object to clone
+    ur_kernel_handle_t
+        *phKernelClone ///< [out] pointer to handle of the cloned kernel object
+) {
+    // the emulation replays the arguments recorded in the loader's kernel
+    // objects, which only exist when the loader intercepts calls
+    std::ignore = hKernel;
+    std::ignore = phKernelClone;
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urProgramBuildExp
 __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
@@ -7731,6 +7900,119 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_program_handle_t hProgram, ///< [in] handle of the program object
+    const char *pOptions,         ///< [in][optional] string of build options
+    ur_exp_program_build_callback_t
+        pfnNotify, ///< [in] callback called once the build has finished
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to pfnNotify
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnBuildAsyncExp = dditable->ur.ProgramExp.pfnBuildAsyncExp;
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // convert loader handle to platform handle
+    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+
+    // forward to device-platform
+    if (nullptr == pfnBuildAsyncExp) {
+        // build on the loader's compile threads
+        result = program_build_async::urProgramBuildAsyncExp(
+            dditable, hContext, hProgram, pOptions, pfnNotify, pUserData);
+    } else {
+        result = pfnBuildAsyncExp(hContext, hProgram, pOptions, pfnNotify,
+                                  pUserData);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Emulation of urProgramBuildAsyncExp installed in the DDI table of the
+///        only platform, when the loader doesn't intercept its calls
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExpDirect(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_program_handle_t hProgram, ///< [in] handle of the program object
+    const char *pOptions,         ///< [in][optional] string of build options
+    ur_exp_program_build_callback_t
+        pfnNotify, ///< [in] callback called once the build has finished
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to pfnNotify
+) {
+    // build on the loader's compile threads
+    return program_build_async::urProgramBuildAsyncExp(
+        &context->platforms.front().dditable, hContext, hProgram, pOptions,
+        pfnNotify, pUserData);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMExportExp
+__urdlllocal ur_result_t UR_APICALL urUSMExportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem, ///< [in] pointer to the start of the USM allocation
+    ur_exp_usm_export_type_t exportType, ///< [in] type of OS handle to return
+    ur_native_handle_t *phOsHandle       ///< [out] OS handle of the allocation
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnExportExp = dditable->ur.USMExp.pfnExportExp;
+    if (nullptr == pfnExportExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // forward to device-platform
+    result = pfnExportExp(hContext, pMem, exportType, phOsHandle);
+
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMImportHandleExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportHandleExp(
+    ur_context_handle_t hContext,        ///< [in] handle of the context object
+    ur_exp_usm_export_type_t exportType, ///< [in] type of hOsHandle
+    ur_native_handle_t
+        hOsHandle, ///< [in][nocheck] OS handle returned by ::urUSMExportExp in the exporting
+                   ///< process
+    size_t size,   ///< [in] size in bytes of the exported allocation
+    void **ppMem   ///< [out] pointer to the imported memory
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnImportHandleExp = dditable->ur.USMExp.pfnImportHandleExp;
+    if (nullptr == pfnImportHandleExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // forward to device-platform
+    result = pfnImportHandleExp(hContext, exportType, hOsHandle, size, ppMem);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urUSMImportExp
 __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
@@ -8504,10 +8786,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
             // return pointers to loader's DDIs
             pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
                 ur_loader::urKernelSuggestMaxCooperativeGroupCountExp;
+            pDdiTable->pfnCloneExp = ur_loader::urKernelCloneExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable =
                 ur_loader::context->platforms.front().dditable.ur.KernelExp;
+            if (nullptr == pDdiTable->pfnCloneExp) {
+                pDdiTable->pfnCloneExp = ur_loader::urKernelCloneExpDirect;
+            }
         }
     }
 
@@ -8809,10 +9095,15 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
             pDdiTable->pfnBuildExp = ur_loader::urProgramBuildExp;
             pDdiTable->pfnCompileExp = ur_loader::urProgramCompileExp;
             pDdiTable->pfnLinkExp = ur_loader::urProgramLinkExp;
+            pDdiTable->pfnBuildAsyncExp = ur_loader::urProgramBuildAsyncExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable =
                 ur_loader::context->platforms.front().dditable.ur.ProgramExp;
+            if (nullptr == pDdiTable->pfnBuildAsyncExp) {
+                pDdiTable->pfnBuildAsyncExp =
+                    ur_loader::urProgramBuildAsyncExpDirect;
+            }
         }
     }
 
@@ -9042,6 +9333,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
             ur_loader::context->forceIntercept) {
             // return pointers to loader's DDIs
             pDdiTable->pfnPitchedAllocExp = ur_loader::urUSMPitchedAllocExp;
+            pDdiTable->pfnExportExp = ur_loader::urUSMExportExp;
+            pDdiTable->pfnImportHandleExp = ur_loader::urUSMImportHandleExp;
             pDdiTable->pfnImportExp = ur_loader::urUSMImportExp;
             pDdiTable->pfnReleaseExp = ur_loader::urUSMReleaseExp;
         } else {
@@ -12,6 +12,7 @@
 #ifndef UR_LOADER_LDRDDI_H
 #define UR_LOADER_LDRDDI_H 1
 
+#include "ur_kernel_clone.hpp"
 #include "ur_object.hpp"
 #include "ur_singleton.hpp"
 
@@ -41,7 +42,7 @@ using ur_program_object_t = object_t<ur_program_handle_t>;
 using ur_program_factory_t =
     singleton_factory_t<ur_program_object_t, ur_program_handle_t>;
 
-using ur_kernel_object_t = object_t<ur_kernel_handle_t>;
+using ur_kernel_object_t = kernel_clone::kernel_object_t;
 using ur_kernel_factory_t =
     singleton_factory_t<ur_kernel_object_t, ur_kernel_handle_t>;
 
@@ -16,9 +16,13 @@
 #include "ur_api.h"
 #include "ur_codeloc.hpp"
 #include "ur_ddi.h"
+#include "ur_device_selector.hpp"
 #include "ur_proxy_layer.hpp"
 #include "ur_util.hpp"
 
+#include "batching/ur_batching_layer.hpp"
+#include "composite/ur_composite_layer.hpp"
+#include "event_graph/ur_event_graph_layer.hpp"
 #include "validation/ur_validation_layer.hpp"
 #if UR_ENABLE_TRACING
 #include "tracing/ur_tracing_layer.hpp"
@@ -26,6 +30,12 @@
 #if UR_ENABLE_SANITIZER
 #include "sanitizer/ur_sanitizer_layer.hpp"
 #endif
+#if UR_ENABLE_STATS
+#include "stats/ur_stats_layer.hpp"
+#endif
+#if UR_ENABLE_USDT
+#include "usdt/ur_usdt_layer.hpp"
+#endif
 
 #include <atomic>
 #include <mutex>
@@ -71,11 +81,20 @@ class __urdlllocal context_t {
 
     const std::vector<proxy_layer_context_t *> layers = {
         &ur_validation_layer::context,
+        &ur_composite_layer::context,
+        &ur_event_graph_layer::context,
+        &ur_batching_layer::context,
 #if UR_ENABLE_TRACING
         &ur_tracing_layer::context,
 #endif
 #if UR_ENABLE_SANITIZER
-        &ur_sanitizer_layer::context
+        &ur_sanitizer_layer::context,
+#endif
+#if UR_ENABLE_STATS
+        &ur_stats_layer::context,
+#endif
+#if UR_ENABLE_USDT
+        &ur_usdt_layer::context,
 #endif
     };
     std::string availableLayers;
@@ -104,11 +123,5 @@ ur_result_t
 urLoaderConfigSetCodeLocationCallback(ur_loader_config_handle_t hLoaderConfig,
                                       ur_code_location_callback_t pfnCodeloc,
                                       void *pUserData);
-
-ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
-                                ur_device_type_t DeviceType,
-                                uint32_t NumEntries,
-                                ur_device_handle_t *phDevices,
-                                uint32_t *pNumDevices);
 } // namespace ur_lib
 #endif /* UR_LOADER_LIB_H */
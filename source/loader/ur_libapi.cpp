@@ -3571,7 +3571,7 @@ ur_result_t UR_APICALL urKernelSetArgLocal(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hKernel`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_KERNEL_INFO_NUM_REGS < propName`
+///         + `::UR_KERNEL_INFO_VARIANT_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -4421,7 +4421,7 @@ ur_result_t UR_APICALL urEventGetInfo(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hEvent`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_PROFILING_INFO_COMMAND_COMPLETE < propName`
+///         + `::UR_PROFILING_INFO_BRANCH_MISSES_EXP < propName`
 ///     - ::UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE
 ///         + If `hEvent`s associated queue was not created with `UR_QUEUE_FLAG_PROFILING_ENABLE`.
 ///     - ::UR_RESULT_ERROR_INVALID_VALUE
@@ -8187,6 +8187,51 @@ ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Create a copy of a kernel object
+///
+/// @details
+///     - The clone refers to the same program and kernel function as hKernel
+///       and starts with the arguments and execution info currently set on
+///       hKernel.
+///     - Arguments set on either kernel after this call do not affect the other
+///       one.
+///     - Adapters may share the argument storage of both kernels until either
+///       of them is modified, which makes cloning much cheaper than creating
+///       the kernel again with ::urKernelCreate.
+///     - The application may call this function from simultaneous threads, as
+///       long as the arguments of hKernel are not modified at the same time.
+///     - The clone must be released with ::urKernelRelease.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hKernel`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phKernelClone`
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support cloning kernels and the loader doesn't intercept calls.
+ur_result_t UR_APICALL urKernelCloneExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object to clone
+    ur_kernel_handle_t
+        *phKernelClone ///< [out] pointer to handle of the cloned kernel object
+    ) try {
+    auto pfnCloneExp = ur_lib::context->urDdiTable.KernelExp.pfnCloneExp;
+    if (nullptr == pfnCloneExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnCloneExp(hKernel, phKernelClone);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Produces an executable program from one program, negates need for the
 ///        linking step.
@@ -8332,6 +8377,151 @@ ur_result_t UR_APICALL urProgramLinkExp(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Starts building a program without waiting for the build to finish.
+///
+/// @details
+///     - Builds hProgram like ::urProgramBuild, but returns before the build
+///       has finished. pfnNotify is called exactly once when it finishes, from
+///       an arbitrary thread, possibly before this function returns.
+///     - If this function returns an error, the build was not started and
+///       pfnNotify is not called.
+///     - pOptions is copied before this function returns.
+///     - The application must not use hProgram, except to release it, until
+///       pfnNotify has been called.
+///     - Adapters which do not support this function natively, see
+///       ::UR_PROGRAM_BUILD_ASYNC_EXTENSION_STRING_EXP, may have it emulated by
+///       the loader, which then runs ::urProgramBuild on a bounded pool of
+///       compile threads.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hProgram`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pfnNotify`
+///     - ::UR_RESULT_ERROR_INVALID_PROGRAM
+///         + If `hProgram` isn't a valid program object.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_program_handle_t hProgram, ///< [in] handle of the program object
+    const char *pOptions,         ///< [in][optional] string of build options
+    ur_exp_program_build_callback_t
+        pfnNotify, ///< [in] callback called once the build has finished
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to pfnNotify
+    ) try {
+    auto pfnBuildAsyncExp =
+        ur_lib::context->urDdiTable.ProgramExp.pfnBuildAsyncExp;
+    if (nullptr == pfnBuildAsyncExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnBuildAsyncExp(hContext, hProgram, pOptions, pfnNotify,
+                            pUserData);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get an OS handle other processes can import a USM allocation with
+///
+/// @details
+///     - pMem must be the start of an allocation made with a
+///       ::ur_exp_usm_export_desc_t of the same `exportType`.
+///     - The handle is owned by the allocation and stays valid until pMem is
+///       freed. Applications pass a duplicate of it to other processes.
+///     - The memory stays allocated until pMem is freed and all the processes
+///       which imported it have freed their imports.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///         + `NULL == phOsHandle`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `::UR_EXP_USM_EXPORT_TYPE_FD < exportType`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If pMem was not allocated as exportable as `exportType`.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support exporting allocations.
+ur_result_t UR_APICALL urUSMExportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem, ///< [in] pointer to the start of the USM allocation
+    ur_exp_usm_export_type_t exportType, ///< [in] type of OS handle to return
+    ur_native_handle_t *phOsHandle       ///< [out] OS handle of the allocation
+    ) try {
+    auto pfnExportExp = ur_lib::context->urDdiTable.USMExp.pfnExportExp;
+    if (nullptr == pfnExportExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnExportExp(hContext, pMem, exportType, phOsHandle);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Map a USM allocation exported by another process into a context
+///
+/// @details
+///     - The returned pointer can be used like a USM host allocation of `size`
+///       bytes in hContext, and must be freed with ::urUSMFree.
+///     - hOsHandle isn't consumed, the application may close it once this
+///       function returns.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `::UR_EXP_USM_EXPORT_TYPE_FD < exportType`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + `size == 0`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If hOsHandle isn't a handle of `exportType` of at least `size` bytes.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support importing allocations.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+ur_result_t UR_APICALL urUSMImportHandleExp(
+    ur_context_handle_t hContext,        ///< [in] handle of the context object
+    ur_exp_usm_export_type_t exportType, ///< [in] type of hOsHandle
+    ur_native_handle_t
+        hOsHandle, ///< [in][nocheck] OS handle returned by ::urUSMExportExp in the exporting
+                   ///< process
+    size_t size,   ///< [in] size in bytes of the exported allocation
+    void **ppMem   ///< [out] pointer to the imported memory
+    ) try {
+    auto pfnImportHandleExp =
+        ur_lib::context->urDdiTable.USMExp.pfnImportHandleExp;
+    if (nullptr == pfnImportHandleExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnImportHandleExp(hContext, exportType, hOsHandle, size, ppMem);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Import memory into USM
 ///
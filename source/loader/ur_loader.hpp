@@ -43,6 +43,7 @@ class context_t {
 
 extern context_t *context;
 extern ur_event_factory_t ur_event_factory;
+extern ur_kernel_factory_t ur_kernel_factory;
 
 } // namespace ur_loader
 
@@ -1003,6 +1003,30 @@ ur_result_t urPrintExpCommandBufferUpdateKernelLaunchDesc(
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t urPrintExpQueueExecutorProperties(
+    const struct ur_exp_queue_executor_properties_t params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintExpUsmExportType(enum ur_exp_usm_export_type_t value,
+                                    char *buffer, const size_t buff_size,
+                                    size_t *out_size) {
+    std::stringstream ss;
+    ss << value;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintExpUsmExportDesc(
+    const struct ur_exp_usm_export_desc_t params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t urPrintExpPeerInfo(enum ur_exp_peer_info_t value, char *buffer,
                                const size_t buff_size, size_t *out_size) {
     std::stringstream ss;
@@ -1845,6 +1869,15 @@ ur_result_t urPrintKernelSuggestMaxCooperativeGroupCountExpParams(
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t
+urPrintKernelCloneExpParams(const struct ur_kernel_clone_exp_params_t *params,
+                            char *buffer, const size_t buff_size,
+                            size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t
 urPrintLoaderInitParams(const struct ur_loader_init_params_t *params,
                         char *buffer, const size_t buff_size,
@@ -2205,6 +2238,14 @@ ur_result_t urPrintProgramCreateWithNativeHandleParams(
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t urPrintProgramBuildAsyncExpParams(
+    const struct ur_program_build_async_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t
 urPrintQueueGetInfoParams(const struct ur_queue_get_info_params_t *params,
                           char *buffer, const size_t buff_size,
@@ -2414,6 +2455,23 @@ ur_result_t urPrintUsmPitchedAllocExpParams(
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t
+urPrintUsmExportExpParams(const struct ur_usm_export_exp_params_t *params,
+                          char *buffer, const size_t buff_size,
+                          size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintUsmImportHandleExpParams(
+    const struct ur_usm_import_handle_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t
 urPrintUsmImportExpParams(const struct ur_usm_import_exp_params_t *params,
                           char *buffer, const size_t buff_size,
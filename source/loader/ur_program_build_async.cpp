@@ -0,0 +1,127 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_program_build_async.cpp
+ *
+ */
+
+#include "ur_program_build_async.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ur_loader {
+namespace program_build_async {
+
+namespace {
+
+// Upper bound on the compile threads, builds beyond it are queued.
+constexpr unsigned MAX_COMPILE_THREADS = 8;
+
+class compile_pool_t {
+  public:
+    void submit(std::function<void()> task) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        // Threads are only started once more builds are waiting than there
+        // are idle threads to pick them up.
+        if (tasks.size() >= idleThreads && threads.size() < maxThreads()) {
+            threads.emplace_back([this] { run(); });
+        }
+        tasks.push_back(std::move(task));
+        cv.notify_one();
+    }
+
+  private:
+    static size_t maxThreads() {
+        unsigned hwThreads = std::thread::hardware_concurrency();
+        return std::clamp(hwThreads, 1u, MAX_COMPILE_THREADS);
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            idleThreads++;
+            cv.wait(lock, [this] { return !tasks.empty(); });
+            idleThreads--;
+
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::thread> threads;
+    size_t idleThreads = 0;
+};
+
+compile_pool_t &getCompilePool() {
+    // Never destroyed, builds still running at exit are abandoned rather than
+    // joined from a static destructor, after the adapters may be unloaded.
+    static auto *pool = new compile_pool_t;
+    return *pool;
+}
+
+} // namespace
+
+ur_result_t urProgramBuildAsyncExp(dditable_t *dditable,
+                                   ur_context_handle_t hContext,
+                                   ur_program_handle_t hProgram,
+                                   const char *pOptions,
+                                   ur_exp_program_build_callback_t pfnNotify,
+                                   void *pUserData) {
+    std::optional<std::string> options;
+    try {
+        if (pOptions) {
+            options = pOptions;
+        }
+    } catch (std::bad_alloc &) {
+        return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    // The application may release its references while the build is queued.
+    ur_result_t result = dditable->ur.Context.pfnRetain(hContext);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    result = dditable->ur.Program.pfnRetain(hProgram);
+    if (result != UR_RESULT_SUCCESS) {
+        dditable->ur.Context.pfnRelease(hContext);
+        return result;
+    }
+
+    try {
+        getCompilePool().submit([=, options = std::move(options)] {
+            ur_result_t buildResult = dditable->ur.Program.pfnBuild(
+                hContext, hProgram, options ? options->c_str() : nullptr);
+            pfnNotify(buildResult, pUserData);
+            dditable->ur.Program.pfnRelease(hProgram);
+            dditable->ur.Context.pfnRelease(hContext);
+        });
+    } catch (std::exception &) {
+        dditable->ur.Program.pfnRelease(hProgram);
+        dditable->ur.Context.pfnRelease(hContext);
+        return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace program_build_async
+} // namespace ur_loader
@@ -0,0 +1,39 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_program_build_async.hpp
+ *
+ */
+
+#ifndef UR_LOADER_PROGRAM_BUILD_ASYNC_HPP
+#define UR_LOADER_PROGRAM_BUILD_ASYNC_HPP 1
+
+#include "ur_object.hpp"
+
+namespace ur_loader {
+namespace program_build_async {
+
+// Emulation of urProgramBuildAsyncExp for adapters which do not implement it.
+// Builds are handed to a pool of compile threads shared by all platforms,
+// which run the adapter's urProgramBuild and then call the notification
+// callback. The pool is bounded by the number of hardware threads, so that
+// many concurrent builds don't oversubscribe the host.
+//
+// All handles passed here are adapter handles, not loader handles.
+
+ur_result_t urProgramBuildAsyncExp(dditable_t *dditable,
+                                   ur_context_handle_t hContext,
+                                   ur_program_handle_t hProgram,
+                                   const char *pOptions,
+                                   ur_exp_program_build_callback_t pfnNotify,
+                                   void *pUserData);
+
+} // namespace program_build_async
+} // namespace ur_loader
+
+#endif /* UR_LOADER_PROGRAM_BUILD_ASYNC_HPP */
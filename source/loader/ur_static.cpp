@@ -0,0 +1,166 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_static.cpp
+ *
+ * Loader entry points of the static single-adapter build. Every other entry
+ * point is defined by the adapter linked into the library and called
+ * directly, without dispatch tables, handle translation or layers.
+ *
+ */
+
+#include "logger/ur_logger.hpp"
+#include "ur_api.h"
+#include "ur_device_selector.hpp"
+#include "ur_util.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+struct ur_loader_config_handle_t_ {
+    std::atomic_uint32_t refCount = 1;
+};
+
+extern "C" {
+
+ur_result_t UR_APICALL urLoaderConfigCreate(
+    ur_loader_config_handle_t *phLoaderConfig) try {
+    if (!phLoaderConfig) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    *phLoaderConfig = new ur_loader_config_handle_t_;
+    return UR_RESULT_SUCCESS;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+ur_result_t UR_APICALL
+urLoaderConfigRetain(ur_loader_config_handle_t hLoaderConfig) {
+    if (!hLoaderConfig) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    hLoaderConfig->refCount.fetch_add(1, std::memory_order_acq_rel);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t UR_APICALL
+urLoaderConfigRelease(ur_loader_config_handle_t hLoaderConfig) {
+    if (!hLoaderConfig) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (hLoaderConfig->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete hLoaderConfig;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t UR_APICALL urLoaderConfigGetInfo(
+    ur_loader_config_handle_t hLoaderConfig, ur_loader_config_info_t propName,
+    size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+    if (!hLoaderConfig) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (!pPropValue && !pPropSizeRet) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    switch (propName) {
+    case UR_LOADER_CONFIG_INFO_AVAILABLE_LAYERS: {
+        // Layers are not built into the static library.
+        if (pPropSizeRet) {
+            *pPropSizeRet = 1;
+        }
+        if (pPropValue) {
+            if (propSize != 1) {
+                return UR_RESULT_ERROR_INVALID_SIZE;
+            }
+            static_cast<char *>(pPropValue)[0] = '\0';
+        }
+        break;
+    }
+    case UR_LOADER_CONFIG_INFO_REFERENCE_COUNT: {
+        uint32_t refCount =
+            hLoaderConfig->refCount.load(std::memory_order_acquire);
+        if (pPropSizeRet) {
+            *pPropSizeRet = sizeof(refCount);
+        }
+        if (pPropValue) {
+            if (propSize != sizeof(refCount)) {
+                return UR_RESULT_ERROR_INVALID_SIZE;
+            }
+            std::memcpy(pPropValue, &refCount, sizeof(refCount));
+        }
+        break;
+    }
+    default:
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t UR_APICALL urLoaderConfigEnableLayer(
+    ur_loader_config_handle_t hLoaderConfig, const char *pLayerName) {
+    if (!hLoaderConfig) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (!pLayerName) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    return UR_RESULT_ERROR_LAYER_NOT_PRESENT;
+}
+
+ur_result_t UR_APICALL urLoaderConfigSetCodeLocationCallback(
+    ur_loader_config_handle_t hLoaderConfig,
+    ur_code_location_callback_t pfnCodeloc, void *) {
+    if (!hLoaderConfig) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (!pfnCodeloc) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    // Code locations are only reported by layers.
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t UR_APICALL urLoaderInit(ur_device_init_flags_t device_flags,
+                                    ur_loader_config_handle_t) try {
+    if (UR_DEVICE_INIT_FLAGS_MASK & device_flags) {
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+
+    static std::once_flag initOnce;
+    std::call_once(initOnce, [] {
+        const char *logger_name = "loader";
+        logger::init(logger_name);
+        logger::debug("Logger {} initialized successfully!", logger_name);
+    });
+    return UR_RESULT_SUCCESS;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+ur_result_t UR_APICALL urLoaderTearDown(void) try {
+    logger::FlightRecorderSink::dumpAll("urLoaderTearDown");
+    return UR_RESULT_SUCCESS;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+ur_result_t UR_APICALL urDeviceGetSelected(ur_platform_handle_t hPlatform,
+                                           ur_device_type_t DeviceType,
+                                           uint32_t NumEntries,
+                                           ur_device_handle_t *phDevices,
+                                           uint32_t *pNumDevices) try {
+    return ur_lib::urDeviceGetSelected(hPlatform, DeviceType, NumEntries,
+                                       phDevices, pNumDevices);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+} // extern "C"
@@ -0,0 +1,48 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_NATIVE_CPU_TEST_KERNEL_INTERFACE_H
+#define UR_NATIVE_CPU_TEST_KERNEL_INTERFACE_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Kernel interface of the adapter and layout of the binaries with kernel
+// variants, as emitted by the clang-offload-wrapper, see
+// source/adapters/native_cpu/kernel.hpp, nativecpu_state.hpp and program.hpp.
+namespace native_cpu_test {
+constexpr uintptr_t PROGRAM_MAGIC = ~uintptr_t(0) - 0x4e43;
+constexpr uint32_t PROGRAM_VERSION = 1;
+
+struct variant_entry {
+    const char *kernelname;
+    const unsigned char *kernel_ptr;
+    uint64_t required_features;
+    const char *variant_name;
+};
+
+struct program_header {
+    uintptr_t magic;
+    uint32_t version;
+    uint32_t reserved;
+    const variant_entry *entries;
+};
+
+struct arg_desc {
+    void *ptr;
+};
+
+struct kernel_state {
+    size_t globalId[3];
+    size_t globalRange[3];
+    size_t workGroupSize[3];
+    size_t workGroupId[3];
+    size_t localId[3];
+    size_t numGroups[3];
+    size_t globalOffset[3];
+};
+} // namespace native_cpu_test
+
+#endif // UR_NATIVE_CPU_TEST_KERNEL_INTERFACE_H
@@ -0,0 +1,108 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+using urNativeCpuDeviceGetInfoTest = uur::urDeviceTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuDeviceGetInfoTest);
+
+// The number of CPUs the process may run on, the upper bound of the compute
+// units unless UR_NATIVE_CPU_NUM_THREADS overrides them.
+static uint32_t allowedCPUs() {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        return CPU_COUNT(&set);
+    }
+#endif
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+TEST_P(urNativeCpuDeviceGetInfoTest, ComputeUnits) {
+    uint32_t compute_units = 0;
+    ASSERT_SUCCESS(uur::GetDeviceMaxComputeUnits(device, compute_units));
+    ASSERT_GT(compute_units, 0);
+
+    // Invalid values, e.g. "0" or "4x", are ignored.
+    const char *num_threads = std::getenv("UR_NATIVE_CPU_NUM_THREADS");
+    if (num_threads && std::strcmp(num_threads, "3") == 0) {
+        ASSERT_EQ(compute_units, 3);
+    } else {
+        ASSERT_LE(compute_units, allowedCPUs());
+    }
+}
+
+TEST_P(urNativeCpuDeviceGetInfoTest, MemorySizes) {
+    uint64_t global_mem_size = 0;
+    ASSERT_SUCCESS(uur::GetDeviceGlobalMemSize(device, global_mem_size));
+    ASSERT_GT(global_mem_size, 0);
+
+    uint64_t max_alloc_size = 0;
+    ASSERT_SUCCESS(uur::GetDeviceMaxMemAllocSize(device, max_alloc_size));
+    ASSERT_EQ(max_alloc_size, global_mem_size / 4);
+
+    uint64_t constant_buffer_size = 0;
+    ASSERT_SUCCESS(
+        uur::GetDeviceMaxConstantBufferSize(device, constant_buffer_size));
+    ASSERT_LE(constant_buffer_size, max_alloc_size);
+    ASSERT_GE(constant_buffer_size,
+              std::min(max_alloc_size, uint64_t(64 * 1024)));
+}
+
+TEST_P(urNativeCpuDeviceGetInfoTest, Caches) {
+    uint32_t cache_line_size = 0;
+    ASSERT_SUCCESS(uur::GetDeviceMemCachelineSize(device, cache_line_size));
+    ASSERT_GT(cache_line_size, 0);
+    ASSERT_EQ(cache_line_size & (cache_line_size - 1), 0)
+        << "cache line size " << cache_line_size << " is not a power of two";
+
+    uint64_t local_mem_size = 0;
+    ASSERT_SUCCESS(uur::GetDeviceLocalMemSize(device, local_mem_size));
+    ASSERT_GT(local_mem_size, 0);
+}
+
+TEST_P(urNativeCpuDeviceGetInfoTest, VectorWidths) {
+    uint32_t char_width = 0, int_width = 0, long_width = 0;
+    ASSERT_SUCCESS(uur::GetDevicePreferredVectorWidthChar(device, char_width));
+    ASSERT_SUCCESS(uur::GetDevicePreferredVectorWidthInt(device, int_width));
+    ASSERT_SUCCESS(uur::GetDevicePreferredVectorWidthLong(device, long_width));
+    ASSERT_GE(long_width, 1);
+    ASSERT_GE(int_width, long_width);
+    ASSERT_GE(char_width, int_width);
+
+    uint32_t float_width = 0, double_width = 0;
+    ASSERT_SUCCESS(
+        uur::GetDevicePreferredVectorWidthFloat(device, float_width));
+    ASSERT_SUCCESS(
+        uur::GetDevicePreferredVectorWidthDouble(device, double_width));
+    ASSERT_GE(double_width, 1);
+    ASSERT_GE(float_width, double_width);
+}
+
+TEST_P(urNativeCpuDeviceGetInfoTest, NoHalfSupport) {
+    ur_device_fp_capability_flags_t half_config = 0;
+    ASSERT_SUCCESS(uur::GetDeviceInfo<ur_device_fp_capability_flags_t>(
+        device, UR_DEVICE_INFO_HALF_FP_CONFIG, half_config));
+    ASSERT_EQ(half_config, 0);
+
+    uint32_t preferred_width = 1;
+    ASSERT_SUCCESS(
+        uur::GetDevicePreferredVectorWidthHalf(device, preferred_width));
+    ASSERT_EQ(preferred_width, 0);
+
+    uint32_t native_width = 1;
+    ASSERT_SUCCESS(uur::GetDeviceNativeVectorWithHalf(device, native_width));
+    ASSERT_EQ(native_width, 0);
+}
@@ -0,0 +1,152 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel_interface.hpp"
+
+#include <uur/fixtures.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace native_cpu_test;
+
+namespace {
+// Increments every byte of the work-group. Depending on how the adapter is
+// built it is called once per work-group or once per work-item, only the
+// call for the first work-item of the group does the work.
+void incrementBytes(const arg_desc *args, kernel_state *state) {
+    if (state->localId[0] != 0) {
+        return;
+    }
+    auto *data = static_cast<uint8_t *>(args[0].ptr);
+    size_t first = state->workGroupId[0] * state->workGroupSize[0] +
+                   state->globalOffset[0];
+    for (size_t i = 0; i < state->workGroupSize[0]; i++) {
+        data[first + i]++;
+    }
+}
+
+bool batchingLayerEnabled() {
+    const char *layers = std::getenv("UR_ENABLE_LAYERS");
+    return layers &&
+           std::string(layers).find("UR_LAYER_BATCHING") != std::string::npos;
+}
+} // namespace
+
+// Runs the same commands on a batched and on a regular queue, the batching
+// layer replays the commands of the batched queue, as the adapter has no
+// command buffers.
+struct urEnqueueBatchedTest : uur::urDeviceTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urDeviceTest::SetUp());
+        if (!batchingLayerEnabled()) {
+            GTEST_SKIP() << "UR_LAYER_BATCHING is not enabled.";
+        }
+
+        ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, &context));
+
+        entries[0] = {"increment_bytes",
+                      reinterpret_cast<const unsigned char *>(&incrementBytes),
+                      0, "generic"};
+        entries[1] = {nullptr, nullptr, 0, nullptr};
+        header = {PROGRAM_MAGIC, PROGRAM_VERSION, 0, entries};
+        ASSERT_SUCCESS(urProgramCreateWithBinary(
+            context, device, sizeof(header),
+            reinterpret_cast<const uint8_t *>(&header), nullptr, &program));
+        ASSERT_SUCCESS(urKernelCreate(program, "increment_bytes", &kernel));
+
+        for (auto *allocation : {&src, &dst, &batched_src, &batched_dst}) {
+            ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                            size, allocation));
+        }
+
+        ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &queue));
+        ur_queue_properties_t properties = {
+            UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, nullptr,
+            UR_QUEUE_FLAG_SUBMISSION_BATCHED};
+        ASSERT_SUCCESS(
+            urQueueCreate(context, device, &properties, &batched_queue));
+    }
+
+    void TearDown() override {
+        if (queue) {
+            EXPECT_SUCCESS(urQueueRelease(queue));
+        }
+        if (batched_queue) {
+            EXPECT_SUCCESS(urQueueRelease(batched_queue));
+        }
+        for (auto *allocation : {src, dst, batched_src, batched_dst}) {
+            if (allocation) {
+                EXPECT_SUCCESS(urUSMFree(context, allocation));
+            }
+        }
+        if (kernel) {
+            EXPECT_SUCCESS(urKernelRelease(kernel));
+        }
+        if (program) {
+            EXPECT_SUCCESS(urProgramRelease(program));
+        }
+        if (context) {
+            EXPECT_SUCCESS(urContextRelease(context));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urDeviceTest::TearDown());
+    }
+
+    // Fills the source, increments it, copies it to the destination and
+    // increments the source again, without waiting in between.
+    void enqueueCommands(ur_queue_handle_t hQueue, void *pSrc, void *pDst) {
+        uint8_t pattern = 7;
+        ASSERT_SUCCESS(urEnqueueUSMFill(hQueue, pSrc, sizeof(pattern),
+                                        &pattern, size, 0, nullptr, nullptr));
+        ASSERT_SUCCESS(urKernelSetArgPointer(kernel, 0, nullptr, &pSrc));
+        size_t offset = 0;
+        size_t local_size = 16;
+        ASSERT_SUCCESS(urEnqueueKernelLaunch(hQueue, kernel, 1, &offset,
+                                             &size, &local_size, 0, nullptr,
+                                             nullptr));
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(hQueue, false, pDst, pSrc, size, 0,
+                                          nullptr, nullptr));
+        ASSERT_SUCCESS(urEnqueueKernelLaunch(hQueue, kernel, 1, &offset,
+                                             &size, &local_size, 0, nullptr,
+                                             nullptr));
+    }
+
+    ur_context_handle_t context = nullptr;
+    variant_entry entries[2] = {};
+    program_header header{};
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    ur_queue_handle_t batched_queue = nullptr;
+    void *src = nullptr;
+    void *dst = nullptr;
+    void *batched_src = nullptr;
+    void *batched_dst = nullptr;
+    size_t size = 4096;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueBatchedTest);
+
+TEST_P(urEnqueueBatchedTest, MatchesUnbatchedQueue) {
+    UUR_RETURN_ON_FATAL_FAILURE(enqueueCommands(queue, src, dst));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    // The batched queue records the commands and submits them all in
+    // urQueueFinish.
+    UUR_RETURN_ON_FATAL_FAILURE(
+        enqueueCommands(batched_queue, batched_src, batched_dst));
+    ASSERT_SUCCESS(urQueueFinish(batched_queue));
+
+    auto *expected_src = static_cast<uint8_t *>(src);
+    auto *expected_dst = static_cast<uint8_t *>(dst);
+    auto *actual_src = static_cast<uint8_t *>(batched_src);
+    auto *actual_dst = static_cast<uint8_t *>(batched_dst);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(expected_src[i], 9) << "byte " << i;
+        ASSERT_EQ(expected_dst[i], 8) << "byte " << i;
+        ASSERT_EQ(actual_src[i], expected_src[i]) << "byte " << i;
+        ASSERT_EQ(actual_dst[i], expected_dst[i]) << "byte " << i;
+    }
+}
@@ -0,0 +1,251 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel_interface.hpp"
+
+#include <uur/fixtures.h>
+
+#include <cstdlib>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace native_cpu_test;
+
+namespace {
+std::mutex threadsMutex;
+std::set<std::thread::id> kernelThreads;
+
+// Writes the global id of every work-item of the work-group. Depending on
+// how the adapter is built it is called once per work-group or once per
+// work-item, the writes are the same either way.
+void writeGlobalIds(const arg_desc *args, kernel_state *state) {
+    auto *out = static_cast<uint32_t *>(args[0].ptr);
+    size_t first = state->workGroupId[0] * state->workGroupSize[0] +
+                   state->globalOffset[0];
+    for (size_t i = 0; i < state->workGroupSize[0]; i++) {
+        out[first + i] = static_cast<uint32_t>(first + i);
+    }
+    std::scoped_lock<std::mutex> lock(threadsMutex);
+    kernelThreads.insert(std::this_thread::get_id());
+}
+
+// Writes the group id and global range seen by each work-group, which are
+// wrong if the launch is split into shards.
+void writeGroupIds(const arg_desc *args, kernel_state *state) {
+    auto *groups = static_cast<uint32_t *>(args[0].ptr);
+    auto *ranges = static_cast<uint32_t *>(args[1].ptr);
+    size_t group = state->workGroupId[0];
+    groups[group] = static_cast<uint32_t>(group);
+    ranges[group] = static_cast<uint32_t>(state->globalRange[0]);
+    std::scoped_lock<std::mutex> lock(threadsMutex);
+    kernelThreads.insert(std::this_thread::get_id());
+}
+
+bool compositeLayerEnabled() {
+    const char *layers = std::getenv("UR_ENABLE_LAYERS");
+    return layers &&
+           std::string(layers).find("UR_LAYER_COMPOSITE") != std::string::npos;
+}
+} // namespace
+
+// Launches on a queue of a device whose sub-devices are in the queue's
+// context, which the composite layer splits across the sub-devices.
+struct urEnqueueKernelLaunchCompositeTest : uur::urDeviceTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urDeviceTest::SetUp());
+        if (!compositeLayerEnabled()) {
+            GTEST_SKIP() << "UR_LAYER_COMPOSITE is not enabled.";
+        }
+
+        uint32_t compute_units = 0;
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_MAX_COMPUTE_UNITS,
+                                       sizeof(compute_units), &compute_units,
+                                       nullptr));
+        if (compute_units < 2) {
+            GTEST_SKIP() << "The device can't be split in two sub-devices.";
+        }
+        ASSERT_SUCCESS(partition(sub_devices));
+
+        std::vector<ur_device_handle_t> devices = {device, sub_devices[0],
+                                                   sub_devices[1]};
+        ASSERT_SUCCESS(urContextCreate(static_cast<uint32_t>(devices.size()),
+                                       devices.data(), nullptr, &context));
+
+        entries[0] = {"write_global_ids",
+                      reinterpret_cast<const unsigned char *>(&writeGlobalIds),
+                      0, "generic"};
+        entries[1] = {"write_group_ids",
+                      reinterpret_cast<const unsigned char *>(&writeGroupIds),
+                      0, "generic"};
+        entries[2] = {nullptr, nullptr, 0, nullptr};
+        header = {PROGRAM_MAGIC, PROGRAM_VERSION, 0, entries};
+        ASSERT_SUCCESS(urProgramCreateWithBinary(
+            context, device, sizeof(header),
+            reinterpret_cast<const uint8_t *>(&header), nullptr, &program));
+        ASSERT_SUCCESS(urKernelCreate(program, "write_global_ids", &kernel));
+
+        ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                        global_size * sizeof(uint32_t),
+                                        &output));
+        ASSERT_SUCCESS(urKernelSetArgPointer(kernel, 0, nullptr, &output));
+
+        // Launches of write_group_ids are not split, see the UR_COMPOSITE
+        // value set by the test.
+        ASSERT_SUCCESS(
+            urKernelCreate(program, "write_group_ids", &group_kernel));
+        ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                        num_groups() * sizeof(uint32_t),
+                                        &group_ids));
+        ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                        num_groups() * sizeof(uint32_t),
+                                        &group_ranges));
+        ASSERT_SUCCESS(
+            urKernelSetArgPointer(group_kernel, 0, nullptr, &group_ids));
+        ASSERT_SUCCESS(
+            urKernelSetArgPointer(group_kernel, 1, nullptr, &group_ranges));
+
+        ASSERT_SUCCESS(urContextGetInfo(context, UR_CONTEXT_INFO_REFERENCE_COUNT,
+                                        sizeof(initial_context_references),
+                                        &initial_context_references, nullptr));
+        ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &queue));
+    }
+
+    void TearDown() override {
+        if (queue) {
+            EXPECT_SUCCESS(urQueueRelease(queue));
+        }
+        if (output) {
+            EXPECT_SUCCESS(urUSMFree(context, output));
+        }
+        if (group_ids) {
+            EXPECT_SUCCESS(urUSMFree(context, group_ids));
+        }
+        if (group_ranges) {
+            EXPECT_SUCCESS(urUSMFree(context, group_ranges));
+        }
+        if (kernel) {
+            EXPECT_SUCCESS(urKernelRelease(kernel));
+        }
+        if (group_kernel) {
+            EXPECT_SUCCESS(urKernelRelease(group_kernel));
+        }
+        if (program) {
+            EXPECT_SUCCESS(urProgramRelease(program));
+        }
+        if (context) {
+            EXPECT_SUCCESS(urContextRelease(context));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urDeviceTest::TearDown());
+    }
+
+    ur_result_t partition(ur_device_handle_t (&sub_devices)[2]) {
+        ur_device_partition_property_t counts[] = {
+            {UR_DEVICE_PARTITION_BY_COUNTS, {1}},
+            {UR_DEVICE_PARTITION_BY_COUNTS, {1}}};
+        ur_device_partition_properties_t properties = {
+            UR_STRUCTURE_TYPE_DEVICE_PARTITION_PROPERTIES, nullptr, counts,
+            2};
+        return urDevicePartition(device, &properties, 2, sub_devices,
+                                 nullptr);
+    }
+
+    size_t num_groups() const { return global_size / local_size; }
+
+    // Launches the kernel over the whole range, then checks every work-item
+    // ran.
+    void launchAndValidate() {
+        std::fill_n(static_cast<uint32_t *>(output), global_size, 0);
+        {
+            std::scoped_lock<std::mutex> lock(threadsMutex);
+            kernelThreads.clear();
+        }
+        size_t offset = 0;
+        ASSERT_SUCCESS(urEnqueueKernelLaunch(queue, kernel, 1, &offset,
+                                             &global_size, &local_size, 0,
+                                             nullptr, nullptr));
+        ASSERT_SUCCESS(urQueueFinish(queue));
+
+        auto *ids = static_cast<uint32_t *>(output);
+        for (size_t i = 0; i < global_size; i++) {
+            ASSERT_EQ(ids[i], i) << "work-item " << i;
+        }
+    }
+
+    ur_device_handle_t sub_devices[2] = {};
+    ur_context_handle_t context = nullptr;
+    variant_entry entries[3] = {};
+    program_header header{};
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    ur_kernel_handle_t group_kernel = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    void *output = nullptr;
+    void *group_ids = nullptr;
+    void *group_ranges = nullptr;
+    uint32_t initial_context_references = 0;
+    size_t global_size = 4096;
+    size_t local_size = 16;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueKernelLaunchCompositeTest);
+
+TEST_P(urEnqueueKernelLaunchCompositeTest, RepeatedPartitionReturnsSameDevices) {
+    ur_device_handle_t again[2] = {};
+    ASSERT_SUCCESS(partition(again));
+    ASSERT_EQ(again[0], sub_devices[0]);
+    ASSERT_EQ(again[1], sub_devices[1]);
+}
+
+TEST_P(urEnqueueKernelLaunchCompositeTest, SplitsAcrossSubDevices) {
+    UUR_RETURN_ON_FATAL_FAILURE(launchAndValidate());
+
+    // Shards of the second sub-device are submitted from another thread, and
+    // the adapter runs them on the submitting thread.
+    std::scoped_lock<std::mutex> lock(threadsMutex);
+    ASSERT_EQ(kernelThreads.size(), 2u);
+}
+
+TEST_P(urEnqueueKernelLaunchCompositeTest, ReleaseDestroysMemberQueues) {
+    // The queue stays composite as long as the application holds a
+    // reference.
+    ASSERT_SUCCESS(urQueueRetain(queue));
+    ASSERT_SUCCESS(urQueueRelease(queue));
+    UUR_RETURN_ON_FATAL_FAILURE(launchAndValidate());
+
+    ASSERT_SUCCESS(urQueueRelease(queue));
+    queue = nullptr;
+
+    // The queues of the queue and its members held the context.
+    uint32_t context_references = 0;
+    ASSERT_SUCCESS(urContextGetInfo(context, UR_CONTEXT_INFO_REFERENCE_COUNT,
+                                    sizeof(context_references),
+                                    &context_references, nullptr));
+    ASSERT_EQ(context_references, initial_context_references);
+}
+
+TEST_P(urEnqueueKernelLaunchCompositeTest, KeepsNDRangeOfKernelsNotSplit) {
+    std::fill_n(static_cast<uint32_t *>(group_ids), num_groups(), 0);
+    std::fill_n(static_cast<uint32_t *>(group_ranges), num_groups(), 0);
+    {
+        std::scoped_lock<std::mutex> lock(threadsMutex);
+        kernelThreads.clear();
+    }
+    size_t offset = 0;
+    ASSERT_SUCCESS(urEnqueueKernelLaunch(queue, group_kernel, 1, &offset,
+                                         &global_size, &local_size, 0,
+                                         nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    auto *ids = static_cast<uint32_t *>(group_ids);
+    auto *ranges = static_cast<uint32_t *>(group_ranges);
+    for (size_t i = 0; i < num_groups(); i++) {
+        ASSERT_EQ(ids[i], i) << "work-group " << i;
+        ASSERT_EQ(ranges[i], global_size) << "work-group " << i;
+    }
+    std::scoped_lock<std::mutex> lock(threadsMutex);
+    ASSERT_EQ(kernelThreads.size(), 1u);
+}
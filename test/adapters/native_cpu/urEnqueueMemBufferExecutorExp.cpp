@@ -0,0 +1,177 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace {
+// Executor running its tasks only when asked to, so the commands submitted to
+// it are still in flight when the enqueue calls return.
+struct deferred_executor_t {
+    static void submit(void *pUserData, ur_exp_executor_task_t pfnTask,
+                       void *pTaskData) {
+        auto *executor = static_cast<deferred_executor_t *>(pUserData);
+        std::scoped_lock<std::mutex> lock(executor->mutex);
+        executor->tasks.emplace_back(pfnTask, pTaskData);
+    }
+
+    void runDeferred() {
+        std::vector<std::pair<ur_exp_executor_task_t, void *>> pending;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            pending.swap(tasks);
+        }
+        for (auto &[pfnTask, pTaskData] : pending) {
+            pfnTask(pTaskData);
+        }
+    }
+
+    std::mutex mutex;
+    std::vector<std::pair<ur_exp_executor_task_t, void *>> tasks;
+};
+} // namespace
+
+// Buffer commands on an out-of-order queue, whose commands are scheduled on
+// the executor of the queue.
+struct urEnqueueMemBufferExecutorExpTest : uur::urContextTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::SetUp());
+
+        ur_exp_queue_executor_properties_t executor_properties = {
+            UR_STRUCTURE_TYPE_EXP_QUEUE_EXECUTOR_PROPERTIES,
+            nullptr,
+            deferred_executor_t::submit,
+            &executor,
+            4,
+        };
+        ur_queue_properties_t queue_properties = {
+            UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, &executor_properties,
+            UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE};
+        ASSERT_SUCCESS(
+            urQueueCreate(context, device, &queue_properties, &queue));
+    }
+
+    void TearDown() override {
+        if (queue) {
+            EXPECT_SUCCESS(urQueueRelease(queue));
+        }
+        executor.runDeferred();
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::TearDown());
+    }
+
+    ur_mem_handle_t createBuffer() {
+        ur_mem_handle_t buffer = nullptr;
+        EXPECT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE,
+                                         size * sizeof(uint32_t), nullptr,
+                                         &buffer));
+        return buffer;
+    }
+
+    void fill(ur_mem_handle_t buffer, uint32_t value, ur_event_handle_t *event,
+              size_t offset = 0, size_t count = size) {
+        ASSERT_SUCCESS(urEnqueueMemBufferFill(
+            queue, buffer, &value, sizeof(value), offset * sizeof(uint32_t),
+            count * sizeof(uint32_t), 0, nullptr, event));
+    }
+
+    deferred_executor_t executor;
+    ur_queue_handle_t queue = nullptr;
+    static constexpr size_t size = 1024;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueMemBufferExecutorExpTest);
+
+TEST_P(urEnqueueMemBufferExecutorExpTest, BufferReleasedWhileInFlight) {
+    ur_mem_handle_t buffer = createBuffer();
+    ASSERT_NE(buffer, nullptr);
+
+    std::vector<uint32_t> output(size, 0);
+    fill(buffer, 42, nullptr);
+    ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, buffer, false, 0,
+                                          size * sizeof(uint32_t),
+                                          output.data(), 0, nullptr, nullptr));
+    // Neither command has run yet, they keep the buffer alive until they
+    // have.
+    ASSERT_SUCCESS(urMemRelease(buffer));
+    executor.runDeferred();
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    EXPECT_EQ(output, std::vector<uint32_t>(size, 42));
+}
+
+TEST_P(urEnqueueMemBufferExecutorExpTest, OutOfOrderDependencies) {
+    ur_mem_handle_t src = createBuffer();
+    ur_mem_handle_t dst = createBuffer();
+    ASSERT_NE(src, nullptr);
+    ASSERT_NE(dst, nullptr);
+
+    ur_event_handle_t fills[2] = {};
+    fill(src, 1, &fills[0]);
+    fill(dst, 2, &fills[1]);
+    // Copies the first half of src over dst once both fills are complete.
+    ur_event_handle_t copy = nullptr;
+    ASSERT_SUCCESS(urEnqueueMemBufferCopy(queue, src, dst, 0, 0,
+                                          size / 2 * sizeof(uint32_t), 2, fills,
+                                          &copy));
+    // Overwrites src once the copy has read it.
+    fill(src, 3, nullptr);
+
+    std::vector<uint32_t> output(size, 0);
+    ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, dst, false, 0,
+                                          size * sizeof(uint32_t),
+                                          output.data(), 1, &copy, nullptr));
+    ASSERT_SUCCESS(urMemRelease(src));
+    ASSERT_SUCCESS(urMemRelease(dst));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(output[i], i < size / 2 ? 1u : 2u) << "index " << i;
+    }
+    for (auto event : fills) {
+        EXPECT_SUCCESS(urEventRelease(event));
+    }
+    EXPECT_SUCCESS(urEventRelease(copy));
+}
+
+TEST_P(urEnqueueMemBufferExecutorExpTest, RetainedBufferOutlivesRelease) {
+    ur_mem_handle_t buffer = createBuffer();
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_SUCCESS(urMemRetain(buffer));
+    ASSERT_SUCCESS(urMemRelease(buffer));
+
+    std::vector<uint32_t> output(size, 0);
+    fill(buffer, 7, nullptr);
+    ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, buffer, true, 0,
+                                          size * sizeof(uint32_t),
+                                          output.data(), 0, nullptr, nullptr));
+    EXPECT_EQ(output, std::vector<uint32_t>(size, 7));
+    ASSERT_SUCCESS(urMemRelease(buffer));
+}
+
+TEST_P(urEnqueueMemBufferExecutorExpTest, SubBufferKeepsParentAlive) {
+    ur_mem_handle_t buffer = createBuffer();
+    ASSERT_NE(buffer, nullptr);
+    ur_buffer_region_t region = {UR_STRUCTURE_TYPE_BUFFER_REGION, nullptr,
+                                 size / 2 * sizeof(uint32_t),
+                                 size / 2 * sizeof(uint32_t)};
+    ur_mem_handle_t sub_buffer = nullptr;
+    ASSERT_SUCCESS(urMemBufferPartition(buffer, UR_MEM_FLAG_READ_WRITE,
+                                        UR_BUFFER_CREATE_TYPE_REGION, &region,
+                                        &sub_buffer));
+    // The memory of the sub-buffer belongs to the buffer.
+    ASSERT_SUCCESS(urMemRelease(buffer));
+
+    std::vector<uint32_t> output(size / 2, 0);
+    fill(sub_buffer, 5, nullptr, 0, size / 2);
+    ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, sub_buffer, false, 0,
+                                          size / 2 * sizeof(uint32_t),
+                                          output.data(), 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urMemRelease(sub_buffer));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    EXPECT_EQ(output, std::vector<uint32_t>(size / 2, 5));
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel_interface.hpp"
+
+#include <uur/fixtures.h>
+
+#include <string>
+#include <vector>
+
+using namespace native_cpu_test;
+
+// Features required by kernel variants, see
+// source/adapters/native_cpu/program.hpp.
+namespace {
+constexpr uint64_t ISA_SSE4_2 = 1ull << 0;
+constexpr uint64_t ISA_AVX2 = 1ull << 2;
+constexpr uint64_t ISA_FMA = 1ull << 3;
+constexpr uint64_t ISA_AVX512F = 1ull << 4;
+// Not assigned to any feature, so never supported by the host.
+constexpr uint64_t ISA_UNKNOWN = 1ull << 63;
+
+// Never called, the variants are only selected, not launched.
+void kernelBody() {}
+
+bool hostSupports(const char *feature) {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    std::string name = feature;
+    if (name == "sse4.2") {
+        return __builtin_cpu_supports("sse4.2");
+    }
+    if (name == "avx2") {
+        return __builtin_cpu_supports("avx2");
+    }
+    if (name == "fma") {
+        return __builtin_cpu_supports("fma");
+    }
+    if (name == "avx512f") {
+        return __builtin_cpu_supports("avx512f");
+    }
+#endif
+    std::ignore = feature;
+    return false;
+}
+} // namespace
+
+struct urNativeCpuProgramVariantTest : uur::urContextTest {
+    void TearDown() override {
+        if (kernel) {
+            EXPECT_SUCCESS(urKernelRelease(kernel));
+        }
+        if (program) {
+            EXPECT_SUCCESS(urProgramRelease(program));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::TearDown());
+    }
+
+    // Creates a program with one kernel made of the given variants and
+    // returns the variant the adapter selected for this host.
+    std::string selectVariant(
+        std::vector<std::pair<uint64_t, const char *>> variants) {
+        for (auto &[features, name] : variants) {
+            entries.push_back({"kernel",
+                               reinterpret_cast<const unsigned char *>(
+                                   &kernelBody),
+                               features, name});
+        }
+        entries.push_back({nullptr, nullptr, 0, nullptr});
+        header = {PROGRAM_MAGIC, PROGRAM_VERSION, 0, entries.data()};
+
+        EXPECT_SUCCESS(urProgramCreateWithBinary(
+            context, device, sizeof(header),
+            reinterpret_cast<const uint8_t *>(&header), nullptr, &program));
+        EXPECT_SUCCESS(urKernelCreate(program, "kernel", &kernel));
+        if (!kernel) {
+            return {};
+        }
+
+        size_t size = 0;
+        EXPECT_SUCCESS(urKernelGetInfo(kernel, UR_KERNEL_INFO_VARIANT_EXP, 0,
+                                       nullptr, &size));
+        std::string variant(size, '\0');
+        EXPECT_SUCCESS(urKernelGetInfo(kernel, UR_KERNEL_INFO_VARIANT_EXP,
+                                       size, variant.data(), nullptr));
+        variant.resize(variant.find('\0'));
+        return variant;
+    }
+
+    std::vector<variant_entry> entries;
+    program_header header{};
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuProgramVariantTest);
+
+TEST_P(urNativeCpuProgramVariantTest, UnsupportedVariantSkipped) {
+    ASSERT_EQ(selectVariant({{ISA_UNKNOWN, "unknown"}, {0, "generic"}}),
+              "generic");
+}
+
+TEST_P(urNativeCpuProgramVariantTest, AVX2PreferredToFMA) {
+    if (!hostSupports("avx2") || !hostSupports("fma")) {
+        GTEST_SKIP() << "AVX2 and FMA are not supported";
+    }
+    // FMA has the higher bit, the order of the entries must not matter.
+    ASSERT_EQ(selectVariant({{0, "generic"},
+                             {ISA_AVX2, "avx2"},
+                             {ISA_FMA, "fma"},
+                             {ISA_SSE4_2, "sse4.2"}}),
+              "avx2");
+}
+
+TEST_P(urNativeCpuProgramVariantTest, MoreFeaturesPreferred) {
+    if (!hostSupports("avx2") || !hostSupports("fma")) {
+        GTEST_SKIP() << "AVX2 and FMA are not supported";
+    }
+    ASSERT_EQ(selectVariant(
+                  {{ISA_AVX2, "avx2"}, {ISA_AVX2 | ISA_FMA, "avx2_fma"}}),
+              "avx2_fma");
+}
+
+TEST_P(urNativeCpuProgramVariantTest, AVX512PreferredToAVX2) {
+    if (!hostSupports("avx512f") || !hostSupports("fma")) {
+        GTEST_SKIP() << "AVX-512 is not supported";
+    }
+    ASSERT_EQ(selectVariant({{ISA_AVX512F, "avx512f"},
+                             {ISA_AVX2 | ISA_FMA, "avx2_fma"}}),
+              "avx512f");
+}
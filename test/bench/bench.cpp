@@ -0,0 +1,251 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace bench {
+
+// Version of the JSON output, bumped on incompatible changes.
+constexpr int SCHEMA_VERSION = 1;
+
+namespace {
+
+struct options_t {
+    std::string filter;
+    std::vector<size_t> threads;
+    double minTimeMs = 100;
+    size_t repetitions = 5;
+    std::string output;
+    bool list = false;
+};
+
+struct result_t {
+    std::string name;
+    size_t threads;
+    uint64_t iterations;
+    // Nanoseconds per operation of each repetition, sorted.
+    std::vector<double> nsPerOp;
+};
+
+void printUsage(const char *argv0) {
+    std::cerr
+        << "Usage: " << argv0 << " [options]\n"
+        << "  --filter=<text>      run the benchmarks whose name contains "
+           "text\n"
+        << "  --threads=<n,...>    thread counts to run each benchmark "
+           "with\n"
+        << "                       (default: 1 and the number of hardware "
+           "threads)\n"
+        << "  --min-time=<ms>      minimum duration of a repetition "
+           "(default: 100)\n"
+        << "  --repetitions=<n>    number of measured repetitions "
+           "(default: 5)\n"
+        << "  --output=<path>      write the results to path instead of "
+           "stdout\n"
+        << "  --list               print the names of the benchmarks\n";
+}
+
+bool parseOptions(int argc, char **argv, options_t &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto eq = arg.find('=');
+        std::string name = arg.substr(0, eq);
+        std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        try {
+            if (name == "--filter") {
+                options.filter = value;
+            } else if (name == "--threads") {
+                std::stringstream list(value);
+                std::string count;
+                while (std::getline(list, count, ',')) {
+                    options.threads.push_back(std::stoul(count));
+                }
+            } else if (name == "--min-time") {
+                options.minTimeMs = std::stod(value);
+            } else if (name == "--repetitions") {
+                options.repetitions = std::stoul(value);
+            } else if (name == "--output") {
+                options.output = value;
+            } else if (name == "--list") {
+                options.list = true;
+            } else {
+                return false;
+            }
+        } catch (const std::exception &) {
+            return false;
+        }
+    }
+
+    if (options.threads.empty()) {
+        options.threads.push_back(1);
+        size_t hardwareThreads = std::thread::hardware_concurrency();
+        if (hardwareThreads > 1) {
+            options.threads.push_back(hardwareThreads);
+        }
+    }
+    return options.repetitions > 0 &&
+           std::none_of(options.threads.begin(), options.threads.end(),
+                        [](size_t count) { return count == 0; });
+}
+
+// Returns the wall time in nanoseconds taken by numThreads threads running
+// the benchmark for the given number of iterations each. The threads are
+// released together once all of them are started.
+double measure(const benchmark_t &benchmark, size_t numThreads,
+               uint64_t iterations) {
+    run_fn_t run = benchmark.setup(numThreads);
+
+    std::atomic<size_t> ready = 0;
+    std::atomic<bool> start = false;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back([&, i] {
+            ready++;
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            run(i, iterations);
+        });
+    }
+
+    while (ready.load() < numThreads) {
+        std::this_thread::yield();
+    }
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count();
+}
+
+result_t runBenchmark(const benchmark_t &benchmark, size_t numThreads,
+                      const options_t &options) {
+    double minTimeNs = options.minTimeMs * 1e6;
+
+    // Grows the iteration count until a run lasts the minimum time.
+    uint64_t iterations = 1;
+    for (;;) {
+        double elapsed = measure(benchmark, numThreads, iterations);
+        if (elapsed >= minTimeNs) {
+            break;
+        }
+        double scale = elapsed > 0 ? 1.4 * minTimeNs / elapsed : 10;
+        auto next = static_cast<uint64_t>(static_cast<double>(iterations) *
+                                          std::min(scale, 10.0));
+        iterations = std::max(iterations + 1, next);
+    }
+
+    result_t result{benchmark.name, numThreads, iterations, {}};
+    for (size_t i = 0; i < options.repetitions; i++) {
+        result.nsPerOp.push_back(measure(benchmark, numThreads, iterations) /
+                                 static_cast<double>(iterations));
+    }
+    std::sort(result.nsPerOp.begin(), result.nsPerOp.end());
+    return result;
+}
+
+std::string quote(const std::string &text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+void writeResults(std::ostream &out, const char *suite,
+                  const options_t &options,
+                  const std::vector<result_t> &results) {
+    out << "{\n"
+        << "  \"schema_version\": " << SCHEMA_VERSION << ",\n"
+        << "  \"suite\": " << quote(suite) << ",\n"
+        << "  \"context\": {\n"
+        << "    \"hardware_threads\": " << std::thread::hardware_concurrency()
+        << ",\n"
+        << "    \"min_time_ms\": " << options.minTimeMs << ",\n"
+        << "    \"repetitions\": " << options.repetitions << "\n"
+        << "  },\n"
+        << "  \"results\": [";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto &result = results[i];
+        double median = result.nsPerOp[result.nsPerOp.size() / 2];
+        double opsPerSec = median > 0 ? 1e9 * result.threads / median : 0;
+
+        out << (i ? ",\n" : "\n") << "    {\n"
+            << "      \"name\": " << quote(result.name) << ",\n"
+            << "      \"threads\": " << result.threads << ",\n"
+            << "      \"iterations\": " << result.iterations << ",\n"
+            << "      \"ns_per_op\": {\"median\": " << median
+            << ", \"min\": " << result.nsPerOp.front()
+            << ", \"max\": " << result.nsPerOp.back() << "},\n"
+            << "      \"ops_per_sec\": " << opsPerSec << "\n"
+            << "    }";
+    }
+    out << (results.empty() ? "]\n" : "\n  ]\n") << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv, const char *suite,
+         const std::vector<benchmark_t> &benchmarks) {
+    options_t options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<const benchmark_t *> selected;
+    for (const auto &benchmark : benchmarks) {
+        if (benchmark.name.find(options.filter) != std::string::npos) {
+            selected.push_back(&benchmark);
+        }
+    }
+
+    if (options.list) {
+        for (const auto *benchmark : selected) {
+            std::cout << benchmark->name << "\n";
+        }
+        return 0;
+    }
+
+    std::vector<result_t> results;
+    for (const auto *benchmark : selected) {
+        for (size_t numThreads : options.threads) {
+            std::cerr << benchmark->name << " (" << numThreads
+                      << " threads)\n";
+            results.push_back(runBenchmark(*benchmark, numThreads, options));
+        }
+    }
+
+    if (options.output.empty()) {
+        writeResults(std::cout, suite, options, results);
+        return 0;
+    }
+
+    std::ofstream file(options.output);
+    writeResults(file, suite, options, results);
+    if (!file) {
+        std::cerr << "Failed to write " << options.output << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,46 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_BENCH_HPP
+#define UR_BENCH_HPP 1
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Repeats the measured operation the given number of times on the thread
+// with the given index.
+using run_fn_t = std::function<void(size_t thread, uint64_t iterations)>;
+
+struct benchmark_t {
+    std::string name;
+    // Creates the state shared by the threads of one measurement and returns
+    // the function they run. Called again for every measurement, so that
+    // state grown by one does not leak into the next.
+    std::function<run_fn_t(size_t numThreads)> setup;
+};
+
+// Keeps the compiler from optimizing away the computation of value.
+template <typename T> inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+// Runs the benchmarks selected by the command line and writes their results
+// as JSON, see README.md for the options and the schema.
+int main(int argc, char **argv, const char *suite,
+         const std::vector<benchmark_t> &benchmarks);
+
+} // namespace bench
+
+#endif /* UR_BENCH_HPP */
@@ -0,0 +1,239 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "bench.hpp"
+
+#include "logger/ur_logger.hpp"
+#include "ur/ur.hpp"
+#include "ur_pool_manager.hpp"
+#include "ur_print.h"
+#include "ur_singleton.hpp"
+#include "ur_util.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <memory>
+
+namespace {
+
+// Number of distinct keys the lookups cycle through.
+constexpr size_t NUM_KEYS = 16;
+
+struct object_t {
+    explicit object_t(int *key) : key(key) {}
+    int *key;
+};
+
+bench::benchmark_t singletonFactoryGetInstance() {
+    return {"singleton_factory/getInstance", [](size_t) -> bench::run_fn_t {
+                auto keys = std::make_shared<std::array<int, NUM_KEYS>>();
+                auto factory = std::make_shared<
+                    singleton_factory_t<object_t, int *>>();
+                for (auto &key : *keys) {
+                    factory->getInstance(&key);
+                }
+
+                return [keys, factory](size_t thread, uint64_t iterations) {
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        auto &key = (*keys)[(thread + i) % NUM_KEYS];
+                        bench::doNotOptimize(factory->getInstance(&key));
+                    }
+                };
+            }};
+}
+
+bench::benchmark_t poolManagerGetPool() {
+    return {"pool_manager/getPool", [](size_t) -> bench::run_fn_t {
+                // Descriptors without a device, comparing them does not call
+                // into an adapter.
+                auto descriptors =
+                    std::make_shared<std::vector<usm::pool_descriptor>>();
+                auto manager = std::make_shared<
+                    usm::pool_manager<usm::pool_descriptor>>();
+                for (uintptr_t pool = 1; descriptors->size() < NUM_KEYS;
+                     pool++) {
+                    for (auto type : {UR_USM_TYPE_HOST, UR_USM_TYPE_DEVICE,
+                                      UR_USM_TYPE_SHARED}) {
+                        usm::pool_descriptor desc{
+                            reinterpret_cast<ur_usm_pool_handle_t>(pool),
+                            nullptr, nullptr, type, false};
+                        umf::pool_unique_handle_t hPool(
+                            reinterpret_cast<umf_memory_pool_handle_t>(
+                                descriptors->size() + 1),
+                            [](umf_memory_pool_handle_t) {});
+                        manager->addPool(desc, hPool);
+                        descriptors->push_back(desc);
+                    }
+                }
+
+                return [descriptors, manager](size_t thread,
+                                              uint64_t iterations) {
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        auto &desc =
+                            (*descriptors)[(thread + i) % descriptors->size()];
+                        bench::doNotOptimize(manager->getPool(desc));
+                    }
+                };
+            }};
+}
+
+// Formats messages without writing them anywhere, nor taking the lock of the
+// default Sink::print.
+class null_sink_t : public logger::Sink {
+  public:
+    null_sink_t() : Sink("bench") {}
+
+  protected:
+    void print(logger::Level, const std::string &msg) override {
+        bench::doNotOptimize(msg.size());
+    }
+};
+
+bench::benchmark_t sinkLog() {
+    return {"logger/Sink::log", [](size_t) -> bench::run_fn_t {
+                auto sink = std::make_shared<null_sink_t>();
+                return [sink](size_t thread, uint64_t iterations) {
+                    std::string name = "urEnqueueKernelLaunch";
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        sink->log(logger::Level::INFO,
+                                  "{} on thread {} returned {} after {} ns",
+                                  name, thread, UR_RESULT_SUCCESS, i);
+                    }
+                };
+            }};
+}
+
+bench::benchmark_t loggerBelowLevel() {
+    return {"logger/below_level", [](size_t) -> bench::run_fn_t {
+                auto logger = std::make_shared<logger::Logger>(
+                    logger::Level::ERR, std::make_unique<null_sink_t>());
+                return [logger](size_t thread, uint64_t iterations) {
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        logger->debug("thread {} iteration {}", thread, i);
+                    }
+                };
+            }};
+}
+
+bench::benchmark_t getenvToMap() {
+    return {"getenv_to_map", [](size_t) -> bench::run_fn_t {
+                const char *value =
+                    "level:debug;flush:error;output:file,ur_bench.log";
+#ifdef _WIN32
+                _putenv_s("UR_BENCH_ENV_VAR", value);
+#else
+                setenv("UR_BENCH_ENV_VAR", value, 1);
+#endif
+                return [](size_t, uint64_t iterations) {
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        bench::doNotOptimize(getenv_to_map("UR_BENCH_ENV_VAR"));
+                    }
+                };
+            }};
+}
+
+struct shared_state_t {
+    ur_shared_mutex mutex;
+    uint64_t counter = 0;
+};
+
+bench::benchmark_t sharedMutexRead() {
+    return {"ur_shared_mutex/lock_shared", [](size_t) -> bench::run_fn_t {
+                auto state = std::make_shared<shared_state_t>();
+                return [state](size_t, uint64_t iterations) {
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        std::shared_lock<ur_shared_mutex> lock(state->mutex);
+                        bench::doNotOptimize(state->counter);
+                    }
+                };
+            }};
+}
+
+bench::benchmark_t sharedMutexWrite() {
+    return {"ur_shared_mutex/lock", [](size_t) -> bench::run_fn_t {
+                auto state = std::make_shared<shared_state_t>();
+                return [state](size_t, uint64_t iterations) {
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        std::scoped_lock<ur_shared_mutex> lock(state->mutex);
+                        state->counter++;
+                    }
+                };
+            }};
+}
+
+bench::benchmark_t combineHashes() {
+    return {"combine_hashes", [](size_t) -> bench::run_fn_t {
+                return [](size_t thread, uint64_t iterations) {
+                    auto *handle = reinterpret_cast<void *>(thread);
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        bench::doNotOptimize(combine_hashes(
+                            0, UR_USM_TYPE_DEVICE, handle, i, true));
+                    }
+                };
+            }};
+}
+
+bench::benchmark_t printResult() {
+    return {"urPrintResult", [](size_t) -> bench::run_fn_t {
+                return [](size_t, uint64_t iterations) {
+                    char buffer[256];
+                    size_t size = 0;
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        urPrintResult(UR_RESULT_ERROR_INVALID_KERNEL_NAME,
+                                      buffer, sizeof(buffer), &size);
+                        bench::doNotOptimize(buffer);
+                    }
+                };
+            }};
+}
+
+bench::benchmark_t printKernelLaunchParams() {
+    return {"urPrintEnqueueKernelLaunchParams", [](size_t) -> bench::run_fn_t {
+                return [](size_t, uint64_t iterations) {
+                    auto hQueue = reinterpret_cast<ur_queue_handle_t>(0x1);
+                    auto hKernel = reinterpret_cast<ur_kernel_handle_t>(0x2);
+                    uint32_t workDim = 3;
+                    size_t offset[] = {0, 0, 0};
+                    size_t global[] = {1024, 1024, 64};
+                    size_t local[] = {16, 16, 4};
+                    const size_t *pOffset = offset;
+                    const size_t *pGlobal = global;
+                    const size_t *pLocal = local;
+                    uint32_t numEvents = 0;
+                    const ur_event_handle_t *phWaitList = nullptr;
+                    ur_event_handle_t *phEvent = nullptr;
+                    ur_enqueue_kernel_launch_params_t params = {
+                        &hQueue,    &hKernel,    &workDim,
+                        &pOffset,   &pGlobal,    &pLocal,
+                        &numEvents, &phWaitList, &phEvent};
+
+                    char buffer[1024];
+                    size_t size = 0;
+                    for (uint64_t i = 0; i < iterations; i++) {
+                        urPrintEnqueueKernelLaunchParams(
+                            &params, buffer, sizeof(buffer), &size);
+                        bench::doNotOptimize(buffer);
+                    }
+                };
+            }};
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    return bench::main(argc, argv, "common",
+                       {
+                           singletonFactoryGetInstance(),
+                           poolManagerGetPool(),
+                           sinkLog(),
+                           loggerBelowLevel(),
+                           getenvToMap(),
+                           sharedMutexRead(),
+                           sharedMutexWrite(),
+                           combineHashes(),
+                           printResult(),
+                           printKernelLaunchParams(),
+                       });
+}
@@ -0,0 +1,137 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Executor running its tasks either inside the submit callback or only when
+// asked to, after the launches that submitted them have returned.
+struct test_executor_t {
+    explicit test_executor_t(bool deferred) : deferred(deferred) {}
+
+    static void submit(void *pUserData, ur_exp_executor_task_t pfnTask,
+                       void *pTaskData) {
+        auto *executor = static_cast<test_executor_t *>(pUserData);
+        executor->submitted++;
+        if (!executor->deferred) {
+            pfnTask(pTaskData);
+            return;
+        }
+        std::scoped_lock<std::mutex> lock(executor->mutex);
+        executor->tasks.emplace_back(pfnTask, pTaskData);
+    }
+
+    // Runs the deferred tasks, each of them must be run exactly once.
+    void runDeferred() {
+        std::vector<std::pair<ur_exp_executor_task_t, void *>> pending;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            pending.swap(tasks);
+        }
+        for (auto &[pfnTask, pTaskData] : pending) {
+            pfnTask(pTaskData);
+        }
+    }
+
+    bool deferred;
+    std::atomic<uint32_t> submitted = 0;
+    std::mutex mutex;
+    std::vector<std::pair<ur_exp_executor_task_t, void *>> tasks;
+};
+
+struct urEnqueueKernelLaunchExecutorExpTest : uur::urKernelExecutionTest {
+    void SetUp() override {
+        program_name = "fill";
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urKernelExecutionTest::SetUp());
+
+        size_t size = 0;
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS, 0,
+                                       nullptr, &size));
+        std::string extensions(size, '\0');
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS, size,
+                                       extensions.data(), nullptr));
+        if (extensions.find(UR_QUEUE_EXECUTOR_EXTENSION_STRING_EXP) ==
+            std::string::npos) {
+            GTEST_SKIP() << "EXP queue executor feature is not supported.";
+        }
+    }
+
+    void TearDown() override {
+        // Tasks keep what they need alive, they may run after the queue is
+        // gone.
+        if (executor_queue) {
+            EXPECT_SUCCESS(urQueueRelease(executor_queue));
+        }
+        if (executor) {
+            executor->runDeferred();
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urKernelExecutionTest::TearDown());
+    }
+
+    void CreateExecutorQueue(bool deferred) {
+        executor = std::make_unique<test_executor_t>(deferred);
+        ur_exp_queue_executor_properties_t executor_properties = {
+            UR_STRUCTURE_TYPE_EXP_QUEUE_EXECUTOR_PROPERTIES,
+            nullptr,
+            test_executor_t::submit,
+            executor.get(),
+            4,
+        };
+        ur_queue_properties_t queue_properties = {
+            UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, &executor_properties, 0};
+        ASSERT_SUCCESS(urQueueCreate(context, device, &queue_properties,
+                                     &executor_queue));
+    }
+
+    // Fills the buffer with launches on the executor queue, then checks the
+    // executor ran them and the result.
+    void LaunchAndValidate(uint32_t launches) {
+        ur_mem_handle_t buffer = nullptr;
+        AddBuffer1DArg(sizeof(val) * global_size, &buffer);
+        AddPodArg(val);
+        for (uint32_t i = 0; i < launches; i++) {
+            ASSERT_SUCCESS(urEnqueueKernelLaunch(
+                executor_queue, kernel, 1, &global_offset, &global_size,
+                &local_size, 0, nullptr, nullptr));
+        }
+        // Deferred tasks must not keep the launches from completing.
+        ASSERT_SUCCESS(urQueueFinish(executor_queue));
+        ASSERT_GT(executor->submitted.load(), 0u);
+        ValidateBuffer(buffer, sizeof(val) * global_size, val);
+    }
+
+    std::unique_ptr<test_executor_t> executor;
+    ur_queue_handle_t executor_queue = nullptr;
+    uint32_t val = 42;
+    size_t global_size = 1024;
+    size_t local_size = 4;
+    size_t global_offset = 0;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueKernelLaunchExecutorExpTest);
+
+TEST_P(urEnqueueKernelLaunchExecutorExpTest, SuccessInline) {
+    UUR_RETURN_ON_FATAL_FAILURE(CreateExecutorQueue(false));
+    UUR_RETURN_ON_FATAL_FAILURE(LaunchAndValidate(1));
+}
+
+TEST_P(urEnqueueKernelLaunchExecutorExpTest, SuccessDeferred) {
+    UUR_RETURN_ON_FATAL_FAILURE(CreateExecutorQueue(true));
+    UUR_RETURN_ON_FATAL_FAILURE(LaunchAndValidate(1));
+}
+
+TEST_P(urEnqueueKernelLaunchExecutorExpTest, SuccessMultipleLaunchesInline) {
+    UUR_RETURN_ON_FATAL_FAILURE(CreateExecutorQueue(false));
+    UUR_RETURN_ON_FATAL_FAILURE(LaunchAndValidate(4));
+}
+
+TEST_P(urEnqueueKernelLaunchExecutorExpTest, SuccessMultipleLaunchesDeferred) {
+    UUR_RETURN_ON_FATAL_FAILURE(CreateExecutorQueue(true));
+    UUR_RETURN_ON_FATAL_FAILURE(LaunchAndValidate(4));
+}
@@ -33,6 +33,48 @@ UUR_TEST_SUITE_P(urEventGetProfilingInfoTest,
                                    UR_PROFILING_INFO_COMMAND_END),
                  uur::deviceTestWithParamPrinter<ur_profiling_info_t>);
 
+using urEventGetProfilingInfoCommandTest = uur::event::urEventTest;
+
+TEST_P(urEventGetProfilingInfoCommandTest, StartBeforeEnd) {
+    uint64_t start = 0;
+    uint64_t end = 0;
+    ASSERT_SUCCESS(urEventGetProfilingInfo(event,
+                                           UR_PROFILING_INFO_COMMAND_START,
+                                           sizeof(start), &start, nullptr));
+    ASSERT_SUCCESS(urEventGetProfilingInfo(event, UR_PROFILING_INFO_COMMAND_END,
+                                           sizeof(end), &end, nullptr));
+    ASSERT_LE(start, end);
+}
+
+TEST_P(urEventGetProfilingInfoCommandTest, Counters) {
+    size_t size = 0;
+    ASSERT_SUCCESS(
+        urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS, 0, nullptr, &size));
+    std::string extensions(size, '\0');
+    ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS, size,
+                                   extensions.data(), nullptr));
+    if (extensions.find(UR_PROFILING_COUNTERS_EXTENSION_STRING_EXP) ==
+        std::string::npos) {
+        GTEST_SKIP() << "EXP profiling counters feature is not supported.";
+    }
+
+    for (auto info_type :
+         {UR_PROFILING_INFO_CYCLES_EXP, UR_PROFILING_INFO_INSTRUCTIONS_EXP}) {
+        uint64_t value = 0;
+        ur_result_t result = urEventGetProfilingInfo(
+            event, info_type, sizeof(value), &value, nullptr);
+        // Counters may be unavailable on the host, for example if their
+        // access is forbidden.
+        if (result == UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE) {
+            GTEST_SKIP() << "Profiling counters are not available.";
+        }
+        ASSERT_SUCCESS(result);
+        ASSERT_NE(value, 0u);
+    }
+}
+
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEventGetProfilingInfoCommandTest);
+
 using urEventGetProfilingInfoNegativeTest = uur::event::urEventTest;
 
 TEST_P(urEventGetProfilingInfoNegativeTest, InvalidNullHandle) {
@@ -0,0 +1,109 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urKernelCloneExpTest : uur::urKernelExecutionTest {
+    void SetUp() override {
+        program_name = "fill";
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::SetUp());
+
+        size_t returned_size;
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS, 0,
+                                       nullptr, &returned_size));
+
+        std::unique_ptr<char[]> returned_extensions(new char[returned_size]);
+
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS,
+                                       returned_size, returned_extensions.get(),
+                                       nullptr));
+
+        std::string_view extensions_string(returned_extensions.get());
+        if (extensions_string.find(UR_KERNEL_CLONE_EXTENSION_STRING_EXP) ==
+            std::string::npos) {
+            GTEST_SKIP() << "EXP kernel clone feature is not supported.";
+        }
+    }
+
+    void TearDown() override {
+        if (clone) {
+            EXPECT_SUCCESS(urKernelRelease(clone));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::TearDown());
+    }
+
+    void Launch(ur_kernel_handle_t hKernel) {
+        size_t offset = 0;
+        ASSERT_SUCCESS(urEnqueueKernelLaunch(queue, hKernel, 1, &offset,
+                                             &global_size, nullptr, 0, nullptr,
+                                             nullptr));
+        ASSERT_SUCCESS(urQueueFinish(queue));
+    }
+
+    ur_kernel_handle_t clone = nullptr;
+    uint32_t arg_value = 42;
+    size_t global_size = 32;
+};
+UUR_INSTANTIATE_KERNEL_TEST_SUITE_P(urKernelCloneExpTest);
+
+TEST_P(urKernelCloneExpTest, Success) {
+    ASSERT_SUCCESS(urKernelCloneExp(kernel, &clone));
+    ASSERT_NE(clone, nullptr);
+    ASSERT_NE(clone, kernel);
+
+    size_t name_size = 0;
+    ASSERT_SUCCESS(urKernelGetInfo(clone, UR_KERNEL_INFO_FUNCTION_NAME, 0,
+                                   nullptr, &name_size));
+    std::vector<char> name(name_size);
+    ASSERT_SUCCESS(urKernelGetInfo(clone, UR_KERNEL_INFO_FUNCTION_NAME,
+                                   name_size, name.data(), nullptr));
+    ASSERT_EQ(kernel_name, std::string(name.data()));
+}
+
+TEST_P(urKernelCloneExpTest, SuccessArgsSet) {
+    ur_mem_handle_t buffer = nullptr;
+    const size_t buffer_size = sizeof(arg_value) * global_size;
+    AddBuffer1DArg(buffer_size, &buffer);
+    AddPodArg(arg_value);
+    ASSERT_SUCCESS(urKernelCloneExp(kernel, &clone));
+
+    // The clone runs with the arguments set on the original.
+    Launch(clone);
+    ValidateBuffer(buffer, buffer_size, arg_value);
+
+    // Modifying the arguments of either kernel doesn't affect the other one.
+    const uint32_t value_index = current_arg_index - 1;
+    uint32_t other_value = 7;
+    ASSERT_SUCCESS(urKernelSetArgValue(clone, value_index, sizeof(other_value),
+                                       nullptr, &other_value));
+    Launch(clone);
+    ValidateBuffer(buffer, buffer_size, other_value);
+
+    Launch(kernel);
+    ValidateBuffer(buffer, buffer_size, arg_value);
+}
+
+TEST_P(urKernelCloneExpTest, SuccessReleaseOriginal) {
+    ASSERT_SUCCESS(
+        urKernelSetArgValue(kernel, 2, sizeof(arg_value), nullptr, &arg_value));
+    ASSERT_SUCCESS(urKernelCloneExp(kernel, &clone));
+    ASSERT_SUCCESS(urKernelRelease(kernel));
+    kernel = nullptr;
+
+    uint32_t ref_count = 0;
+    ASSERT_SUCCESS(urKernelGetInfo(clone, UR_KERNEL_INFO_REFERENCE_COUNT,
+                                   sizeof(ref_count), &ref_count, nullptr));
+    ASSERT_EQ(ref_count, 1);
+}
+
+TEST_P(urKernelCloneExpTest, InvalidNullHandleKernel) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urKernelCloneExp(nullptr, &clone));
+}
+
+TEST_P(urKernelCloneExpTest, InvalidNullPointerKernelClone) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urKernelCloneExp(kernel, nullptr));
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+#include <condition_variable>
+#include <mutex>
+
+struct urProgramBuildAsyncExpTest : uur::urProgramTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urProgramTest::SetUp());
+
+        size_t returned_size;
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS, 0,
+                                       nullptr, &returned_size));
+
+        std::unique_ptr<char[]> returned_extensions(new char[returned_size]);
+
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS,
+                                       returned_size, returned_extensions.get(),
+                                       nullptr));
+
+        std::string_view extensions_string(returned_extensions.get());
+        if (extensions_string.find(
+                UR_PROGRAM_BUILD_ASYNC_EXTENSION_STRING_EXP) ==
+            std::string::npos) {
+            GTEST_SKIP() << "EXP program build async feature is not supported.";
+        }
+    }
+
+    struct notification_t {
+        std::mutex mutex;
+        std::condition_variable cv;
+        int calls = 0;
+        ur_result_t result = UR_RESULT_ERROR_UNKNOWN;
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return calls > 0; });
+        }
+    };
+
+    static void notify(ur_result_t result, void *pUserData) {
+        auto notification = static_cast<notification_t *>(pUserData);
+        std::scoped_lock<std::mutex> lock(notification->mutex);
+        notification->calls++;
+        notification->result = result;
+        notification->cv.notify_all();
+    }
+};
+UUR_INSTANTIATE_KERNEL_TEST_SUITE_P(urProgramBuildAsyncExpTest);
+
+TEST_P(urProgramBuildAsyncExpTest, Success) {
+    notification_t notification;
+    ASSERT_SUCCESS(urProgramBuildAsyncExp(context, program, nullptr, notify,
+                                          &notification));
+    notification.wait();
+    ASSERT_SUCCESS(notification.result);
+    ASSERT_EQ(notification.calls, 1);
+
+    auto kernel_name =
+        uur::KernelsEnvironment::instance->GetEntryPointNames(program_name)[0];
+    ur_kernel_handle_t kernel = nullptr;
+    ASSERT_SUCCESS(urKernelCreate(program, kernel_name.data(), &kernel));
+    ASSERT_SUCCESS(urKernelRelease(kernel));
+}
+
+TEST_P(urProgramBuildAsyncExpTest, SuccessReleasedWhileBuilding) {
+    notification_t notification;
+    ASSERT_SUCCESS(urProgramRetain(program));
+    ASSERT_SUCCESS(urProgramBuildAsyncExp(context, program, nullptr, notify,
+                                          &notification));
+    ASSERT_SUCCESS(urProgramRelease(program));
+    notification.wait();
+    ASSERT_SUCCESS(notification.result);
+}
+
+TEST_P(urProgramBuildAsyncExpTest, InvalidNullHandleContext) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urProgramBuildAsyncExp(nullptr, program, nullptr, notify,
+                                            nullptr));
+}
+
+TEST_P(urProgramBuildAsyncExpTest, InvalidNullHandleProgram) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urProgramBuildAsyncExp(context, nullptr, nullptr, notify,
+                                            nullptr));
+}
+
+TEST_P(urProgramBuildAsyncExpTest, InvalidNullPointerNotify) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urProgramBuildAsyncExp(context, program, nullptr, nullptr,
+                                            nullptr));
+}
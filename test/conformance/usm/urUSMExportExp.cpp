@@ -0,0 +1,119 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstring>
+#include <uur/fixtures.h>
+
+struct urUSMExportExpTest : uur::urContextTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::SetUp());
+
+        size_t size = 0;
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS, 0,
+                                       nullptr, &size));
+        std::string extensions(size, '\0');
+        ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_EXTENSIONS, size,
+                                       extensions.data(), nullptr));
+        if (extensions.find(UR_USM_EXPORT_EXTENSION_STRING_EXP) ==
+            std::string::npos) {
+            GTEST_SKIP() << "EXP USM export feature is not supported.";
+        }
+
+        ur_exp_usm_export_desc_t export_desc = {
+            UR_STRUCTURE_TYPE_EXP_USM_EXPORT_DESC, nullptr,
+            UR_EXP_USM_EXPORT_TYPE_FD};
+        ur_usm_desc_t usm_desc = {UR_STRUCTURE_TYPE_USM_DESC, &export_desc,
+                                  UR_USM_ADVICE_FLAG_DEFAULT, 0};
+        ASSERT_SUCCESS(
+            urUSMHostAlloc(context, &usm_desc, nullptr, allocation_size, &ptr));
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_SUCCESS(
+            urUSMExportExp(context, ptr, UR_EXP_USM_EXPORT_TYPE_FD, &handle));
+    }
+
+    void TearDown() override {
+        if (ptr) {
+            EXPECT_SUCCESS(urUSMFree(context, ptr));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::TearDown());
+    }
+
+    static constexpr size_t allocation_size = 8192;
+    void *ptr = nullptr;
+    ur_native_handle_t handle = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urUSMExportExpTest);
+
+TEST_P(urUSMExportExpTest, WritesVisibleAcrossMappings) {
+    void *imported = nullptr;
+    ASSERT_SUCCESS(urUSMImportHandleExp(context, UR_EXP_USM_EXPORT_TYPE_FD,
+                                        handle, allocation_size, &imported));
+    ASSERT_NE(imported, nullptr);
+    ASSERT_NE(imported, ptr);
+
+    auto *exported_bytes = static_cast<uint8_t *>(ptr);
+    auto *imported_bytes = static_cast<uint8_t *>(imported);
+    std::memset(exported_bytes, 0x5a, allocation_size);
+    for (size_t i = 0; i < allocation_size; i++) {
+        ASSERT_EQ(imported_bytes[i], 0x5a) << "offset " << i;
+    }
+
+    imported_bytes[allocation_size - 1] = 0xa5;
+    ASSERT_EQ(exported_bytes[allocation_size - 1], 0xa5);
+
+    ASSERT_SUCCESS(urUSMFree(context, imported));
+}
+
+TEST_P(urUSMExportExpTest, FreeExportedFirst) {
+    void *imported = nullptr;
+    ASSERT_SUCCESS(urUSMImportHandleExp(context, UR_EXP_USM_EXPORT_TYPE_FD,
+                                        handle, allocation_size, &imported));
+    std::memset(ptr, 0x11, allocation_size);
+
+    // The import keeps the memory alive.
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+    ptr = nullptr;
+    auto *imported_bytes = static_cast<uint8_t *>(imported);
+    ASSERT_EQ(imported_bytes[0], 0x11);
+    imported_bytes[0] = 0x22;
+    ASSERT_EQ(imported_bytes[0], 0x22);
+
+    ASSERT_SUCCESS(urUSMFree(context, imported));
+}
+
+TEST_P(urUSMExportExpTest, FreeImportedFirst) {
+    void *imported = nullptr;
+    ASSERT_SUCCESS(urUSMImportHandleExp(context, UR_EXP_USM_EXPORT_TYPE_FD,
+                                        handle, allocation_size, &imported));
+    static_cast<uint8_t *>(imported)[0] = 0x33;
+    ASSERT_SUCCESS(urUSMFree(context, imported));
+
+    // The handle stays valid until the exported allocation is freed.
+    ASSERT_EQ(static_cast<uint8_t *>(ptr)[0], 0x33);
+    ASSERT_SUCCESS(urUSMImportHandleExp(context, UR_EXP_USM_EXPORT_TYPE_FD,
+                                        handle, allocation_size, &imported));
+    ASSERT_EQ(static_cast<uint8_t *>(imported)[0], 0x33);
+    ASSERT_SUCCESS(urUSMFree(context, imported));
+}
+
+TEST_P(urUSMExportExpTest, InvalidValueNotExportable) {
+    void *host_ptr = nullptr;
+    ASSERT_SUCCESS(
+        urUSMHostAlloc(context, nullptr, nullptr, allocation_size, &host_ptr));
+
+    ur_native_handle_t host_handle = nullptr;
+    ASSERT_EQ_RESULT(urUSMExportExp(context, host_ptr,
+                                    UR_EXP_USM_EXPORT_TYPE_FD, &host_handle),
+                     UR_RESULT_ERROR_INVALID_VALUE);
+    ASSERT_SUCCESS(urUSMFree(context, host_ptr));
+}
+
+TEST_P(urUSMExportExpTest, InvalidValueHandleTooSmall) {
+    void *imported = nullptr;
+    ASSERT_EQ_RESULT(urUSMImportHandleExp(context, UR_EXP_USM_EXPORT_TYPE_FD,
+                                          handle, allocation_size * 2,
+                                          &imported),
+                     UR_RESULT_ERROR_INVALID_VALUE);
+}
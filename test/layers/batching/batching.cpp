@@ -0,0 +1,94 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+#include <ur_api.h>
+
+#include <vector>
+
+struct batchingTest : ::testing::Test {
+    void SetUp() override {
+        ASSERT_EQ(urLoaderInit(0, nullptr), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urPlatformGet(&adapter, 1, 1, &platform, nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                              nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        if (queue) {
+            ASSERT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+        }
+        ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urDeviceRelease(device), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urAdapterRelease(adapter), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urLoaderTearDown(), UR_RESULT_SUCCESS);
+    }
+
+    void createQueue(ur_queue_flags_t flags) {
+        ur_queue_properties_t properties = {UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+                                            nullptr, flags};
+        ASSERT_EQ(urQueueCreate(context, device, &properties, &queue),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void fill(ur_event_handle_t *phEvent = nullptr) {
+        uint32_t pattern = 42;
+        ASSERT_EQ(urEnqueueUSMFill(queue, memory.data(), sizeof(pattern),
+                                   &pattern, sizeof(pattern), 0, nullptr,
+                                   phEvent),
+                  UR_RESULT_SUCCESS);
+    }
+
+    ur_adapter_handle_t adapter = nullptr;
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    std::vector<uint32_t> memory = std::vector<uint32_t>(16);
+};
+
+TEST_F(batchingTest, FlushOnFinish) {
+    createQueue(UR_QUEUE_FLAG_SUBMISSION_BATCHED);
+    fill();
+    fill();
+    fill();
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+}
+
+TEST_F(batchingTest, FlushOnMaxCommands) {
+    createQueue(UR_QUEUE_FLAG_SUBMISSION_BATCHED);
+    for (int i = 0; i < 5; i++) {
+        fill();
+    }
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+}
+
+TEST_F(batchingTest, FlushOnOutputEvent) {
+    createQueue(UR_QUEUE_FLAG_SUBMISSION_BATCHED);
+    fill();
+    fill();
+    ur_event_handle_t event = nullptr;
+    fill(&event);
+    ASSERT_EQ(urEventWait(1, &event), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urEventRelease(event), UR_RESULT_SUCCESS);
+}
+
+TEST_F(batchingTest, FlushOnRelease) {
+    createQueue(UR_QUEUE_FLAG_SUBMISSION_BATCHED |
+                UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    fill();
+    fill();
+}
+
+TEST_F(batchingTest, NotBatched) {
+    createQueue(0);
+    fill();
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+}
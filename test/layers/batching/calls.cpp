@@ -0,0 +1,525 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fake_handles.hpp"
+#include "ur_batching_layer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ur_batching_layer;
+
+namespace {
+
+const auto hKernel = handle<ur_kernel_handle_t>(0x30);
+
+// State of the adapter the layer calls into.
+struct adapter_t {
+    bool commandBufferSupport = false;
+    // Commands enqueued on this queue fail.
+    ur_queue_handle_t hFailingQueue = nullptr;
+    bool failCommandBufferCreate = false;
+
+    // Submitted commands and synchronization calls, in order.
+    std::vector<std::string> calls;
+    uintptr_t nextHandle = 0x1000;
+    std::map<ur_event_handle_t, ur_queue_handle_t> eventQueues;
+    std::map<const void *, size_t> allocations;
+    std::map<const void *, int> refCounts;
+};
+
+adapter_t adapter;
+// Guards the calls enqueued by the layer's flusher thread.
+std::mutex callsMutex;
+
+std::string name(const void *handle) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%p", handle);
+    return buffer;
+}
+
+ur_result_t enqueued(ur_queue_handle_t hQueue, const char *function,
+                     uint32_t numEvents, ur_event_handle_t *phEvent) {
+    std::scoped_lock<std::mutex> lock(callsMutex);
+    adapter.calls.push_back(std::string(function) + " " + name(hQueue) +
+                            " waits " + std::to_string(numEvents));
+    if (hQueue == adapter.hFailingQueue) {
+        return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+    }
+    if (phEvent) {
+        *phEvent = handle<ur_event_handle_t>(adapter.nextHandle++);
+        adapter.eventQueues[*phEvent] = hQueue;
+        adapter.refCounts[*phEvent] = 1;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t retain(const void *handle) {
+    adapter.refCounts[handle]++;
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t release(const void *handle) {
+    adapter.refCounts[handle]--;
+    return UR_RESULT_SUCCESS;
+}
+
+void setupDdiTable(ur_dditable_t &table) {
+    table.Device.pfnGetInfo = [](ur_device_handle_t, ur_device_info_t propName,
+                                 size_t, void *pPropValue, size_t *) {
+        if (propName != UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP) {
+            return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+        }
+        *static_cast<ur_bool_t *>(pPropValue) = adapter.commandBufferSupport;
+        return UR_RESULT_SUCCESS;
+    };
+
+    table.Queue.pfnCreate = [](ur_context_handle_t, ur_device_handle_t,
+                               const ur_queue_properties_t *,
+                               ur_queue_handle_t *phQueue) {
+        *phQueue = handle<ur_queue_handle_t>(adapter.nextHandle++);
+        return UR_RESULT_SUCCESS;
+    };
+    table.Queue.pfnRelease = [](ur_queue_handle_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    table.Queue.pfnGetInfo = [](ur_queue_handle_t, ur_queue_info_t propName,
+                                size_t, void *pPropValue, size_t *) {
+        if (propName != UR_QUEUE_INFO_REFERENCE_COUNT) {
+            return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+        }
+        *static_cast<uint32_t *>(pPropValue) = 1;
+        return UR_RESULT_SUCCESS;
+    };
+    table.Queue.pfnFinish = [](ur_queue_handle_t hQueue) {
+        adapter.calls.push_back("urQueueFinish " + name(hQueue));
+        return UR_RESULT_SUCCESS;
+    };
+
+    table.Enqueue.pfnKernelLaunch =
+        [](ur_queue_handle_t hQueue, ur_kernel_handle_t, uint32_t,
+           const size_t *, const size_t *, const size_t *, uint32_t numEvents,
+           const ur_event_handle_t *, ur_event_handle_t *phEvent) {
+            return enqueued(hQueue, "urEnqueueKernelLaunch", numEvents,
+                            phEvent);
+        };
+    table.Enqueue.pfnUSMFill =
+        [](ur_queue_handle_t hQueue, void *, size_t, const void *, size_t,
+           uint32_t numEvents, const ur_event_handle_t *,
+           ur_event_handle_t *phEvent) {
+            return enqueued(hQueue, "urEnqueueUSMFill", numEvents, phEvent);
+        };
+    table.Enqueue.pfnUSMMemcpy =
+        [](ur_queue_handle_t hQueue, bool, void *, const void *, size_t,
+           uint32_t numEvents, const ur_event_handle_t *,
+           ur_event_handle_t *phEvent) {
+            return enqueued(hQueue, "urEnqueueUSMMemcpy", numEvents, phEvent);
+        };
+
+    table.Event.pfnRetain = [](ur_event_handle_t hEvent) {
+        return retain(hEvent);
+    };
+    table.Event.pfnRelease = [](ur_event_handle_t hEvent) {
+        return release(hEvent);
+    };
+    table.Event.pfnWait = [](uint32_t, const ur_event_handle_t *) {
+        adapter.calls.push_back("urEventWait");
+        return UR_RESULT_SUCCESS;
+    };
+    table.Event.pfnGetInfo = [](ur_event_handle_t hEvent,
+                                ur_event_info_t propName, size_t,
+                                void *pPropValue, size_t *) {
+        switch (propName) {
+        case UR_EVENT_INFO_COMMAND_QUEUE:
+            *static_cast<ur_queue_handle_t *>(pPropValue) =
+                adapter.eventQueues[hEvent];
+            return UR_RESULT_SUCCESS;
+        case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS:
+            *static_cast<ur_event_status_t *>(pPropValue) =
+                UR_EVENT_STATUS_COMPLETE;
+            return UR_RESULT_SUCCESS;
+        default:
+            return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+        }
+    };
+
+    table.Kernel.pfnRetain = [](ur_kernel_handle_t hKernel) {
+        return retain(hKernel);
+    };
+    table.Kernel.pfnRelease = [](ur_kernel_handle_t hKernel) {
+        return release(hKernel);
+    };
+
+    table.USM.pfnFree = [](ur_context_handle_t, void *pMem) {
+        adapter.calls.push_back("urUSMFree " + name(pMem));
+        return UR_RESULT_SUCCESS;
+    };
+    table.USM.pfnGetMemAllocInfo =
+        [](ur_context_handle_t, const void *pMem, ur_usm_alloc_info_t propName,
+           size_t, void *pPropValue, size_t *) {
+            auto it = adapter.allocations.find(pMem);
+            if (propName != UR_USM_ALLOC_INFO_SIZE ||
+                it == adapter.allocations.end()) {
+                return UR_RESULT_ERROR_INVALID_VALUE;
+            }
+            *static_cast<size_t *>(pPropValue) = it->second;
+            return UR_RESULT_SUCCESS;
+        };
+
+    auto &commandBufferExp = table.CommandBufferExp;
+    commandBufferExp.pfnCreateExp =
+        [](ur_context_handle_t, ur_device_handle_t,
+           const ur_exp_command_buffer_desc_t *,
+           ur_exp_command_buffer_handle_t *phCommandBuffer) {
+            if (adapter.failCommandBufferCreate) {
+                return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+            }
+            *phCommandBuffer =
+                handle<ur_exp_command_buffer_handle_t>(adapter.nextHandle++);
+            adapter.refCounts[*phCommandBuffer] = 1;
+            adapter.calls.push_back("urCommandBufferCreateExp");
+            return UR_RESULT_SUCCESS;
+        };
+    commandBufferExp.pfnAppendKernelLaunchExp =
+        [](ur_exp_command_buffer_handle_t, ur_kernel_handle_t, uint32_t,
+           const size_t *, const size_t *, const size_t *,
+           uint32_t numSyncPoints, const ur_exp_command_buffer_sync_point_t *,
+           ur_exp_command_buffer_sync_point_t *pSyncPoint,
+           ur_exp_command_buffer_command_handle_t *) {
+            adapter.calls.push_back("urCommandBufferAppendKernelLaunchExp "
+                                    "waits " +
+                                    std::to_string(numSyncPoints));
+            *pSyncPoint = static_cast<ur_exp_command_buffer_sync_point_t>(
+                adapter.calls.size());
+            return UR_RESULT_SUCCESS;
+        };
+    commandBufferExp.pfnAppendUSMFillExp =
+        [](ur_exp_command_buffer_handle_t, void *, const void *, size_t, size_t,
+           uint32_t numSyncPoints, const ur_exp_command_buffer_sync_point_t *,
+           ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+            adapter.calls.push_back("urCommandBufferAppendUSMFillExp waits " +
+                                    std::to_string(numSyncPoints));
+            *pSyncPoint = static_cast<ur_exp_command_buffer_sync_point_t>(
+                adapter.calls.size());
+            return UR_RESULT_SUCCESS;
+        };
+    commandBufferExp.pfnFinalizeExp = [](ur_exp_command_buffer_handle_t) {
+        adapter.calls.push_back("urCommandBufferFinalizeExp");
+        return UR_RESULT_SUCCESS;
+    };
+    commandBufferExp.pfnEnqueueExp =
+        [](ur_exp_command_buffer_handle_t, ur_queue_handle_t hQueue,
+           uint32_t numEvents, const ur_event_handle_t *,
+           ur_event_handle_t *phEvent) {
+            return enqueued(hQueue, "urCommandBufferEnqueueExp", numEvents,
+                            phEvent);
+        };
+    commandBufferExp.pfnReleaseExp =
+        [](ur_exp_command_buffer_handle_t hCommandBuffer) {
+            return release(hCommandBuffer);
+        };
+}
+
+// Runs the layer on top of the adapter above, calling it through the table
+// returned by its init, like the loader would.
+struct BatchingCallsTest : ::testing::Test {
+    void SetUp() override {
+        adapter = {};
+        setupDdiTable(ddi);
+        ASSERT_EQ(context.init(&ddi, {"UR_LAYER_BATCHING"}, {}),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        for (auto hQueue : queues) {
+            EXPECT_EQ(ddi.Queue.pfnRelease(hQueue), UR_RESULT_SUCCESS);
+        }
+        EXPECT_EQ(context.tearDown(), UR_RESULT_SUCCESS);
+
+        // Everything retained by the layer was released again.
+        for (auto &[handle, refCount] : adapter.refCounts) {
+            EXPECT_EQ(refCount, 0) << handle;
+        }
+    }
+
+    ur_queue_handle_t createQueue(ur_queue_flags_t flags =
+                                      UR_QUEUE_FLAG_SUBMISSION_BATCHED) {
+        ur_queue_properties_t properties = {UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+                                            nullptr, flags};
+        ur_queue_handle_t hQueue = nullptr;
+        EXPECT_EQ(ddi.Queue.pfnCreate(hContext, hDevice, &properties, &hQueue),
+                  UR_RESULT_SUCCESS);
+        queues.push_back(hQueue);
+        return hQueue;
+    }
+
+    ur_result_t fill(ur_queue_handle_t hQueue, void *pMem,
+                     uint32_t numEvents = 0,
+                     const ur_event_handle_t *phEvents = nullptr,
+                     ur_event_handle_t *phEvent = nullptr) {
+        uint32_t pattern = 42;
+        return ddi.Enqueue.pfnUSMFill(hQueue, pMem, sizeof(pattern), &pattern,
+                                      sizeof(pattern), numEvents, phEvents,
+                                      phEvent);
+    }
+
+    ur_result_t launch(ur_queue_handle_t hQueue) {
+        size_t offset = 0;
+        size_t size = 64;
+        return ddi.Enqueue.pfnKernelLaunch(hQueue, hKernel, 1, &offset, &size,
+                                           nullptr, 0, nullptr, nullptr);
+    }
+
+    std::string call(const char *function, ur_queue_handle_t hQueue,
+                     uint32_t numEvents = 0) {
+        return std::string(function) + " " + name(hQueue) + " waits " +
+               std::to_string(numEvents);
+    }
+
+    ur_dditable_t ddi = {};
+    std::vector<ur_queue_handle_t> queues;
+    uint32_t memory[64] = {};
+};
+
+} // namespace
+
+TEST_F(BatchingCallsTest, ReplayKeepsCommandOrder) {
+    auto hQueue = createQueue();
+    ASSERT_EQ(fill(hQueue, &memory[0]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(ddi.Enqueue.pfnUSMMemcpy(hQueue, false, &memory[1], &memory[0],
+                                       sizeof(uint32_t), 0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(launch(hQueue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hQueue, &memory[2]), UR_RESULT_SUCCESS);
+    EXPECT_TRUE(adapter.calls.empty());
+    EXPECT_EQ(adapter.refCounts[hKernel], 1);
+
+    ASSERT_EQ(ddi.Queue.pfnFinish(hQueue), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 call("urEnqueueUSMFill", hQueue),
+                                 call("urEnqueueUSMMemcpy", hQueue),
+                                 call("urEnqueueKernelLaunch", hQueue),
+                                 call("urEnqueueUSMFill", hQueue),
+                                 "urQueueFinish " + name(hQueue),
+                             }));
+    EXPECT_EQ(adapter.refCounts[hKernel], 0);
+}
+
+TEST_F(BatchingCallsTest, WaitListStartsNewBatch) {
+    auto hQueue = createQueue();
+    auto hOther = createQueue(0);
+    ur_event_handle_t hEvent = nullptr;
+    ASSERT_EQ(fill(hOther, &memory[0], 0, nullptr, &hEvent),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(fill(hQueue, &memory[1]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hQueue, &memory[2], 1, &hEvent), UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hQueue, &memory[3]), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.refCounts[hEvent], 2);
+
+    ASSERT_EQ(ddi.Queue.pfnFinish(hQueue), UR_RESULT_SUCCESS);
+    // Only the first command of the second batch waits for the event.
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 call("urEnqueueUSMFill", hOther),
+                                 call("urEnqueueUSMFill", hQueue),
+                                 call("urEnqueueUSMFill", hQueue, 1),
+                                 call("urEnqueueUSMFill", hQueue),
+                                 "urQueueFinish " + name(hQueue),
+                             }));
+    EXPECT_EQ(adapter.refCounts[hEvent], 1);
+    EXPECT_EQ(ddi.Event.pfnRelease(hEvent), UR_RESULT_SUCCESS);
+}
+
+TEST_F(BatchingCallsTest, CommandBufferPath) {
+    adapter.commandBufferSupport = true;
+    auto hQueue = createQueue();
+    ASSERT_EQ(fill(hQueue, &memory[0]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(launch(hQueue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hQueue, &memory[1]), UR_RESULT_SUCCESS);
+    // The commands are appended right away, chained by their sync points.
+    EXPECT_EQ(adapter.calls,
+              (std::vector<std::string>{
+                  "urCommandBufferCreateExp",
+                  "urCommandBufferAppendUSMFillExp waits 0",
+                  "urCommandBufferAppendKernelLaunchExp waits 1",
+                  "urCommandBufferAppendUSMFillExp waits 1",
+              }));
+    // The command buffer captured the kernel arguments.
+    EXPECT_EQ(adapter.refCounts[hKernel], 0);
+
+    adapter.calls.clear();
+    ASSERT_EQ(ddi.Queue.pfnFinish(hQueue), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 "urCommandBufferFinalizeExp",
+                                 call("urCommandBufferEnqueueExp", hQueue),
+                                 "urQueueFinish " + name(hQueue),
+                             }));
+
+    // The next batch is recorded in a new command buffer.
+    adapter.calls.clear();
+    ASSERT_EQ(fill(hQueue, &memory[2]), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls,
+              (std::vector<std::string>{
+                  "urCommandBufferCreateExp",
+                  "urCommandBufferAppendUSMFillExp waits 0",
+              }));
+}
+
+TEST_F(BatchingCallsTest, EventWaitFlushesOwningQueue) {
+    auto hQueue = createQueue();
+    auto hOther = createQueue();
+    ur_event_handle_t hEvent = nullptr;
+    ASSERT_EQ(fill(hQueue, &memory[0]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hOther, &memory[1]), UR_RESULT_SUCCESS);
+    // Enqueued right away, after the command recorded before it.
+    ASSERT_EQ(fill(hQueue, &memory[2], 0, nullptr, &hEvent),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hQueue, &memory[3]), UR_RESULT_SUCCESS);
+
+    adapter.calls.clear();
+    ASSERT_EQ(ddi.Event.pfnWait(1, &hEvent), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 call("urEnqueueUSMFill", hQueue),
+                                 "urEventWait",
+                             }));
+
+    adapter.calls.clear();
+    ASSERT_EQ(ddi.Queue.pfnFinish(hOther), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 call("urEnqueueUSMFill", hOther),
+                                 "urQueueFinish " + name(hOther),
+                             }));
+    EXPECT_EQ(ddi.Event.pfnRelease(hEvent), UR_RESULT_SUCCESS);
+}
+
+TEST_F(BatchingCallsTest, USMFreeFlushesQueuesUsingAllocation) {
+    adapter.allocations[&memory[0]] = 8 * sizeof(uint32_t);
+    adapter.allocations[&memory[8]] = 8 * sizeof(uint32_t);
+    adapter.allocations[&memory[16]] = 8 * sizeof(uint32_t);
+
+    auto hQueue = createQueue();
+    auto hOther = createQueue();
+    ASSERT_EQ(fill(hQueue, &memory[4]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hOther, &memory[8]), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(ddi.USM.pfnFree(hContext, &memory[0]), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 call("urEnqueueUSMFill", hQueue),
+                                 "urUSMFree " + name(&memory[0]),
+                             }));
+
+    // Kernels may access any allocation through their arguments.
+    adapter.calls.clear();
+    ASSERT_EQ(launch(hQueue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(ddi.USM.pfnFree(hContext, &memory[16]), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 call("urEnqueueKernelLaunch", hQueue),
+                                 "urUSMFree " + name(&memory[16]),
+                             }));
+
+    // Allocations of unknown size may contain any recorded pointer.
+    adapter.calls.clear();
+    ASSERT_EQ(ddi.USM.pfnFree(hContext, &memory[32]), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 call("urEnqueueUSMFill", hOther),
+                                 "urUSMFree " + name(&memory[32]),
+                             }));
+}
+
+TEST_F(BatchingCallsTest, FlushErrorsOfOtherQueuesNotReported) {
+    adapter.allocations[&memory[0]] = 8 * sizeof(uint32_t);
+    adapter.allocations[&memory[8]] = 8 * sizeof(uint32_t);
+
+    auto hQueue = createQueue();
+    auto hFailing = createQueue();
+    adapter.hFailingQueue = hFailing;
+    ASSERT_EQ(fill(hFailing, &memory[8]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hQueue, &memory[0]), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(ddi.USM.pfnFree(hContext, &memory[0]), UR_RESULT_SUCCESS);
+
+    ur_event_handle_t hEvent = nullptr;
+    ASSERT_EQ(fill(hQueue, &memory[0], 0, nullptr, &hEvent),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(ddi.Event.pfnWait(1, &hEvent), UR_RESULT_SUCCESS);
+    EXPECT_EQ(ddi.Event.pfnRelease(hEvent), UR_RESULT_SUCCESS);
+
+    // The failing queue reports its own error.
+    EXPECT_EQ(ddi.Queue.pfnFinish(hFailing), UR_RESULT_ERROR_OUT_OF_RESOURCES);
+}
+
+TEST_F(BatchingCallsTest, QueueReleaseDropsFailedWaitList) {
+    adapter.commandBufferSupport = true;
+    auto hQueue = createQueue();
+    auto hOther = createQueue(0);
+    ur_event_handle_t hEvent = nullptr;
+    ASSERT_EQ(fill(hOther, &memory[0], 0, nullptr, &hEvent),
+              UR_RESULT_SUCCESS);
+
+    // The wait list is kept for the first command of the batch, which
+    // failed to be recorded.
+    adapter.failCommandBufferCreate = true;
+    ASSERT_EQ(fill(hQueue, &memory[1], 1, &hEvent),
+              UR_RESULT_ERROR_OUT_OF_RESOURCES);
+    EXPECT_EQ(adapter.refCounts[hEvent], 2);
+
+    EXPECT_EQ(ddi.Queue.pfnRelease(hQueue), UR_RESULT_SUCCESS);
+    queues.erase(queues.begin());
+    EXPECT_EQ(adapter.refCounts[hEvent], 1);
+    EXPECT_EQ(ddi.Event.pfnRelease(hEvent), UR_RESULT_SUCCESS);
+}
+
+TEST_F(BatchingCallsTest, TearDownReleasesUnreleasedQueues) {
+    adapter.commandBufferSupport = true;
+    adapter.allocations[&memory[0]] = 8 * sizeof(uint32_t);
+    auto hQueue = createQueue();
+    ASSERT_EQ(fill(hQueue, &memory[0]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(ddi.USM.pfnFree(hContext, &memory[0]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(fill(hQueue, &memory[8]), UR_RESULT_SUCCESS);
+
+    // The application never releases the queue, urLoaderTearDown submits the
+    // second batch and releases the command buffers of both batches.
+    queues.clear();
+    adapter.calls.clear();
+    EXPECT_EQ(context.tearDown(), UR_RESULT_SUCCESS);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 "urCommandBufferFinalizeExp",
+                                 call("urCommandBufferEnqueueExp", hQueue),
+                                 "urQueueFinish " + name(hQueue),
+                             }));
+}
+
+// Runs with a short max_delay_us, see CMakeLists.txt.
+using BatchingDelayTest = BatchingCallsTest;
+
+TEST_F(BatchingDelayTest, ExpiredBatchFlushedInBackground) {
+    auto hQueue = createQueue();
+    ASSERT_EQ(fill(hQueue, &memory[0]), UR_RESULT_SUCCESS);
+
+    // No further call into the layer, the flusher thread submits the batch.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    for (;;) {
+        {
+            std::scoped_lock<std::mutex> lock(callsMutex);
+            if (!adapter.calls.empty() ||
+                std::chrono::steady_clock::now() > deadline) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::scoped_lock<std::mutex> lock(callsMutex);
+    EXPECT_EQ(adapter.calls, (std::vector<std::string>{
+                                 call("urEnqueueUSMFill", hQueue),
+                             }));
+}
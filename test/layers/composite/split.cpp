@@ -0,0 +1,111 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_composite.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace ur_composite_layer;
+
+namespace {
+
+size_t sum(const std::vector<size_t> &counts) {
+    return std::accumulate(counts.begin(), counts.end(), size_t{0});
+}
+
+TEST(PlanSplitTest, PicksDimensionWithMostGroups) {
+    size_t global[] = {64, 1024, 32};
+    size_t local[] = {8, 256, 1};
+    auto split = planSplit(3, global, local);
+    ASSERT_TRUE(split.has_value());
+    EXPECT_EQ(split->dim, 2u);
+    EXPECT_EQ(split->groupSize, 1u);
+    EXPECT_EQ(split->numGroups, 32u);
+}
+
+TEST(PlanSplitTest, ImplicitGroupSize) {
+    size_t global[] = {1000};
+    auto split = planSplit(1, global, nullptr);
+    ASSERT_TRUE(split.has_value());
+    EXPECT_EQ(split->groupSize, 8u);
+    EXPECT_EQ(split->numGroups, 125u);
+
+    size_t aligned[] = {4096};
+    split = planSplit(1, aligned, nullptr);
+    ASSERT_TRUE(split.has_value());
+    EXPECT_EQ(split->groupSize, 64u);
+    EXPECT_EQ(split->numGroups, 64u);
+}
+
+TEST(PlanSplitTest, RejectsInvalidRanges) {
+    size_t global[] = {100};
+    size_t local[] = {3};
+    EXPECT_FALSE(planSplit(1, global, local).has_value());
+    EXPECT_FALSE(planSplit(0, global, nullptr).has_value());
+    size_t empty[] = {0};
+    EXPECT_FALSE(planSplit(1, empty, nullptr).has_value());
+}
+
+TEST(BalancerTest, InitialWeights) {
+    balancer_t balancer({4, 12});
+    EXPECT_EQ(balancer.split(16), (std::vector<size_t>{4, 12}));
+    EXPECT_FALSE(balancer.getThroughput(0).has_value());
+}
+
+TEST(BalancerTest, ZeroWeightsSplitEvenly) {
+    balancer_t balancer({0, 0, 0});
+    EXPECT_EQ(balancer.split(9), (std::vector<size_t>{3, 3, 3}));
+}
+
+TEST(BalancerTest, LargestRemainder) {
+    balancer_t balancer({1, 1, 1});
+    auto counts = balancer.split(10);
+    EXPECT_EQ(sum(counts), 10u);
+    EXPECT_EQ(counts, (std::vector<size_t>{4, 3, 3}));
+
+    balancer_t uneven({1, 2});
+    EXPECT_EQ(uneven.split(4), (std::vector<size_t>{1, 3}));
+}
+
+TEST(BalancerTest, FewerGroupsThanMembers) {
+    balancer_t balancer({1, 1, 1, 1});
+    auto counts = balancer.split(2);
+    EXPECT_EQ(sum(counts), 2u);
+    EXPECT_EQ(counts, (std::vector<size_t>{1, 1, 0, 0}));
+}
+
+TEST(BalancerTest, MeasuredThroughputOnceAllMembersRan) {
+    balancer_t balancer({1, 1});
+    // Member 1 is three times as fast, but member 0 hasn't been measured.
+    balancer.record(1, 300, 100);
+    EXPECT_EQ(balancer.split(8), (std::vector<size_t>{4, 4}));
+
+    balancer.record(0, 100, 100);
+    EXPECT_EQ(balancer.split(8), (std::vector<size_t>{2, 6}));
+    EXPECT_DOUBLE_EQ(*balancer.getThroughput(1), 3.0);
+}
+
+TEST(BalancerTest, ThroughputIsSmoothed) {
+    balancer_t balancer({1});
+    balancer.record(0, 100, 100);
+    balancer.record(0, 500, 100);
+    // One outlier only moves the average by a quarter of the difference.
+    EXPECT_DOUBLE_EQ(*balancer.getThroughput(0), 2.0);
+    // Shards too short to be measured count as a nanosecond.
+    balancer.record(0, 4, 0);
+    EXPECT_DOUBLE_EQ(*balancer.getThroughput(0), 2.5);
+}
+
+TEST(BalancerTest, IgnoresInvalidRecords) {
+    balancer_t balancer({1, 1});
+    balancer.record(2, 100, 100);
+    balancer.record(0, 0, 100);
+    EXPECT_FALSE(balancer.getThroughput(0).has_value());
+    EXPECT_FALSE(balancer.getThroughput(2).has_value());
+}
+
+} // namespace
@@ -0,0 +1,186 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fake_handles.hpp"
+#include "ur_event_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using namespace ur_event_graph_layer;
+
+namespace {
+
+struct EventGraphTest : ::testing::Test {
+    event_graph_t graph{1024};
+    uint64_t time = 0;
+
+    command_id_t submit(uint32_t queue, ur_event_handle_t hEvent,
+                        std::vector<ur_event_handle_t> waits = {},
+                        ur_function_t function =
+                            UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH) {
+        auto id = graph.addCommand(function, "urEnqueueKernelLaunch", queue,
+                                   static_cast<uint32_t>(waits.size()),
+                                   waits.data(), hEvent, time++);
+        EXPECT_TRUE(id.has_value());
+        return *id;
+    }
+
+    uint8_t flagsOf(command_id_t id, command_id_t source) {
+        for (auto &dependency : graph.getCommands()[id].dependencies) {
+            if (dependency.source == source) {
+                return dependency.flags;
+            }
+        }
+        ADD_FAILURE() << "no dependency on " << source;
+        return 0;
+    }
+};
+
+} // namespace
+
+TEST_F(EventGraphTest, InOrderQueue) {
+    auto queue = graph.addQueue(handle<ur_queue_handle_t>(0x10), true);
+    auto e0 = handle<ur_event_handle_t>(0x100);
+    auto first = submit(queue, e0);
+    auto second = submit(queue, nullptr, {e0});
+
+    // The implicit queue order edge, then the explicit wait.
+    auto &dependencies = graph.getCommands()[second].dependencies;
+    ASSERT_EQ(dependencies.size(), 2u);
+    EXPECT_EQ(dependencies[0].source, first);
+    EXPECT_EQ(dependencies[0].flags, DEPENDENCY_FLAG_QUEUE_ORDER);
+    EXPECT_EQ(dependencies[1].source, first);
+    EXPECT_EQ(dependencies[1].flags, DEPENDENCY_FLAG_REDUNDANT_QUEUE_ORDER);
+    EXPECT_EQ(graph.getFindings(16).size(), 1u);
+}
+
+TEST_F(EventGraphTest, ForgottenQueueHandleIsReused) {
+    auto hQueue = handle<ur_queue_handle_t>(0x10);
+    auto old = graph.addQueue(hQueue, true);
+    submit(old, handle<ur_event_handle_t>(0x100));
+    graph.forgetQueue(hQueue);
+    EXPECT_FALSE(graph.findQueue(hQueue).has_value());
+
+    // A new out-of-order queue with the handle doesn't wait on the old one.
+    auto queue = graph.addQueue(hQueue, false);
+    EXPECT_NE(queue, old);
+    auto command = submit(queue, nullptr);
+    EXPECT_TRUE(graph.getCommands()[command].dependencies.empty());
+    EXPECT_EQ(graph.getQueues().size(), 2u);
+}
+
+TEST_F(EventGraphTest, DuplicateAndTransitiveWaits) {
+    auto q0 = graph.addQueue(handle<ur_queue_handle_t>(0x10), false);
+    auto q1 = graph.addQueue(handle<ur_queue_handle_t>(0x20), false);
+    auto e0 = handle<ur_event_handle_t>(0x100);
+    auto e1 = handle<ur_event_handle_t>(0x101);
+
+    auto first = submit(q0, e0);
+    auto second = submit(q1, e1, {e0});
+    auto third = submit(q1, nullptr, {e0, e1, e1});
+
+    EXPECT_TRUE(flagsOf(third, first) & DEPENDENCY_FLAG_REDUNDANT_TRANSITIVE);
+    EXPECT_FALSE(flagsOf(third, second) & DEPENDENCY_FLAGS_REDUNDANT);
+    EXPECT_EQ(graph.getFindings(16).size(), 2u);
+}
+
+TEST_F(EventGraphTest, UnknownEvents) {
+    auto queue = graph.addQueue(handle<ur_queue_handle_t>(0x10), false);
+    auto id = submit(queue, nullptr, {handle<ur_event_handle_t>(0x999)});
+    EXPECT_EQ(graph.getCommands()[id].unknownDependencies, 1u);
+    EXPECT_TRUE(graph.getFindings(16).empty());
+}
+
+TEST_F(EventGraphTest, OutOfOrderBarrier) {
+    auto queue = graph.addQueue(handle<ur_queue_handle_t>(0x10), false);
+    auto first = submit(queue, nullptr);
+    auto second = submit(queue, nullptr);
+    auto barrier = submit(queue, nullptr, {},
+                          UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER);
+    auto after = submit(queue, nullptr);
+
+    EXPECT_EQ(flagsOf(barrier, first), DEPENDENCY_FLAG_QUEUE_ORDER);
+    EXPECT_EQ(flagsOf(barrier, second), DEPENDENCY_FLAG_QUEUE_ORDER);
+    EXPECT_EQ(graph.getCommands()[after].dependencies.size(), 1u);
+    EXPECT_EQ(flagsOf(after, barrier), DEPENDENCY_FLAG_QUEUE_ORDER);
+}
+
+TEST_F(EventGraphTest, SerializedQueues) {
+    auto q0 = graph.addQueue(handle<ur_queue_handle_t>(0x10), true);
+    auto q1 = graph.addQueue(handle<ur_queue_handle_t>(0x20), true);
+    for (uintptr_t i = 0; i < 16; i++) {
+        auto hEvent = handle<ur_event_handle_t>(0x100 + i);
+        submit(q0, hEvent);
+        submit(q1, nullptr, {hEvent});
+    }
+
+    auto serialized = graph.getSerializedQueues();
+    ASSERT_EQ(serialized.size(), 1u);
+    EXPECT_EQ(serialized[0], std::make_pair(q0, q1));
+}
+
+TEST_F(EventGraphTest, MaxCommands) {
+    event_graph_t small(2);
+    auto queue = small.addQueue(handle<ur_queue_handle_t>(0x10), true);
+    for (int i = 0; i < 2; i++) {
+        EXPECT_TRUE(small
+                        .addCommand(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, "k",
+                                    queue, 0, nullptr, nullptr, 0)
+                        .has_value());
+    }
+    EXPECT_FALSE(small
+                     .addCommand(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, "k", queue,
+                                 0, nullptr, nullptr, 0)
+                     .has_value());
+}
+
+TEST_F(EventGraphTest, Export) {
+    auto q0 = graph.addQueue(handle<ur_queue_handle_t>(0x10), false);
+    auto e0 = handle<ur_event_handle_t>(0x100);
+    auto first = submit(q0, e0);
+    submit(q0, nullptr, {e0, e0});
+    graph.setTimestamps(first, 1000, 5000);
+
+    std::stringstream trace;
+    graph.writeChromeTrace(trace);
+    EXPECT_NE(trace.str().find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.str().find("redundant wait"), std::string::npos);
+
+    std::stringstream dot;
+    graph.writeDot(dot);
+    EXPECT_EQ(dot.str().rfind("digraph", 0), 0u);
+    EXPECT_NE(dot.str().find("->"), std::string::npos);
+}
+
+TEST_F(EventGraphTest, DeviceTimestampsOnHostAxis) {
+    auto aligned = graph.addQueue(handle<ur_queue_handle_t>(0x10), true);
+    auto unaligned = graph.addQueue(handle<ur_queue_handle_t>(0x20), true);
+    // The device clock of the first queue runs 1ms behind the host clock.
+    graph.setDeviceToHostOffset(aligned, 1000000);
+
+    time = 500000;
+    auto first = submit(aligned, nullptr);
+    auto second = submit(unaligned, nullptr);
+    graph.setTimestamps(first, 0, 2000);
+    graph.setTimestamps(second, 7000000000, 7000004000);
+
+    std::stringstream trace;
+    graph.writeChromeTrace(trace);
+    auto str = trace.str();
+
+    // The submission is the origin of the host axis, the command starts
+    // 500us later.
+    EXPECT_NE(str.find("\"pid\":1,\"tid\":0,\"ts\":500.000,\"dur\":2.000"),
+              std::string::npos)
+        << str;
+    // The unaligned device clock gets its own process and origin.
+    EXPECT_NE(str.find("device time, not aligned with the host"),
+              std::string::npos);
+    EXPECT_NE(str.find("\"pid\":2,\"tid\":1,\"ts\":0.000,\"dur\":4.000"),
+              std::string::npos)
+        << str;
+}
@@ -0,0 +1,22 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_LAYERS_TEST_FAKE_HANDLES_H
+#define UR_LAYERS_TEST_FAKE_HANDLES_H
+
+#include <ur_api.h>
+
+#include <cstdint>
+
+// Handles for tests which run a layer without an adapter, the layer only
+// compares them and passes them on.
+template <typename T> T handle(uintptr_t value) {
+    return reinterpret_cast<T>(value);
+}
+
+const auto hContext = handle<ur_context_handle_t>(0x10);
+const auto hDevice = handle<ur_device_handle_t>(0x20);
+
+#endif // UR_LAYERS_TEST_FAKE_HANDLES_H
@@ -0,0 +1,202 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "asan_interceptor.hpp"
+#include "fake_handles.hpp"
+#include "ur_sanitizer_layer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <asm/param.h>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+// Number of pages whose release makes the layer return unused shadow pages to
+// the system, see SHADOW_RECLAIM_BATCH_PAGES.
+constexpr size_t RECLAIM_BATCH_PAGES = 256;
+
+// Shadow of application memory no allocation of the test uses.
+constexpr uptr UNUSED_SHADOW =
+    RoundUpTo(HIGH_SHADOW_BEGIN + 0x100000000ULL, EXEC_PAGESIZE);
+
+ur_result_t deviceGetInfo(ur_device_handle_t, ur_device_info_t propName,
+                          size_t propSize, void *pPropValue, size_t *) {
+    switch (propName) {
+    case UR_DEVICE_INFO_TYPE: {
+        ur_device_type_t type = UR_DEVICE_TYPE_CPU;
+        std::memcpy(pPropValue, &type, std::min(propSize, sizeof(type)));
+        return UR_RESULT_SUCCESS;
+    }
+    case UR_DEVICE_INFO_MEM_BASE_ADDR_ALIGN: {
+        size_t alignment = ASAN_SHADOW_GRANULARITY;
+        std::memcpy(pPropValue, &alignment,
+                    std::min(propSize, sizeof(alignment)));
+        return UR_RESULT_SUCCESS;
+    }
+    default:
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+}
+
+ur_result_t hostAlloc(ur_context_handle_t, const ur_usm_desc_t *,
+                      ur_usm_pool_handle_t, size_t size, void **ppMem) {
+    *ppMem = std::malloc(size);
+    return *ppMem ? UR_RESULT_SUCCESS
+                  : UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+ur_result_t usmFree(ur_context_handle_t, void *pMem) {
+    std::free(pMem);
+    return UR_RESULT_SUCCESS;
+}
+
+// Drives the interceptor of the layer against a CPU device whose calls are
+// answered by the functions above, instead of an adapter.
+struct SanitizerShadowTest : ::testing::Test {
+    static void SetUpTestSuite() {
+        context.urDdiTable.Device.pfnGetInfo = deviceGetInfo;
+        context.urDdiTable.USM.pfnHostAlloc = hostAlloc;
+        context.urDdiTable.USM.pfnFree = usmFree;
+
+        ASSERT_EQ(context.interceptor->insertContext(hContext),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(context.interceptor->insertDevice(hContext, hDevice),
+                  UR_RESULT_SUCCESS);
+    }
+
+    static void TearDownTestSuite() {
+        context.interceptor->eraseContext(hContext);
+    }
+
+    void SetUp() override { ASSERT_EQ(GetRetainedShadowPages(), 0u); }
+
+    void TearDown() override { EXPECT_EQ(GetRetainedShadowPages(), 0u); }
+
+    void *allocate(size_t size) {
+        ur_usm_desc_t desc{UR_STRUCTURE_TYPE_USM_DESC, nullptr, 0, 0};
+        void *ptr = nullptr;
+        EXPECT_EQ(context.interceptor->allocateMemory(hContext, nullptr, &desc,
+                                                      nullptr, size, &ptr,
+                                                      AllocType::HOST_USM),
+                  UR_RESULT_SUCCESS);
+        return ptr;
+    }
+
+    static u8 *shadowPage(size_t index) {
+        return reinterpret_cast<u8 *>(UNUSED_SHADOW + index * EXEC_PAGESIZE);
+    }
+
+    static void retainPages(size_t first, size_t count) {
+        RetainShadowMem(reinterpret_cast<uptr>(shadowPage(first)),
+                        reinterpret_cast<uptr>(shadowPage(first + count)));
+    }
+
+    static void releasePages(size_t first, size_t count) {
+        ReleaseShadowMem(reinterpret_cast<uptr>(shadowPage(first)),
+                         reinterpret_cast<uptr>(shadowPage(first + count)));
+    }
+};
+
+} // namespace
+
+TEST_F(SanitizerShadowTest, AllocationRetainsShadow) {
+    void *ptr = allocate(1 << 20);
+    ASSERT_NE(ptr, nullptr);
+
+    // 1 MiB of user memory is covered by 128 KiB of shadow.
+    EXPECT_GE(GetRetainedShadowPages(), (1u << 17) / EXEC_PAGESIZE);
+
+    EXPECT_EQ(context.interceptor->releaseMemory(hContext, ptr),
+              UR_RESULT_SUCCESS);
+}
+
+TEST_F(SanitizerShadowTest, ReleaseForgetsAllocation) {
+    void *ptr = allocate(64);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(context.interceptor->releaseMemory(hContext, ptr),
+              UR_RESULT_SUCCESS);
+
+    // The allocation is no longer known to the layer, so freeing it again is
+    // reported instead of releasing its shadow twice.
+    EXPECT_EQ(context.interceptor->releaseMemory(hContext, ptr),
+              UR_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(SanitizerShadowTest, RepeatedAllocFreeDoesNotGrow) {
+    for (size_t i = 0; i < 10000; i++) {
+        void *ptr = allocate(1 + (i * 4099) % (1 << 16));
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(context.interceptor->releaseMemory(hContext, ptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(GetRetainedShadowPages(), 0u) << "iteration " << i;
+    }
+}
+
+TEST_F(SanitizerShadowTest, RepeatedAllocFreeWithLiveAllocations) {
+    std::vector<void *> live;
+    for (size_t i = 0; i < 64; i++) {
+        live.push_back(allocate(4096));
+    }
+    size_t retained = GetRetainedShadowPages();
+    ASSERT_GT(retained, 0u);
+
+    for (size_t i = 0; i < 10000; i++) {
+        void *ptr = allocate(1 + (i * 4099) % (1 << 16));
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(context.interceptor->releaseMemory(hContext, ptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(GetRetainedShadowPages(), retained) << "iteration " << i;
+    }
+
+    for (void *ptr : live) {
+        ASSERT_EQ(context.interceptor->releaseMemory(hContext, ptr),
+                  UR_RESULT_SUCCESS);
+    }
+}
+
+TEST_F(SanitizerShadowTest, SharedPageKeptUntilLastRelease) {
+    retainPages(0, 2);
+    retainPages(1, 2);
+    EXPECT_EQ(GetRetainedShadowPages(), 3u);
+
+    releasePages(0, 2);
+    EXPECT_EQ(GetRetainedShadowPages(), 2u);
+
+    releasePages(1, 2);
+}
+
+TEST_F(SanitizerShadowTest, UnusedPagesReclaimed) {
+    retainPages(0, RECLAIM_BATCH_PAGES);
+    for (size_t i = 0; i < RECLAIM_BATCH_PAGES; i++) {
+        std::memset(shadowPage(i), 0xff, EXEC_PAGESIZE);
+    }
+    releasePages(0, RECLAIM_BATCH_PAGES);
+
+    for (size_t i = 0; i < RECLAIM_BATCH_PAGES; i++) {
+        ASSERT_EQ(shadowPage(i)[0], 0) << "page " << i;
+        ASSERT_EQ(shadowPage(i)[EXEC_PAGESIZE - 1], 0) << "page " << i;
+    }
+}
+
+TEST_F(SanitizerShadowTest, ReusedPagesNotReclaimed) {
+    retainPages(0, 2);
+    std::memset(shadowPage(0), 0xff, 2 * EXEC_PAGESIZE);
+    releasePages(0, 2);
+
+    // A new allocation uses the second page before the batch is reclaimed.
+    retainPages(1, 1);
+    retainPages(2, RECLAIM_BATCH_PAGES);
+    releasePages(2, RECLAIM_BATCH_PAGES);
+
+    EXPECT_EQ(shadowPage(0)[0], 0);
+    EXPECT_EQ(shadowPage(1)[0], 0xff);
+
+    releasePages(1, 1);
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_stats.hpp"
+
+#include <gtest/gtest.h>
+#include <ur_api.h>
+
+#include <algorithm>
+#include <thread>
+
+#include <unistd.h>
+
+using namespace ur_stats_layer;
+
+namespace {
+
+// Loads the null adapter with the stats layer enabled, and creates a queue
+// whose calls the layer records. The loader is initialized once per process,
+// so the suite shares it.
+struct StatsLayerTest : ::testing::Test {
+    static void SetUpTestSuite() {
+        ASSERT_EQ(urLoaderConfigCreate(&loader_config), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urLoaderConfigEnableLayer(loader_config, "UR_LAYER_STATS"),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urLoaderInit(0, loader_config), UR_RESULT_SUCCESS);
+
+        ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urPlatformGet(&adapter, 1, 1, &platform, nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                              nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+                  UR_RESULT_SUCCESS);
+    }
+
+    static void TearDownTestSuite() {
+        if (queue) {
+            EXPECT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+        }
+        if (context) {
+            EXPECT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        }
+        if (adapter) {
+            EXPECT_EQ(urAdapterRelease(adapter), UR_RESULT_SUCCESS);
+        }
+        if (loader_config) {
+            EXPECT_EQ(urLoaderConfigRelease(loader_config), UR_RESULT_SUCCESS);
+        }
+        EXPECT_EQ(urLoaderTearDown(), UR_RESULT_SUCCESS);
+
+        // The segment goes away with the layer.
+        auto pids = listSegments();
+        EXPECT_EQ(std::find(pids.begin(), pids.end(), pid()), pids.end());
+    }
+
+    void SetUp() override {
+        ASSERT_NE(queue, nullptr);
+        reader = segment_mapping_t::attach(pid());
+        ASSERT_TRUE(reader);
+    }
+
+    static uint32_t pid() { return static_cast<uint32_t>(getpid()); }
+
+    snapshot_t snapshot() { return snapshot_t::read(*reader.get()); }
+
+    static inline ur_loader_config_handle_t loader_config = nullptr;
+    static inline ur_adapter_handle_t adapter = nullptr;
+    static inline ur_platform_handle_t platform = nullptr;
+    static inline ur_device_handle_t device = nullptr;
+    static inline ur_context_handle_t context = nullptr;
+    static inline ur_queue_handle_t queue = nullptr;
+    segment_mapping_t reader;
+};
+
+} // namespace
+
+TEST_F(StatsLayerTest, SegmentCreated) {
+    auto pids = listSegments();
+    EXPECT_NE(std::find(pids.begin(), pids.end(), pid()), pids.end());
+    EXPECT_EQ(reader.get()->magic, SEGMENT_MAGIC);
+    EXPECT_EQ(reader.get()->version, SEGMENT_VERSION);
+    EXPECT_EQ(reader.get()->pid, pid());
+    EXPECT_GT(snapshot().functions[UR_FUNCTION_QUEUE_CREATE].calls, 0u);
+}
+
+TEST_F(StatsLayerTest, RecordsCalls) {
+    auto before = snapshot();
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+    }
+    auto after = snapshot();
+
+    auto delta = after.functions[UR_FUNCTION_QUEUE_FINISH] -
+                 before.functions[UR_FUNCTION_QUEUE_FINISH];
+    EXPECT_EQ(delta.calls, 10u);
+    EXPECT_EQ(delta.errors, 0u);
+    uint64_t histogram = 0;
+    for (auto count : delta.latency) {
+        histogram += count;
+    }
+    EXPECT_EQ(histogram, 10u);
+}
+
+TEST_F(StatsLayerTest, RecordsMemoryCalls) {
+    auto before = snapshot();
+    void *ptr = nullptr;
+    ASSERT_EQ(urUSMHostAlloc(context, nullptr, nullptr, 64, &ptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urUSMFree(context, ptr), UR_RESULT_SUCCESS);
+    ur_mem_handle_t buffer = nullptr;
+    ASSERT_EQ(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, 64, nullptr,
+                                &buffer),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urMemRelease(buffer), UR_RESULT_SUCCESS);
+    auto after = snapshot();
+
+    for (auto function : {UR_FUNCTION_USM_HOST_ALLOC, UR_FUNCTION_USM_FREE,
+                          UR_FUNCTION_MEM_BUFFER_CREATE,
+                          UR_FUNCTION_MEM_RELEASE}) {
+        auto delta = after.functions[function] - before.functions[function];
+        EXPECT_EQ(delta.calls, 1u) << function;
+    }
+}
+
+TEST_F(StatsLayerTest, RecordsErrors) {
+    auto before = snapshot();
+    // The null adapter rejects a buffer too small for the platform name.
+    char name[1];
+    ASSERT_EQ(urPlatformGetInfo(platform, UR_PLATFORM_INFO_NAME, sizeof(name),
+                                name, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    auto after = snapshot();
+
+    auto delta = after.functions[UR_FUNCTION_PLATFORM_GET_INFO] -
+                 before.functions[UR_FUNCTION_PLATFORM_GET_INFO];
+    EXPECT_EQ(delta.calls, 1u);
+    EXPECT_EQ(delta.errors, 1u);
+}
+
+TEST_F(StatsLayerTest, ThreadSlots) {
+    auto before = snapshot();
+    std::thread([&] {
+        for (int i = 0; i < 5; i++) {
+            EXPECT_EQ(urQueueFlush(queue), UR_RESULT_SUCCESS);
+        }
+    }).join();
+    auto after = snapshot();
+
+    EXPECT_GT(after.threadCount, before.threadCount);
+    auto *segment = reader.get();
+    uint32_t threadCount = segment->threadCount.load();
+    ASSERT_LE(threadCount, MAX_THREADS);
+    // The calls of the new thread land in its own slot.
+    auto &slot = segment->threads[threadCount - 1];
+    EXPECT_NE(slot.tid.load(), 0u);
+    EXPECT_NE(slot.tid.load(), static_cast<uint64_t>(pid()));
+    EXPECT_EQ(slot.functions[UR_FUNCTION_QUEUE_FLUSH].calls.load(), 5u);
+}
+
+TEST_F(StatsLayerTest, QueueSlots) {
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueFlush(queue), UR_RESULT_SUCCESS);
+
+    auto after = snapshot();
+    auto handle = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(queue));
+    auto it = std::find_if(after.queues.begin(), after.queues.end(),
+                           [&](auto &slot) { return slot.handle == handle; });
+    ASSERT_NE(it, after.queues.end());
+    EXPECT_GE(it->counters.calls, 2u);
+}
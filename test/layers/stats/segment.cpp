@@ -0,0 +1,128 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_stats.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <unistd.h>
+
+using namespace ur_stats_layer;
+
+namespace {
+
+void addCall(counters_t &counters, uint64_t ns, bool error = false) {
+    counters.calls++;
+    counters.errors += error;
+    counters.totalNs += ns;
+    counters.latency[latencyBucket(ns)]++;
+}
+
+struct SegmentTest : ::testing::Test {
+    // The test runs as its own process, so its pid is free.
+    uint32_t pid = static_cast<uint32_t>(getpid());
+    segment_mapping_t writer = segment_mapping_t::create(pid);
+
+    void SetUp() override { ASSERT_TRUE(writer); }
+};
+
+} // namespace
+
+TEST(LatencyBucketTest, PowersOfTwo) {
+    EXPECT_EQ(latencyBucket(0), 0u);
+    EXPECT_EQ(latencyBucket(1), 1u);
+    EXPECT_EQ(latencyBucket(2), 2u);
+    EXPECT_EQ(latencyBucket(3), 2u);
+    EXPECT_EQ(latencyBucket(1024), 11u);
+    EXPECT_EQ(latencyBucket(UINT64_MAX), LATENCY_BUCKETS - 1);
+}
+
+TEST(PercentileTest, Interpolates) {
+    counters_snapshot_t counters;
+    EXPECT_EQ(counters.percentileNs(50), 0u);
+
+    // 90 calls in [1024, 2048) and 10 calls in [1M, 2M).
+    counters.latency[11] = 90;
+    counters.latency[21] = 10;
+    EXPECT_GE(counters.percentileNs(50), 1024u);
+    EXPECT_LT(counters.percentileNs(50), 2048u);
+    EXPECT_GE(counters.percentileNs(99), 1u << 20);
+    EXPECT_LE(counters.percentileNs(99), 1u << 21);
+}
+
+TEST_F(SegmentTest, ListedAndRemoved) {
+    auto pids = listSegments();
+    EXPECT_NE(std::find(pids.begin(), pids.end(), pid), pids.end());
+
+    writer = segment_mapping_t{};
+    pids = listSegments();
+    EXPECT_EQ(std::find(pids.begin(), pids.end(), pid), pids.end());
+    EXPECT_FALSE(segment_mapping_t::attach(pid));
+}
+
+TEST_F(SegmentTest, ReaderSeesWrites) {
+    auto reader = segment_mapping_t::attach(pid);
+    ASSERT_TRUE(reader);
+    EXPECT_NE(reader.get(), writer.get());
+    EXPECT_EQ(reader.get()->pid, pid);
+
+    segment_t &segment = *writer.get();
+    segment.threadCount = 2;
+    addCall(segment.threads[0].functions[UR_FUNCTION_QUEUE_FINISH], 100);
+    addCall(segment.threads[1].functions[UR_FUNCTION_QUEUE_FINISH], 300,
+            true);
+    addCall(segment.threads[1].functions[UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH],
+            5000);
+    // Slots past the thread count are not claimed yet and ignored.
+    addCall(segment.threads[2].functions[UR_FUNCTION_QUEUE_FINISH], 1);
+
+    segment.queues[0].handle = 0x1000;
+    segment.queues[0].backend = UR_PLATFORM_BACKEND_NATIVE_CPU;
+    addCall(segment.queues[0].counters, 5000);
+    segment.queueCount = 1;
+    addCall(segment.backends[UR_PLATFORM_BACKEND_NATIVE_CPU], 5000);
+
+    auto snapshot = snapshot_t::read(*reader.get());
+    EXPECT_EQ(snapshot.threadCount, 2u);
+
+    auto &finish = snapshot.functions[UR_FUNCTION_QUEUE_FINISH];
+    EXPECT_EQ(finish.calls, 2u);
+    EXPECT_EQ(finish.errors, 1u);
+    EXPECT_EQ(finish.totalNs, 400u);
+    EXPECT_EQ(snapshot.functions[UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH].calls, 1u);
+
+    ASSERT_EQ(snapshot.queues.size(), 1u);
+    EXPECT_EQ(snapshot.queues[0].handle, 0x1000u);
+    EXPECT_EQ(snapshot.queues[0].backend, UR_PLATFORM_BACKEND_NATIVE_CPU);
+    EXPECT_EQ(snapshot.queues[0].counters.calls, 1u);
+    EXPECT_EQ(snapshot.backends[UR_PLATFORM_BACKEND_NATIVE_CPU].calls, 1u);
+}
+
+TEST_F(SegmentTest, DeltaBetweenSnapshots) {
+    auto reader = segment_mapping_t::attach(pid);
+    ASSERT_TRUE(reader);
+
+    segment_t &segment = *writer.get();
+    segment.threadCount = 1;
+    auto &counters = segment.threads[0].functions[UR_FUNCTION_USM_FREE];
+    addCall(counters, 10);
+    auto before = snapshot_t::read(*reader.get());
+    addCall(counters, 20);
+    addCall(counters, 30, true);
+    auto after = snapshot_t::read(*reader.get());
+
+    auto delta = after.functions[UR_FUNCTION_USM_FREE] -
+                 before.functions[UR_FUNCTION_USM_FREE];
+    EXPECT_EQ(delta.calls, 2u);
+    EXPECT_EQ(delta.errors, 1u);
+    EXPECT_EQ(delta.totalNs, 50u);
+
+    // Reversed snapshots don't wrap around.
+    auto reversed = before.functions[UR_FUNCTION_USM_FREE] -
+                    after.functions[UR_FUNCTION_USM_FREE];
+    EXPECT_EQ(reversed.calls, 0u);
+}
@@ -0,0 +1,28 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+# Checks that LIBRARY has the .note.stapsdt entries tracers attach to.
+# Expects READELF and LIBRARY to be defined.
+
+execute_process(
+    COMMAND ${READELF} --notes ${LIBRARY}
+    OUTPUT_VARIABLE NOTES
+    RESULT_VARIABLE RESULT
+)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Failed to read the notes of ${LIBRARY}")
+endif()
+
+foreach(PROBE function_begin function_end)
+    if(NOT NOTES MATCHES "Provider: ur[\r\n]+ *Name: ${PROBE}[\r\n]")
+        message(FATAL_ERROR "Probe ur:${PROBE} not found in ${LIBRARY}:\n${NOTES}")
+    endif()
+endforeach()
+
+# One semaphore per probe, so that tracers can enable each of them.
+string(REGEX MATCHALL "Semaphore: 0x0*[1-9a-f][0-9a-f]*" SEMAPHORES "${NOTES}")
+if(NOT SEMAPHORES)
+    message(FATAL_ERROR "Probes in ${LIBRARY} have no semaphore:\n${NOTES}")
+endif()
@@ -0,0 +1,301 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+#include <ur_api.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <csignal>
+#include <dlfcn.h>
+#include <elf.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+struct probes_t {
+    std::map<std::string, volatile unsigned short *> semaphores;
+    std::map<std::string, std::vector<unsigned char *>> sites;
+};
+
+// Finds the semaphores and sites of the probes in the loader the way tracers
+// do, from its .note.stapsdt section, and returns their addresses in this
+// process.
+probes_t findProbes() {
+    probes_t probes;
+    auto &semaphores = probes.semaphores;
+    Dl_info info;
+    if (!dladdr(reinterpret_cast<void *>(&urLoaderInit), &info) ||
+        !info.dli_fname) {
+        return probes;
+    }
+    std::ifstream file(info.dli_fname, std::ios::binary);
+    std::vector<char> image((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+    if (image.size() < sizeof(Elf64_Ehdr)) {
+        return probes;
+    }
+
+    auto *header = reinterpret_cast<const Elf64_Ehdr *>(image.data());
+    auto *segments =
+        reinterpret_cast<const Elf64_Phdr *>(image.data() + header->e_phoff);
+    auto *sections =
+        reinterpret_cast<const Elf64_Shdr *>(image.data() + header->e_shoff);
+    const char *sectionNames =
+        image.data() + sections[header->e_shstrndx].sh_offset;
+
+    // Shared libraries are mapped at an offset from their link addresses.
+    uint64_t firstLoad = UINT64_MAX;
+    for (int i = 0; i < header->e_phnum; i++) {
+        if (segments[i].p_type == PT_LOAD) {
+            firstLoad = std::min(firstLoad, segments[i].p_vaddr &
+                                                ~(segments[i].p_align - 1));
+        }
+    }
+    auto bias = reinterpret_cast<uintptr_t>(info.dli_fbase) - firstLoad;
+
+    const Elf64_Shdr *notes = nullptr;
+    const Elf64_Shdr *base = nullptr;
+    for (int i = 0; i < header->e_shnum; i++) {
+        const char *name = sectionNames + sections[i].sh_name;
+        if (strcmp(name, ".note.stapsdt") == 0) {
+            notes = &sections[i];
+        } else if (strcmp(name, ".stapsdt.base") == 0) {
+            base = &sections[i];
+        }
+    }
+    if (!notes || !base) {
+        return probes;
+    }
+
+    for (uint64_t offset = 0; offset + sizeof(Elf64_Nhdr) <= notes->sh_size;) {
+        auto *note = reinterpret_cast<const Elf64_Nhdr *>(
+            image.data() + notes->sh_offset + offset);
+        const char *name = reinterpret_cast<const char *>(note + 1);
+        const char *desc = name + ((note->n_namesz + 3) & ~3u);
+        offset += sizeof(Elf64_Nhdr) + ((note->n_namesz + 3) & ~3u) +
+                  ((note->n_descsz + 3) & ~3u);
+        if (note->n_type != 3 || strcmp(name, "stapsdt") != 0) {
+            continue;
+        }
+
+        // The location, base and semaphore addresses, then the provider,
+        // probe name and arguments.
+        uint64_t addresses[3];
+        memcpy(addresses, desc, sizeof(addresses));
+        const char *provider = desc + sizeof(addresses);
+        const char *probe = provider + strlen(provider) + 1;
+        if (strcmp(provider, "ur") != 0 || addresses[2] == 0) {
+            continue;
+        }
+        // Addresses are adjusted by how far .stapsdt.base moved, like
+        // tracers do for prelinked libraries.
+        uint64_t adjust = base->sh_addr - addresses[1];
+        semaphores[probe] = reinterpret_cast<volatile unsigned short *>(
+            bias + addresses[2] + adjust);
+        probes.sites[probe].push_back(
+            reinterpret_cast<unsigned char *>(bias + addresses[0] + adjust));
+    }
+    return probes;
+}
+
+volatile sig_atomic_t probeHits = 0;
+
+void onProbeHit(int) { probeHits = probeHits + 1; }
+
+// Counts the calls which reach the layer the way uprobes see them, by
+// replacing the nop at each of the probe sites with a breakpoint. The nop is a
+// single byte on x86-64, so execution resumes after it once the handler
+// returns.
+bool attachBreakpoints(const std::vector<unsigned char *> &sites) {
+#if defined(__x86_64__)
+    struct sigaction action = {};
+    action.sa_handler = onProbeHit;
+    if (sites.empty() || sigaction(SIGTRAP, &action, nullptr) != 0) {
+        return false;
+    }
+    auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    std::set<uintptr_t> pages;
+    for (auto *site : sites) {
+        pages.insert(reinterpret_cast<uintptr_t>(site) & ~(pageSize - 1));
+    }
+    for (auto page : pages) {
+        if (mprotect(reinterpret_cast<void *>(page), pageSize,
+                     PROT_READ | PROT_WRITE | PROT_EXEC) != 0) {
+            return false;
+        }
+    }
+    for (auto *site : sites) {
+        if (*site != 0x90) {
+            return false;
+        }
+        *site = 0xcc;
+    }
+    return true;
+#else
+    (void)sites;
+    return false;
+#endif
+}
+
+// Loads the null adapter with the USDT layer enabled. The tests run once
+// with the probes idle, and once with the semaphores set as by an attached
+// tracer, so that the probes build their arguments. The loader is
+// initialized once per process, so the suite shares it.
+struct UsdtLayerTest : ::testing::TestWithParam<bool> {
+    static void SetUpTestSuite() {
+        ASSERT_EQ(urLoaderConfigCreate(&loader_config), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urLoaderConfigEnableLayer(loader_config, "UR_LAYER_USDT"),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urLoaderInit(0, loader_config), UR_RESULT_SUCCESS);
+
+        ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urPlatformGet(&adapter, 1, 1, &platform, nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                              nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+        auto probes = findProbes();
+        semaphores = probes.semaphores;
+        breakpoints = attachBreakpoints(probes.sites["function_begin"]);
+    }
+
+    static void TearDownTestSuite() {
+        if (context) {
+            EXPECT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        }
+        if (adapter) {
+            EXPECT_EQ(urAdapterRelease(adapter), UR_RESULT_SUCCESS);
+        }
+        if (loader_config) {
+            EXPECT_EQ(urLoaderConfigRelease(loader_config), UR_RESULT_SUCCESS);
+        }
+        EXPECT_EQ(urLoaderTearDown(), UR_RESULT_SUCCESS);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(context, nullptr);
+        ASSERT_EQ(semaphores.count("function_begin"), 1u);
+        ASSERT_EQ(semaphores.count("function_end"), 1u);
+        if (GetParam()) {
+            for (auto &[probe, semaphore] : semaphores) {
+                (*semaphore)++;
+            }
+        }
+    }
+
+    void TearDown() override {
+        if (GetParam()) {
+            for (auto &[probe, semaphore] : semaphores) {
+                (*semaphore)--;
+            }
+        }
+    }
+
+    static inline ur_loader_config_handle_t loader_config = nullptr;
+    static inline ur_adapter_handle_t adapter = nullptr;
+    static inline ur_platform_handle_t platform = nullptr;
+    static inline ur_device_handle_t device = nullptr;
+    static inline ur_context_handle_t context = nullptr;
+    static inline std::map<std::string, volatile unsigned short *>
+        semaphores;
+    static inline bool breakpoints = false;
+};
+
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(
+    Probes, UsdtLayerTest, ::testing::Values(false, true),
+    [](const ::testing::TestParamInfo<bool> &info) {
+        return info.param ? "Attached" : "Idle";
+    });
+
+TEST_P(UsdtLayerTest, OutputsPassedThrough) {
+    size_t size = 0;
+    ASSERT_EQ(
+        urPlatformGetInfo(platform, UR_PLATFORM_INFO_NAME, 0, nullptr, &size),
+        UR_RESULT_SUCCESS);
+    ASSERT_EQ(size, sizeof("UR_PLATFORM_NULL"));
+    std::string name(size, '\0');
+    ASSERT_EQ(urPlatformGetInfo(platform, UR_PLATFORM_INFO_NAME, size,
+                                name.data(), nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_STREQ(name.c_str(), "UR_PLATFORM_NULL");
+
+    uint32_t count = 0;
+    ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 0, nullptr, &count),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(count, 1u);
+
+    ur_device_type_t type = UR_DEVICE_TYPE_ALL;
+    ASSERT_EQ(urDeviceGetInfo(device, UR_DEVICE_INFO_TYPE, sizeof(type), &type,
+                              nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(type, UR_DEVICE_TYPE_GPU);
+}
+
+TEST_P(UsdtLayerTest, ErrorsPassedThrough) {
+    char name[1];
+    ASSERT_EQ(urPlatformGetInfo(platform, UR_PLATFORM_INFO_NAME, sizeof(name),
+                                name, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    ur_device_type_t type;
+    ASSERT_EQ(urDeviceGetInfo(device, UR_DEVICE_INFO_TYPE, 1, &type, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_P(UsdtLayerTest, AllocationsPassedThrough) {
+    void *ptr = nullptr;
+    ASSERT_EQ(urUSMHostAlloc(context, nullptr, nullptr, 64, &ptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_NE(ptr, nullptr);
+    memset(ptr, 0x5a, 64);
+    ASSERT_EQ(urUSMFree(context, ptr), UR_RESULT_SUCCESS);
+}
+
+TEST_P(UsdtLayerTest, CallsReachLayer) {
+    if (!breakpoints) {
+        GTEST_SKIP() << "Breakpoints can't be set on the probe sites";
+    }
+    // With the probes idle, the layer skips its probe sites entirely.
+    const int expected = GetParam() ? 1 : 0;
+    int before = probeHits;
+
+    void *ptr = nullptr;
+    ASSERT_EQ(urUSMHostAlloc(context, nullptr, nullptr, 64, &ptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(probeHits - before, expected);
+    before = probeHits;
+    ASSERT_EQ(urUSMFree(context, ptr), UR_RESULT_SUCCESS);
+    ASSERT_EQ(probeHits - before, expected);
+
+    ur_mem_handle_t buffer = nullptr;
+    before = probeHits;
+    ASSERT_EQ(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, 64, nullptr,
+                                &buffer),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(probeHits - before, expected);
+    before = probeHits;
+    ASSERT_EQ(urMemRelease(buffer), UR_RESULT_SUCCESS);
+    ASSERT_EQ(probeHits - before, expected);
+
+    ur_device_type_t type;
+    before = probeHits;
+    ASSERT_EQ(urDeviceGetInfo(device, UR_DEVICE_INFO_TYPE, sizeof(type), &type,
+                              nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(probeHits - before, expected);
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.hpp"
+
+// Run with UR_VALIDATION_SAMPLING=enqueue:4;queue:4, so that the first and
+// fifth of eight calls are validated.
+
+TEST_F(urTest, testSampledEnqueueValidation) {
+    for (int i = 0; i < 8; i++) {
+        auto expected = i % 4 == 0 ? UR_RESULT_ERROR_INVALID_NULL_HANDLE
+                                   : UR_RESULT_SUCCESS;
+        ASSERT_EQ(urEnqueueEventsWait(nullptr, 0, nullptr, nullptr), expected);
+    }
+}
+
+TEST_F(urTest, testRetainAlwaysValidated) {
+    for (int i = 0; i < 8; i++) {
+        auto expected = i % 4 == 0 ? UR_RESULT_ERROR_INVALID_NULL_HANDLE
+                                   : UR_RESULT_SUCCESS;
+        ASSERT_EQ(urQueueFinish(nullptr), expected);
+        ASSERT_EQ(urQueueRetain(nullptr), UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    }
+}
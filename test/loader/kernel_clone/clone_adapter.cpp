@@ -0,0 +1,215 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Adapter implementing just enough to create and clone kernels, without
+// urKernelCloneExp, so that the loader emulates it.
+
+#include "clone_adapter.hpp"
+
+#include <ur_ddi.h>
+
+#include <cstring>
+#include <mutex>
+
+namespace clone_adapter {
+namespace {
+
+int adapter;
+int platform;
+int device;
+int context;
+int program;
+
+std::mutex mutex;
+// Kernels are kept after their release and handed out again, as adapters
+// may create a kernel at the address of a released one.
+std::vector<kernel_t *> released;
+
+template <typename T> T handle(int &object) {
+    return reinterpret_cast<T>(&object);
+}
+
+ur_result_t returnHandle(void *handle, uint32_t NumEntries, void *phEntries,
+                         uint32_t *pNumEntries) {
+    if (NumEntries > 0 && phEntries) {
+        *static_cast<void **>(phEntries) = handle;
+    }
+    if (pNumEntries) {
+        *pNumEntries = 1;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t returnInfo(const void *value, size_t size, size_t propSize,
+                       void *pPropValue, size_t *pPropSizeRet) {
+    if (pPropValue) {
+        if (propSize < size) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        std::memcpy(pPropValue, value, size);
+    }
+    if (pPropSizeRet) {
+        *pPropSizeRet = size;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
+                         uint32_t *pNumAdapters) {
+    return returnHandle(&adapter, NumEntries, phAdapters, pNumAdapters);
+}
+
+ur_result_t urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
+                          ur_platform_handle_t *phPlatforms,
+                          uint32_t *pNumPlatforms) {
+    return returnHandle(&platform, NumEntries, phPlatforms, pNumPlatforms);
+}
+
+ur_result_t urDeviceGet(ur_platform_handle_t, ur_device_type_t,
+                        uint32_t NumEntries, ur_device_handle_t *phDevices,
+                        uint32_t *pNumDevices) {
+    return returnHandle(&device, NumEntries, phDevices, pNumDevices);
+}
+
+ur_result_t urContextCreate(uint32_t, const ur_device_handle_t *,
+                            const ur_context_properties_t *,
+                            ur_context_handle_t *phContext) {
+    *phContext = handle<ur_context_handle_t>(context);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urProgramCreateWithIL(ur_context_handle_t, const void *, size_t,
+                                  const ur_program_properties_t *,
+                                  ur_program_handle_t *phProgram) {
+    *phProgram = handle<ur_program_handle_t>(program);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urKernelCreate(ur_program_handle_t hProgram,
+                           const char *pKernelName,
+                           ur_kernel_handle_t *phKernel) {
+    std::scoped_lock<std::mutex> lock(mutex);
+    kernel_t *kernel = nullptr;
+    if (released.empty()) {
+        kernel = new kernel_t;
+    } else {
+        kernel = released.back();
+        released.pop_back();
+        *kernel = kernel_t{};
+    }
+    kernel->hProgram = hProgram;
+    kernel->name = pKernelName;
+    *phKernel = reinterpret_cast<ur_kernel_handle_t>(kernel);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urKernelGetInfo(ur_kernel_handle_t hKernel,
+                            ur_kernel_info_t propName, size_t propSize,
+                            void *pPropValue, size_t *pPropSizeRet) {
+    auto kernel = reinterpret_cast<kernel_t *>(hKernel);
+    switch (propName) {
+    case UR_KERNEL_INFO_PROGRAM:
+        return returnInfo(&kernel->hProgram, sizeof(kernel->hProgram),
+                          propSize, pPropValue, pPropSizeRet);
+    case UR_KERNEL_INFO_FUNCTION_NAME:
+        return returnInfo(kernel->name.c_str(), kernel->name.size() + 1,
+                          propSize, pPropValue, pPropSizeRet);
+    default:
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+}
+
+ur_result_t urKernelGetNativeHandle(ur_kernel_handle_t hKernel,
+                                    ur_native_handle_t *phNativeKernel) {
+    *phNativeKernel = reinterpret_cast<ur_native_handle_t>(hKernel);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urKernelSetArgValue(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                size_t argSize,
+                                const ur_kernel_arg_value_properties_t *,
+                                const void *pArgValue) {
+    auto kernel = reinterpret_cast<kernel_t *>(hKernel);
+    auto bytes = static_cast<const char *>(pArgValue);
+    std::scoped_lock<std::mutex> lock(mutex);
+    kernel->args[argIndex].assign(bytes, bytes + argSize);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urKernelRetain(ur_kernel_handle_t hKernel) {
+    std::scoped_lock<std::mutex> lock(mutex);
+    reinterpret_cast<kernel_t *>(hKernel)->refCount++;
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urKernelRelease(ur_kernel_handle_t hKernel) {
+    auto kernel = reinterpret_cast<kernel_t *>(hKernel);
+    std::scoped_lock<std::mutex> lock(mutex);
+    if (--kernel->refCount == 0) {
+        released.push_back(kernel);
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace
+} // namespace clone_adapter
+
+extern "C" {
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetGlobalProcAddrTable(ur_api_version_t, ur_global_dditable_t *pDdiTable) {
+    pDdiTable->pfnAdapterGet = clone_adapter::urAdapterGet;
+    pDdiTable->pfnAdapterRelease = [](ur_adapter_handle_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
+    ur_api_version_t, ur_platform_dditable_t *pDdiTable) {
+    pDdiTable->pfnGet = clone_adapter::urPlatformGet;
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetDeviceProcAddrTable(ur_api_version_t, ur_device_dditable_t *pDdiTable) {
+    pDdiTable->pfnGet = clone_adapter::urDeviceGet;
+    pDdiTable->pfnRelease = [](ur_device_handle_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetContextProcAddrTable(ur_api_version_t, ur_context_dditable_t *pDdiTable) {
+    pDdiTable->pfnCreate = clone_adapter::urContextCreate;
+    pDdiTable->pfnRelease = [](ur_context_handle_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetProgramProcAddrTable(ur_api_version_t, ur_program_dditable_t *pDdiTable) {
+    pDdiTable->pfnCreateWithIL = clone_adapter::urProgramCreateWithIL;
+    pDdiTable->pfnRelease = [](ur_program_handle_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+// There is no urGetKernelExpProcAddrTable, so urKernelCloneExp is missing.
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetKernelProcAddrTable(ur_api_version_t, ur_kernel_dditable_t *pDdiTable) {
+    pDdiTable->pfnCreate = clone_adapter::urKernelCreate;
+    pDdiTable->pfnGetInfo = clone_adapter::urKernelGetInfo;
+    pDdiTable->pfnGetNativeHandle = clone_adapter::urKernelGetNativeHandle;
+    pDdiTable->pfnSetArgValue = clone_adapter::urKernelSetArgValue;
+    pDdiTable->pfnRetain = clone_adapter::urKernelRetain;
+    pDdiTable->pfnRelease = clone_adapter::urKernelRelease;
+    return UR_RESULT_SUCCESS;
+}
+
+} // extern "C"
@@ -0,0 +1,29 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_LOADER_KERNEL_CLONE_TEST_ADAPTER_H
+#define UR_LOADER_KERNEL_CLONE_TEST_ADAPTER_H
+
+#include <ur_api.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace clone_adapter {
+
+// Kernel of the test adapter, returned by urKernelGetNativeHandle so that
+// the test can see the arguments set on it.
+struct kernel_t {
+    ur_program_handle_t hProgram = nullptr;
+    std::string name;
+    std::map<uint32_t, std::vector<char>> args;
+    uint32_t refCount = 1;
+};
+
+} // namespace clone_adapter
+
+#endif // UR_LOADER_KERNEL_CLONE_TEST_ADAPTER_H
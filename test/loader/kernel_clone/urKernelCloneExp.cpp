@@ -0,0 +1,142 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "clone_adapter.hpp"
+
+#include <gtest/gtest.h>
+
+#ifndef ASSERT_SUCCESS
+#define ASSERT_SUCCESS(ACTUAL) ASSERT_EQ(UR_RESULT_SUCCESS, ACTUAL)
+#endif
+
+// Runs against the test adapter, which doesn't implement urKernelCloneExp,
+// with the loader forced to intercept the calls.
+struct LoaderKernelCloneTest : ::testing::Test {
+    void SetUp() override {
+        ASSERT_SUCCESS(urLoaderInit(0, nullptr));
+        uint32_t count = 0;
+        ASSERT_SUCCESS(urAdapterGet(1, &adapter, &count));
+        ASSERT_SUCCESS(urPlatformGet(&adapter, 1, 1, &platform, &count));
+        ASSERT_SUCCESS(
+            urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, &count));
+        ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, &context));
+        ASSERT_SUCCESS(urProgramCreateWithIL(context, il, sizeof(il), nullptr,
+                                             &program));
+        ASSERT_SUCCESS(urKernelCreate(program, "kernel", &kernel));
+    }
+
+    void TearDown() override {
+        if (kernel) {
+            EXPECT_EQ(urKernelRelease(kernel), UR_RESULT_SUCCESS);
+        }
+        if (program) {
+            EXPECT_EQ(urProgramRelease(program), UR_RESULT_SUCCESS);
+        }
+        if (context) {
+            EXPECT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        }
+        urLoaderTearDown();
+    }
+
+    static clone_adapter::kernel_t *native(ur_kernel_handle_t hKernel) {
+        ur_native_handle_t hNative = 0;
+        EXPECT_EQ(urKernelGetNativeHandle(hKernel, &hNative),
+                  UR_RESULT_SUCCESS);
+        return reinterpret_cast<clone_adapter::kernel_t *>(hNative);
+    }
+
+    static std::vector<char> bytes(uint32_t value) {
+        auto first = reinterpret_cast<const char *>(&value);
+        return {first, first + sizeof(value)};
+    }
+
+    const char il[4] = {};
+    ur_adapter_handle_t adapter = nullptr;
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+};
+
+TEST_F(LoaderKernelCloneTest, ReplaysArguments) {
+    uint32_t first = 42;
+    uint32_t second = 7;
+    ASSERT_SUCCESS(
+        urKernelSetArgValue(kernel, 0, sizeof(first), nullptr, &first));
+    ASSERT_SUCCESS(
+        urKernelSetArgValue(kernel, 1, sizeof(second), nullptr, &second));
+
+    ur_kernel_handle_t clone = nullptr;
+    ASSERT_SUCCESS(urKernelCloneExp(kernel, &clone));
+    ASSERT_NE(clone, kernel);
+    auto *cloned = native(clone);
+    ASSERT_NE(cloned, native(kernel));
+    ASSERT_EQ(cloned->name, "kernel");
+    ASSERT_EQ(cloned->args.size(), 2u);
+    ASSERT_EQ(cloned->args[0], bytes(first));
+    ASSERT_EQ(cloned->args[1], bytes(second));
+
+    // The clone's arguments are recorded too, separately from the original.
+    uint32_t third = 3;
+    ASSERT_SUCCESS(
+        urKernelSetArgValue(clone, 0, sizeof(third), nullptr, &third));
+    ur_kernel_handle_t cloneOfClone = nullptr;
+    ASSERT_SUCCESS(urKernelCloneExp(clone, &cloneOfClone));
+    ASSERT_EQ(native(cloneOfClone)->args[0], bytes(third));
+    ASSERT_EQ(native(kernel)->args[0], bytes(first));
+
+    ASSERT_SUCCESS(urKernelRelease(cloneOfClone));
+    ASSERT_SUCCESS(urKernelRelease(clone));
+}
+
+TEST_F(LoaderKernelCloneTest, RetainedKernelKeepsArguments) {
+    uint32_t value = 42;
+    ASSERT_SUCCESS(
+        urKernelSetArgValue(kernel, 0, sizeof(value), nullptr, &value));
+    ASSERT_SUCCESS(urKernelRetain(kernel));
+    ASSERT_SUCCESS(urKernelRelease(kernel));
+
+    ur_kernel_handle_t clone = nullptr;
+    ASSERT_SUCCESS(urKernelCloneExp(kernel, &clone));
+    ASSERT_EQ(native(clone)->args[0], bytes(value));
+    ASSERT_SUCCESS(urKernelRelease(clone));
+}
+
+TEST_F(LoaderKernelCloneTest, ReleasedKernelDropsArguments) {
+    uint32_t value = 42;
+    ASSERT_SUCCESS(
+        urKernelSetArgValue(kernel, 0, sizeof(value), nullptr, &value));
+    auto *released = native(kernel);
+    ASSERT_SUCCESS(urKernelRelease(kernel));
+
+    // The adapter creates the new kernel at the address of the released one,
+    // so the loader hands out the same loader handle.
+    ur_kernel_handle_t reused = nullptr;
+    ASSERT_SUCCESS(urKernelCreate(program, "kernel", &reused));
+    ASSERT_EQ(native(reused), released);
+    ASSERT_EQ(reused, kernel);
+    kernel = reused;
+
+    ur_kernel_handle_t clone = nullptr;
+    ASSERT_SUCCESS(urKernelCloneExp(kernel, &clone));
+    ASSERT_TRUE(native(clone)->args.empty());
+    ASSERT_SUCCESS(urKernelRelease(clone));
+}
+
+// Runs against the same adapter without forcing the interception, so the
+// loader returns the adapter's DDI tables directly.
+using LoaderKernelCloneDirectTest = LoaderKernelCloneTest;
+
+TEST_F(LoaderKernelCloneDirectTest, UnsupportedWithoutIntercept) {
+    uint32_t value = 42;
+    ASSERT_SUCCESS(
+        urKernelSetArgValue(kernel, 0, sizeof(value), nullptr, &value));
+
+    ur_kernel_handle_t clone = nullptr;
+    ASSERT_EQ(urKernelCloneExp(kernel, &clone),
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    ASSERT_EQ(clone, nullptr);
+}
@@ -0,0 +1,208 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_program_build_async.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef ASSERT_SUCCESS
+#define ASSERT_SUCCESS(ACTUAL) ASSERT_EQ(UR_RESULT_SUCCESS, ACTUAL)
+#endif
+
+namespace {
+
+const auto hContext = reinterpret_cast<ur_context_handle_t>(0x10);
+const auto hProgram = reinterpret_cast<ur_program_handle_t>(0x20);
+
+// State of the adapter the emulation dispatches to. Builds block until the
+// test opens the gate, so they are still running when the emulation returns.
+struct adapter_t {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool gateOpen = false;
+    ur_result_t buildResult = UR_RESULT_SUCCESS;
+    ur_result_t programRetainResult = UR_RESULT_SUCCESS;
+    std::vector<std::string> options;
+    size_t runningBuilds = 0;
+    size_t maxRunningBuilds = 0;
+    int contextRefs = 0;
+    int programRefs = 0;
+    size_t notifications = 0;
+    std::vector<ur_result_t> results;
+
+    void openGate() {
+        std::scoped_lock<std::mutex> lock(mutex);
+        gateOpen = true;
+        cv.notify_all();
+    }
+
+    // Waits until `count` builds have notified and released their handles.
+    void waitForBuilds(size_t count) {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] {
+            return notifications == count && contextRefs == 0 &&
+                   programRefs == 0;
+        });
+    }
+};
+
+adapter_t *adapter = nullptr;
+
+ur_result_t contextRetain(ur_context_handle_t) {
+    std::scoped_lock<std::mutex> lock(adapter->mutex);
+    adapter->contextRefs++;
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t contextRelease(ur_context_handle_t) {
+    std::scoped_lock<std::mutex> lock(adapter->mutex);
+    adapter->contextRefs--;
+    adapter->cv.notify_all();
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t programRetain(ur_program_handle_t) {
+    std::scoped_lock<std::mutex> lock(adapter->mutex);
+    if (adapter->programRetainResult != UR_RESULT_SUCCESS) {
+        return adapter->programRetainResult;
+    }
+    adapter->programRefs++;
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t programRelease(ur_program_handle_t) {
+    std::scoped_lock<std::mutex> lock(adapter->mutex);
+    adapter->programRefs--;
+    adapter->cv.notify_all();
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t programBuild(ur_context_handle_t, ur_program_handle_t,
+                         const char *pOptions) {
+    std::unique_lock<std::mutex> lock(adapter->mutex);
+    adapter->options.push_back(pOptions ? pOptions : "<null>");
+    adapter->runningBuilds++;
+    adapter->maxRunningBuilds =
+        std::max(adapter->maxRunningBuilds, adapter->runningBuilds);
+    adapter->cv.notify_all();
+    adapter->cv.wait(lock, [] { return adapter->gateOpen; });
+    adapter->runningBuilds--;
+    return adapter->buildResult;
+}
+
+void notify(ur_result_t result, void *pUserData) {
+    auto *state = static_cast<adapter_t *>(pUserData);
+    std::scoped_lock<std::mutex> lock(state->mutex);
+    state->notifications++;
+    state->results.push_back(result);
+    state->cv.notify_all();
+}
+
+// Drives the loader's emulation of urProgramBuildAsyncExp, as used for
+// adapters which don't implement it, against the functions above.
+struct ProgramBuildAsyncTest : ::testing::Test {
+    void SetUp() override {
+        adapter = &state;
+        dditable.ur.Context.pfnRetain = contextRetain;
+        dditable.ur.Context.pfnRelease = contextRelease;
+        dditable.ur.Program.pfnRetain = programRetain;
+        dditable.ur.Program.pfnRelease = programRelease;
+        dditable.ur.Program.pfnBuild = programBuild;
+    }
+
+    void TearDown() override {
+        // Don't leave builds blocked in the compile pool for later tests.
+        state.openGate();
+        state.waitForBuilds(started);
+        adapter = nullptr;
+    }
+
+    ur_result_t buildAsync(const char *pOptions = nullptr) {
+        ur_result_t result =
+            ur_loader::program_build_async::urProgramBuildAsyncExp(
+                &dditable, hContext, hProgram, pOptions, notify, &state);
+        if (result == UR_RESULT_SUCCESS) {
+            started++;
+        }
+        return result;
+    }
+
+    adapter_t state;
+    dditable_t dditable = {};
+    size_t started = 0;
+};
+
+} // namespace
+
+TEST_F(ProgramBuildAsyncTest, ReturnsBeforeBuildFinishes) {
+    ASSERT_SUCCESS(buildAsync());
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.cv.wait(lock, [&] { return state.runningBuilds == 1; });
+        ASSERT_EQ(state.notifications, 0u);
+        // The handles are held while the build runs.
+        ASSERT_EQ(state.contextRefs, 1);
+        ASSERT_EQ(state.programRefs, 1);
+    }
+
+    state.openGate();
+    state.waitForBuilds(1);
+    ASSERT_EQ(state.results, std::vector<ur_result_t>{UR_RESULT_SUCCESS});
+}
+
+TEST_F(ProgramBuildAsyncTest, BuildFailureNotified) {
+    state.buildResult = UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE;
+    state.openGate();
+    ASSERT_SUCCESS(buildAsync());
+    state.waitForBuilds(1);
+    ASSERT_EQ(state.results,
+              std::vector<ur_result_t>{UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE});
+}
+
+TEST_F(ProgramBuildAsyncTest, OptionsCopied) {
+    char options[] = "-O2";
+    ASSERT_SUCCESS(buildAsync(options));
+    std::strcpy(options, "-O0");
+    ASSERT_SUCCESS(buildAsync(nullptr));
+
+    state.openGate();
+    state.waitForBuilds(2);
+    std::sort(state.options.begin(), state.options.end());
+    ASSERT_EQ(state.options, (std::vector<std::string>{"-O2", "<null>"}));
+}
+
+TEST_F(ProgramBuildAsyncTest, RetainFailureNotStarted) {
+    state.programRetainResult = UR_RESULT_ERROR_INVALID_PROGRAM;
+    ASSERT_EQ(buildAsync(), UR_RESULT_ERROR_INVALID_PROGRAM);
+
+    std::scoped_lock<std::mutex> lock(state.mutex);
+    ASSERT_EQ(state.contextRefs, 0);
+    ASSERT_EQ(state.notifications, 0u);
+}
+
+TEST_F(ProgramBuildAsyncTest, ConcurrentBuildsBounded) {
+    // More builds than the pool has threads, whatever the host.
+    constexpr size_t builds = 64;
+    for (size_t i = 0; i < builds; i++) {
+        ASSERT_SUCCESS(buildAsync());
+    }
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.cv.wait(lock, [&] { return state.runningBuilds > 0; });
+        ASSERT_EQ(state.notifications, 0u);
+    }
+
+    state.openGate();
+    state.waitForBuilds(builds);
+    ASSERT_LE(state.maxRunningBuilds, 8u);
+    ASSERT_EQ(state.results.size(), builds);
+}
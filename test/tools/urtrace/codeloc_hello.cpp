@@ -0,0 +1,49 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Reports a code location for every call, so that urtrace aggregates the
+// calls per call site. urAdapterGet is called from two different lines,
+// urPlatformGet three times from a single line.
+
+#include <cstdio>
+#include <vector>
+
+#include "ur_api.h"
+
+static ur_code_location_t location = {};
+
+static ur_code_location_t codeloc(void *) { return location; }
+
+#define AT(call)                                                               \
+    (location = {__func__, "codeloc_hello.cpp", __LINE__, 0}, call)
+
+int main(int, char *[]) {
+    ur_loader_config_handle_t config = nullptr;
+    if (urLoaderConfigCreate(&config) != UR_RESULT_SUCCESS ||
+        urLoaderConfigSetCodeLocationCallback(config, codeloc, nullptr) !=
+            UR_RESULT_SUCCESS ||
+        urLoaderInit(0, config) != UR_RESULT_SUCCESS) {
+        fprintf(stderr, "Failed to initialize the loader\n");
+        return 1;
+    }
+
+    uint32_t adapterCount = 0;
+    AT(urAdapterGet(0, nullptr, &adapterCount));
+    std::vector<ur_adapter_handle_t> adapters(adapterCount);
+    AT(urAdapterGet(adapterCount, adapters.data(), nullptr));
+
+    for (int i = 0; i < 3; i++) {
+        uint32_t platformCount = 0;
+        AT(urPlatformGet(adapters.data(), adapterCount, 0, nullptr,
+                         &platformCount));
+    }
+
+    for (auto adapter : adapters) {
+        urAdapterRelease(adapter);
+    }
+    urLoaderConfigRelease(config);
+    urLoaderTearDown();
+    return 0;
+}
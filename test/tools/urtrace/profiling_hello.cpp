@@ -0,0 +1,49 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Submits a single command with an output event to a profiling-enabled queue,
+// which urtrace shows on the device track of the queue.
+
+#include <cstdio>
+
+#include "ur_api.h"
+
+int main(int, char *[]) {
+    if (urLoaderInit(0, nullptr) != UR_RESULT_SUCCESS) {
+        fprintf(stderr, "Failed to initialize the loader\n");
+        return 1;
+    }
+
+    ur_adapter_handle_t adapter = nullptr;
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    ur_event_handle_t event = nullptr;
+    ur_queue_properties_t properties = {UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+                                        nullptr,
+                                        UR_QUEUE_FLAG_PROFILING_ENABLE};
+    if (urAdapterGet(1, &adapter, nullptr) != UR_RESULT_SUCCESS ||
+        urPlatformGet(&adapter, 1, 1, &platform, nullptr) !=
+            UR_RESULT_SUCCESS ||
+        urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr) !=
+            UR_RESULT_SUCCESS ||
+        urContextCreate(1, &device, nullptr, &context) != UR_RESULT_SUCCESS ||
+        urQueueCreate(context, device, &properties, &queue) !=
+            UR_RESULT_SUCCESS ||
+        urEnqueueEventsWait(queue, 0, nullptr, &event) != UR_RESULT_SUCCESS ||
+        urEventWait(1, &event) != UR_RESULT_SUCCESS) {
+        fprintf(stderr, "Failed to submit the command\n");
+        return 1;
+    }
+
+    urEventRelease(event);
+    urQueueRelease(queue);
+    urContextRelease(context);
+    urDeviceRelease(device);
+    urAdapterRelease(adapter);
+    urLoaderTearDown();
+    return 0;
+}
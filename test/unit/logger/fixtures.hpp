@@ -96,4 +96,38 @@ class DefaultLoggerWithFileSink : public UniquePtrLoggerWithFilesink {
     }
 };
 
+class FlightRecorderLogger : public LoggerCommonSetup {
+  protected:
+    const filesystem::path file_path = "ur_test_flight_recorder.log";
+    std::unique_ptr<logger::Logger> logger;
+
+    void SetUp() override {
+        logger = std::make_unique<logger::Logger>(
+            logger::Level::DEBUG,
+            std::make_unique<logger::FlightRecorderSink>(logger_name,
+                                                         file_path));
+    }
+
+    void TearDown() override {
+        logger.reset();
+        filesystem::remove(file_path);
+    }
+
+    std::string readLog() {
+        std::ifstream test_log(file_path);
+        std::stringstream printed_msg;
+        printed_msg << test_log.rdbuf();
+        return printed_msg.str();
+    }
+
+    static size_t count(const std::string &text, const std::string &what) {
+        size_t found = 0;
+        for (size_t pos = text.find(what); pos != std::string::npos;
+             pos = text.find(what, pos + what.size())) {
+            found++;
+        }
+        return found;
+    }
+};
+
 #endif // UR_UNIT_LOGGER_TEST_FIXTURES_HPP
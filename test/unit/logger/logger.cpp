@@ -86,6 +86,68 @@ TEST_F(DefaultLoggerWithFileSink, SetLevelError) {
     test_msg << test_msg_prefix << "[ERROR]: Test message: success\n";
 }
 
+TEST_F(DefaultLoggerWithFileSink, RateLimited) {
+    for (int i = 0; i < 15; ++i) {
+        UR_LOG_RATE_LIMITED(*logger, logger::Level::WARN, "Test message: {}",
+                            i);
+    }
+
+    // The periods are long enough for all calls to fall in one of them.
+    for (uint64_t i = 0; i < logger::RateLimit::DEFAULT_BURST; ++i) {
+        test_msg << test_msg_prefix << "[WARNING]: Test message: " << i
+                 << "\n";
+    }
+    // Reported when the logger is destroyed.
+    test_msg << test_msg_prefix
+             << "[WARNING]: Suppressed 5 messages like \"Test message: {}\"\n";
+}
+
+TEST_F(DefaultLoggerWithFileSink, RateLimitedPerCallSite) {
+    // Call sites outlive the logger, which reports their counts.
+    static logger::RateLimit first(1, 3600 * 1000);
+    static logger::RateLimit second(1, 3600 * 1000);
+    for (int i = 0; i < 3; ++i) {
+        logger->logRateLimited(first, logger::Level::ERR, "First: {}", i);
+        logger->logRateLimited(second, logger::Level::ERR, "Second: {}", i);
+    }
+
+    test_msg << test_msg_prefix << "[ERROR]: First: 0\n"
+             << test_msg_prefix << "[ERROR]: Second: 0\n"
+             << test_msg_prefix
+             << "[ERROR]: Suppressed 2 messages like \"First: {}\"\n"
+             << test_msg_prefix
+             << "[ERROR]: Suppressed 2 messages like \"Second: {}\"\n";
+}
+
+TEST_F(DefaultLoggerWithFileSink, RateLimitedSharedByLoggers) {
+    static logger::RateLimit limit(1, 3600 * 1000);
+    {
+        // Reports its own suppressed message when destroyed.
+        logger::Logger other(logger::Level::WARN,
+                             std::make_unique<logger::StderrSink>("other"));
+        for (int i = 0; i < 2; ++i) {
+            other.logRateLimited(limit, logger::Level::WARN, "Shared: {}", i);
+        }
+    }
+    for (int i = 0; i < 2; ++i) {
+        logger->logRateLimited(limit, logger::Level::WARN, "Shared: {}", i);
+    }
+
+    test_msg << test_msg_prefix
+             << "[WARNING]: Suppressed 2 messages like \"Shared: {}\"\n";
+}
+
+TEST_F(DefaultLoggerWithFileSink, RateLimitedBelowLevel) {
+    static logger::RateLimit limit(1, 3600 * 1000);
+    for (int i = 0; i < 3; ++i) {
+        logger->logRateLimited(limit, logger::Level::INFO,
+                               "This should not be printed: {}", i);
+    }
+    logger->warning("Test message: {}", "success");
+
+    test_msg << test_msg_prefix << "[WARNING]: Test message: success\n";
+}
+
 //////////////////////////////////////////////////////////////////////////////
 TEST_F(UniquePtrLoggerWithFilesink, SetLogLevelAndFlushLevelDebugWithCtor) {
     auto level = logger::Level::DEBUG;
@@ -119,6 +181,148 @@ TEST_F(UniquePtrLoggerWithFilesinkFail, NullSink) {
     test_msg.clear();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+TEST_F(FlightRecorderLogger, NoOutputBelowFlushLevel) {
+    logger->debug("Test message: {}", 1);
+    logger->warning("Test message: {}", 2);
+    ASSERT_EQ(readLog(), "");
+}
+
+TEST_F(FlightRecorderLogger, DumpOnError) {
+    logger->debug("Test message: {}", 1);
+    logger->info("Test message: {}", 2);
+    logger->error("Test message: {}", 3);
+
+    auto log = readLog();
+    ASSERT_EQ(count(log, "==== flight recorder, dump on ERROR ===="), 1);
+    ASSERT_EQ(count(log, "---- thread "), 1);
+    auto debug = log.find(test_msg_prefix + "[DEBUG]: Test message: 1\n");
+    auto info = log.find(test_msg_prefix + "[INFO]: Test message: 2\n");
+    auto error = log.find(test_msg_prefix + "[ERROR]: Test message: 3\n");
+    ASSERT_NE(debug, std::string::npos);
+    ASSERT_NE(info, std::string::npos);
+    ASSERT_NE(error, std::string::npos);
+    ASSERT_LT(debug, info);
+    ASSERT_LT(info, error);
+}
+
+TEST_F(FlightRecorderLogger, DumpsEachRecordOnce) {
+    logger->debug("First message");
+    logger->error("First error");
+    logger->debug("Second message");
+    logger->error("Second error");
+    logger.reset();
+
+    auto log = readLog();
+    ASSERT_EQ(count(log, "dump on ERROR"), 2);
+    ASSERT_EQ(count(log, "dump on exit"), 0);
+    ASSERT_EQ(count(log, "First message"), 1);
+    ASSERT_EQ(count(log, "Second message"), 1);
+}
+
+TEST_F(FlightRecorderLogger, OldRecordsOverwritten) {
+    constexpr size_t extra = 10;
+    for (size_t i = 0;
+         i < logger::FlightRecorderSink::RING_RECORDS + extra - 1; i++) {
+        logger->debug("Message {}", i);
+    }
+    logger->error("Last message");
+
+    auto log = readLog();
+    ASSERT_EQ(count(log, ", 10 older records overwritten"), 1);
+    ASSERT_EQ(count(log, "[DEBUG]: Message 9\n"), 0);
+    ASSERT_EQ(count(log, "[DEBUG]: Message 10\n"), 1);
+    ASSERT_EQ(count(log, "[DEBUG]: Message "),
+              logger::FlightRecorderSink::RING_RECORDS - 1);
+}
+
+TEST_F(FlightRecorderLogger, LongMessageTruncated) {
+    std::string long_msg(2 * logger::FlightRecorderSink::RECORD_TEXT_SIZE,
+                         'x');
+    logger->error("{}", long_msg);
+
+    auto log = readLog();
+    ASSERT_EQ(count(log, "...\n"), 1);
+    ASSERT_LT(count(log, "x"), logger::FlightRecorderSink::RECORD_TEXT_SIZE);
+}
+
+TEST_F(FlightRecorderLogger, RingPerThread) {
+    constexpr int thread_count = 4;
+    std::vector<std::thread> threads;
+    // Keep all threads alive until each has logged, so that none of them
+    // reuses the ring of a finished thread.
+    std::atomic<int> started = 0;
+    for (int i = 0; i < thread_count; i++) {
+        threads.emplace_back([&, i]() {
+            logger->debug("Thread {} started", i);
+            started++;
+            while (started < thread_count) {
+                std::this_thread::yield();
+            }
+            for (int j = 0; j < 50; ++j) {
+                logger->debug("Thread {} message {}", i, j);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    logger->error("Done");
+
+    auto log = readLog();
+    ASSERT_EQ(count(log, "---- thread "), thread_count + 1);
+    ASSERT_EQ(count(log, "[DEBUG]: Thread "), thread_count * 51);
+}
+
+TEST_F(FlightRecorderLogger, ConcurrentDumpsWriteEachRecordOnce) {
+    constexpr int message_count = 100;
+    for (int i = 0; i < message_count; i++) {
+        logger->debug("Message {}", i);
+    }
+
+    constexpr int thread_count = 4;
+    std::vector<std::thread> threads;
+    std::atomic<int> started = 0;
+    for (int i = 0; i < thread_count; i++) {
+        threads.emplace_back([&]() {
+            started++;
+            while (started < thread_count) {
+                std::this_thread::yield();
+            }
+            logger::FlightRecorderSink::dumpAll("test");
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto log = readLog();
+    ASSERT_EQ(count(log, "==== flight recorder, dump on test ===="), 1);
+    ASSERT_EQ(count(log, "[DEBUG]: Message "), message_count);
+}
+
+TEST_F(FlightRecorderLogger, DestroyedDuringDumpAll) {
+    std::atomic<bool> done = false;
+    std::thread dumper([&]() {
+        while (!done) {
+            logger::FlightRecorderSink::dumpAll("test");
+        }
+    });
+    for (int i = 0; i < 100; i++) {
+        logger = std::make_unique<logger::Logger>(
+            logger::Level::DEBUG,
+            std::make_unique<logger::FlightRecorderSink>(logger_name,
+                                                         file_path));
+        logger->debug("Sink {}", i);
+    }
+    logger.reset();
+    done = true;
+    dumper.join();
+
+    // Each record is dumped once, either by dumpAll or on exit.
+    ASSERT_EQ(count(readLog(), "[DEBUG]: Sink "), 100);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 INSTANTIATE_TEST_SUITE_P(
     ThreadCount, FileSinkLoggerMultipleThreads,
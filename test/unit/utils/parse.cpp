@@ -0,0 +1,41 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_util.hpp"
+
+TEST(ParseUint, Valid) {
+    ASSERT_EQ(ur_parse_uint("0"), 0u);
+    ASSERT_EQ(ur_parse_uint("42"), 42u);
+    ASSERT_EQ(ur_parse_uint("18446744073709551615"), UINT64_MAX);
+}
+
+TEST(ParseUint, Invalid) {
+    ASSERT_FALSE(ur_parse_uint(""));
+    ASSERT_FALSE(ur_parse_uint("4abc"));
+    ASSERT_FALSE(ur_parse_uint(" 4"));
+    ASSERT_FALSE(ur_parse_uint("-1"));
+    ASSERT_FALSE(ur_parse_uint("1k"));
+    ASSERT_FALSE(ur_parse_uint("18446744073709551616"));
+}
+
+TEST(ParseSize, Valid) {
+    ASSERT_EQ(ur_parse_size("100"), 100u);
+    ASSERT_EQ(ur_parse_size("64K"), 64u * 1024);
+    ASSERT_EQ(ur_parse_size("64k"), 64u * 1024);
+    ASSERT_EQ(ur_parse_size("2M"), 2u * 1024 * 1024);
+    ASSERT_EQ(ur_parse_size("1g"), size_t(1) << 30);
+}
+
+TEST(ParseSize, Invalid) {
+    ASSERT_FALSE(ur_parse_size(""));
+    ASSERT_FALSE(ur_parse_size("K"));
+    ASSERT_FALSE(ur_parse_size("1T"));
+    ASSERT_FALSE(ur_parse_size("1KB"));
+    ASSERT_FALSE(ur_parse_size("-1"));
+    ASSERT_FALSE(ur_parse_size("99999999999999999999"));
+    ASSERT_FALSE(ur_parse_size("18446744073709551615K"));
+}
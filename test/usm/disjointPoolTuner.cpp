@@ -0,0 +1,139 @@
+// Copyright (C) 2023 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "umf_pools/disjoint_pool_tuner.hpp"
+
+#include <gtest/gtest.h>
+
+static void *fakePtr(size_t i) {
+    return reinterpret_cast<void *>(uintptr_t(0x1000) * (i + 1));
+}
+
+TEST(disjointPoolTunerTest, parseParams) {
+    auto params = usm::parseDisjointPoolTunerConfig("8,512,32M,8");
+    ASSERT_EQ(params.SampleRate, 8);
+    ASSERT_EQ(params.RetuneInterval, 512);
+    ASSERT_EQ(params.MaxPoolableSizeLimit, 32 * 1024 * 1024);
+    ASSERT_EQ(params.CapacityLimit, 8);
+
+    auto defaults = usm::parseDisjointPoolTunerConfig(",,,");
+    ASSERT_EQ(defaults.SampleRate, usm::DisjointPoolTunerParams{}.SampleRate);
+    ASSERT_EQ(defaults.CapacityLimit,
+              usm::DisjointPoolTunerParams{}.CapacityLimit);
+}
+
+TEST(disjointPoolTunerTest, parseInvalidParams) {
+    usm::DisjointPoolTunerParams defaults;
+    auto params = usm::parseDisjointPoolTunerConfig(
+        "8x,99999999999999999999999,-1,99999999999999999999G");
+    ASSERT_EQ(params.SampleRate, defaults.SampleRate);
+    ASSERT_EQ(params.RetuneInterval, defaults.RetuneInterval);
+    ASSERT_EQ(params.MaxPoolableSizeLimit, defaults.MaxPoolableSizeLimit);
+    ASSERT_EQ(params.CapacityLimit, defaults.CapacityLimit);
+}
+
+TEST(disjointPoolTunerTest, hotSizeAbovePoolableSizeIsPooled) {
+    usm::DisjointPoolAllConfigs configs;
+    usm::DisjointPoolTunerParams params;
+    params.SampleRate = 1;
+    params.RetuneInterval = 64;
+    usm::DisjointPoolTuner tuner(configs, params);
+
+    // A loop reusing two 3MB host buffers, just above the 2MB default.
+    for (size_t i = 0; i < 256; i++) {
+        tuner.recordAlloc(usm::DisjointPoolMemType::Host, fakePtr(2 * i),
+                          3 * 1024 * 1024);
+        tuner.recordAlloc(usm::DisjointPoolMemType::Host, fakePtr(2 * i + 1),
+                          3 * 1024 * 1024);
+        tuner.recordFree(fakePtr(2 * i));
+        tuner.recordFree(fakePtr(2 * i + 1));
+    }
+
+    auto tuned = tuner.getConfigs();
+    ASSERT_GT(tuner.getRetuneCount(), 0);
+    ASSERT_EQ(tuned.Configs[usm::DisjointPoolMemType::Host].MaxPoolableSize,
+              4 * 1024 * 1024);
+    ASSERT_GE(tuned.Configs[usm::DisjointPoolMemType::Host].Capacity,
+              configs.Configs[usm::DisjointPoolMemType::Host].Capacity);
+
+    // Other memory types are left alone.
+    ASSERT_EQ(tuned.Configs[usm::DisjointPoolMemType::Shared].MaxPoolableSize,
+              0);
+
+    // The logged config string reproduces the tuned configuration.
+    auto parsed =
+        usm::parseDisjointPoolConfig(usm::disjointPoolConfigToString(tuned), 0);
+    for (int i = 0; i < usm::DisjointPoolMemType::All; i++) {
+        ASSERT_EQ(parsed.Configs[i].MaxPoolableSize,
+                  tuned.Configs[i].MaxPoolableSize);
+        ASSERT_EQ(parsed.Configs[i].Capacity, tuned.Configs[i].Capacity);
+        ASSERT_EQ(parsed.Configs[i].SlabMinSize, tuned.Configs[i].SlabMinSize);
+    }
+}
+
+TEST(disjointPoolTunerTest, tuningRespectsLimits) {
+    usm::DisjointPoolAllConfigs configs;
+    usm::DisjointPoolTunerParams params;
+    params.SampleRate = 1;
+    params.RetuneInterval = 64;
+    params.MaxPoolableSizeLimit = 8 * 1024 * 1024;
+    usm::DisjointPoolTuner tuner(configs, params);
+
+    for (size_t i = 0; i < 256; i++) {
+        tuner.recordAlloc(usm::DisjointPoolMemType::Device, fakePtr(i),
+                          100 * 1024 * 1024);
+        tuner.recordFree(fakePtr(i));
+    }
+
+    auto tuned = tuner.getConfigs();
+    ASSERT_EQ(tuned.Configs[usm::DisjointPoolMemType::Device].MaxPoolableSize,
+              params.MaxPoolableSizeLimit);
+    ASSERT_LE(tuned.Configs[usm::DisjointPoolMemType::Device].Capacity,
+              params.CapacityLimit);
+}
+
+TEST(disjointPoolTunerTest, recycledAddressIsSampled) {
+    usm::DisjointPoolAllConfigs configs;
+    usm::DisjointPoolTunerParams params;
+    params.SampleRate = 4;
+    params.RetuneInterval = 16;
+
+    // A pool recycling one block for every allocation, whatever its address.
+    for (size_t i = 0; i < 8; i++) {
+        usm::DisjointPoolTuner tuner(configs, params);
+        for (size_t j = 0; j < 256; j++) {
+            tuner.recordAlloc(usm::DisjointPoolMemType::Host, fakePtr(i),
+                              3 * 1024 * 1024);
+            tuner.recordFree(fakePtr(i));
+        }
+        ASSERT_EQ(tuner.getConfigs()
+                      .Configs[usm::DisjointPoolMemType::Host]
+                      .MaxPoolableSize,
+                  4 * 1024 * 1024);
+    }
+}
+
+TEST(disjointPoolTunerTest, applyTunedSettingsKeepsLimits) {
+    usm::DisjointPoolAllConfigs configs;
+    usm::DisjointPoolTunerParams params;
+    params.SampleRate = 1;
+    params.RetuneInterval = 64;
+    usm::DisjointPoolTuner tuner(configs, params);
+    for (size_t i = 0; i < 256; i++) {
+        tuner.recordAlloc(usm::DisjointPoolMemType::Host, fakePtr(i),
+                          3 * 1024 * 1024);
+        tuner.recordFree(fakePtr(i));
+    }
+
+    auto pool = usm::parseDisjointPoolConfig("1;32M", 0);
+    auto limits = pool.limits;
+    tuner.applyTunedSettings(pool);
+    ASSERT_EQ(pool.limits, limits);
+    ASSERT_EQ(pool.MaxPoolSize, 32 * 1024 * 1024);
+    ASSERT_EQ(pool.Configs[usm::DisjointPoolMemType::Host].MaxPoolableSize,
+              4 * 1024 * 1024);
+    ASSERT_EQ(pool.Configs[usm::DisjointPoolMemType::Host].SharedLimits,
+              limits.get());
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "umf_providers/host_memory_provider.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+static constexpr size_t MB = 1024 * 1024;
+
+TEST(hostMemoryProviderTest, parseParams) {
+    auto params = usm::parseHostMemoryProviderConfig("hugetlb,4M,1,bind");
+    ASSERT_EQ(params.PageMode, usm::HostPageMode::HugeTLB);
+    ASSERT_EQ(params.HugePageThreshold, 4 * MB);
+    ASSERT_EQ(params.NumaNode, 1);
+    ASSERT_EQ(params.NumaPolicy, usm::HostNumaPolicy::Bind);
+
+    auto defaults = usm::parseHostMemoryProviderConfig(",,,");
+    ASSERT_EQ(defaults.PageMode, usm::HostPageMode::None);
+    ASSERT_EQ(defaults.HugePageThreshold,
+              usm::HostMemoryProviderParams{}.HugePageThreshold);
+    ASSERT_EQ(defaults.NumaNode, -1);
+    ASSERT_EQ(defaults.NumaPolicy, usm::HostNumaPolicy::Preferred);
+
+    auto thp = usm::parseHostMemoryProviderConfig("thp");
+    ASSERT_EQ(thp.PageMode, usm::HostPageMode::Transparent);
+}
+
+TEST(hostMemoryProviderTest, parseInvalidParams) {
+    usm::HostMemoryProviderParams defaults;
+
+    auto oversized =
+        usm::parseHostMemoryProviderConfig("thp,99999999999999999999G,x");
+    ASSERT_EQ(oversized.HugePageThreshold, defaults.HugePageThreshold);
+    ASSERT_EQ(oversized.NumaNode, -1);
+
+    // NUMA nodes are plain integers, size suffixes are rejected.
+    auto suffixed = usm::parseHostMemoryProviderConfig("thp,,1k");
+    ASSERT_EQ(suffixed.NumaNode, -1);
+    auto trailing = usm::parseHostMemoryProviderConfig("thp,,1abc");
+    ASSERT_EQ(trailing.NumaNode, -1);
+}
+
+TEST(hostMemoryProviderTest, largeAllocationsAreHugePageAligned) {
+    usm::HostMemoryProvider provider;
+    ASSERT_EQ(provider.initialize(usm::parseHostMemoryProviderConfig("thp")),
+              UMF_RESULT_SUCCESS);
+    size_t hugePageSize = provider.getHugePageSize();
+
+    size_t pageSize = 0;
+    ASSERT_EQ(provider.get_recommended_page_size(4 * MB, &pageSize),
+              UMF_RESULT_SUCCESS);
+    ASSERT_EQ(pageSize, hugePageSize);
+    ASSERT_EQ(provider.get_recommended_page_size(4096, &pageSize),
+              UMF_RESULT_SUCCESS);
+    ASSERT_LT(pageSize, hugePageSize);
+
+    void *ptr = nullptr;
+    ASSERT_EQ(provider.alloc(3 * MB, 0, &ptr), UMF_RESULT_SUCCESS);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % hugePageSize, 0);
+    memset(ptr, 0xab, 3 * MB);
+    ASSERT_EQ(provider.purge_force(ptr, 3 * MB), UMF_RESULT_SUCCESS);
+    ASSERT_EQ(static_cast<unsigned char *>(ptr)[0], 0);
+    ASSERT_EQ(provider.free(ptr, 3 * MB), UMF_RESULT_SUCCESS);
+}
+
+TEST(hostMemoryProviderTest, hugePagesAreOptIn) {
+    usm::HostMemoryProvider provider;
+    ASSERT_EQ(provider.initialize(usm::HostMemoryProviderParams{}),
+              UMF_RESULT_SUCCESS);
+
+    size_t pageSize = 0;
+    ASSERT_EQ(provider.get_recommended_page_size(4 * MB, &pageSize),
+              UMF_RESULT_SUCCESS);
+    ASSERT_LT(pageSize, provider.getHugePageSize());
+}
+
+TEST(hostMemoryProviderTest, smallAllocationsHonorAlignment) {
+    usm::HostMemoryProvider provider;
+    ASSERT_EQ(provider.initialize(usm::HostMemoryProviderParams{}),
+              UMF_RESULT_SUCCESS);
+
+    void *ptr = nullptr;
+    ASSERT_EQ(provider.alloc(100, 64 * 1024, &ptr), UMF_RESULT_SUCCESS);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % (64 * 1024), 0);
+    memset(ptr, 0, 100);
+    // Freeing does not rely on the size passed by UMF.
+    ASSERT_EQ(provider.free(ptr, 0), UMF_RESULT_SUCCESS);
+    ASSERT_EQ(provider.free(ptr, 0), UMF_RESULT_ERROR_INVALID_ARGUMENT);
+
+    ASSERT_EQ(provider.alloc(100, 3, &ptr), UMF_RESULT_ERROR_INVALID_ALIGNMENT);
+}
+
+TEST(hostMemoryProviderTest, hugeTLBFallsBackWhenPoolIsEmpty) {
+    auto params = usm::parseHostMemoryProviderConfig("hugetlb,2M,0");
+    usm::HostMemoryProvider provider;
+    ASSERT_EQ(provider.initialize(params), UMF_RESULT_SUCCESS);
+
+    // Succeeds whether or not huge pages are reserved, node 0 always exists
+    // and the preferred policy tolerates kernels without NUMA support.
+    void *ptr = nullptr;
+    ASSERT_EQ(provider.alloc(4 * MB, 0, &ptr), UMF_RESULT_SUCCESS);
+    memset(ptr, 1, 4 * MB);
+    size_t pageSize = 0;
+    ASSERT_EQ(provider.get_min_page_size(ptr, &pageSize), UMF_RESULT_SUCCESS);
+    ASSERT_GT(pageSize, 0);
+    ASSERT_EQ(provider.free(ptr, 4 * MB), UMF_RESULT_SUCCESS);
+}
@@ -0,0 +1,307 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_print.hpp"
+#include "ur_stats.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cinttypes>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace urtop {
+using namespace ur_stats_layer;
+
+enum class sort_key { calls, errors, time, p99 };
+
+struct row_t {
+    std::string name;
+    counters_snapshot_t delta;
+    uint64_t totalCalls;
+};
+
+static std::string enumName(std::string name, std::string_view prefix) {
+    if (name.compare(0, prefix.size(), prefix) == 0) {
+        name.erase(0, prefix.size());
+    }
+    return name;
+}
+
+static std::string functionName(uint32_t function) {
+    std::ostringstream os;
+    os << static_cast<ur_function_t>(function);
+    return enumName(os.str(), "UR_FUNCTION_");
+}
+
+static std::string backendName(ur_platform_backend_t backend) {
+    std::ostringstream os;
+    os << backend;
+    return enumName(os.str(), "UR_PLATFORM_BACKEND_");
+}
+
+static std::string formatNs(uint64_t ns) {
+    char buffer[32];
+    if (ns < 1000) {
+        std::snprintf(buffer, sizeof(buffer), "%" PRIu64 "ns", ns);
+    } else if (ns < 1000 * 1000) {
+        std::snprintf(buffer, sizeof(buffer), "%.1fus", ns / 1e3);
+    } else if (ns < 1000 * 1000 * 1000) {
+        std::snprintf(buffer, sizeof(buffer), "%.1fms", ns / 1e6);
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "%.1fs", ns / 1e9);
+    }
+    return buffer;
+}
+
+static std::string processName(uint32_t pid) {
+    std::ifstream comm("/proc/" + std::to_string(pid) + "/comm");
+    std::string name;
+    std::getline(comm, name);
+    return name;
+}
+
+static bool processAlive(uint32_t pid) {
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+}
+
+struct app {
+    uint32_t pid = 0;
+    double interval = 1.0;
+    long iterations = -1;
+    size_t limit = 20;
+    sort_key sortBy = sort_key::calls;
+    bool batch = false;
+
+    app(int argc, const char **argv) { parseArgs(argc, argv); }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage = R"(usage: %s [-h] [-b] [-d SECONDS] [-n COUNT] [-l COUNT]
+       [-s calls|errors|time|p99] [PID]
+
+This tool shows live Unified Runtime call statistics of a running process.
+The process must have the UR_LAYER_STATS layer enabled, for example with
+UR_ENABLE_LAYERS=UR_LAYER_STATS. Without a PID, lists the processes which
+can be attached to.
+
+options:
+  -h, --help            show this help message and exit
+  -b, --batch           print each update below the previous one instead of
+                        redrawing the screen
+  -d, --delay SECONDS   time between updates, default 1
+  -n, --iterations COUNT
+                        exit after COUNT updates
+  -l, --limit COUNT     show at most COUNT functions, default 20
+  -s, --sort KEY        order functions by calls per second, errors, total
+                        time or p99 latency, default calls
+)";
+        auto value = [&](int &argi) -> const char * {
+            if (argi + 1 >= argc) {
+                std::fprintf(stderr, "error: missing value for %s\n",
+                             argv[argi]);
+                std::exit(1);
+            }
+            return argv[++argi];
+        };
+        for (int argi = 1; argi < argc; argi++) {
+            std::string_view arg{argv[argi]};
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0]);
+                std::exit(0);
+            } else if (arg == "-b" || arg == "--batch") {
+                batch = true;
+            } else if (arg == "-d" || arg == "--delay") {
+                interval = std::max(std::atof(value(argi)), 0.1);
+            } else if (arg == "-n" || arg == "--iterations") {
+                iterations = std::atol(value(argi));
+            } else if (arg == "-l" || arg == "--limit") {
+                limit = std::strtoul(value(argi), nullptr, 10);
+            } else if (arg == "-s" || arg == "--sort") {
+                std::string_view key{value(argi)};
+                if (key == "calls") {
+                    sortBy = sort_key::calls;
+                } else if (key == "errors") {
+                    sortBy = sort_key::errors;
+                } else if (key == "time") {
+                    sortBy = sort_key::time;
+                } else if (key == "p99") {
+                    sortBy = sort_key::p99;
+                } else {
+                    std::fprintf(stderr, "error: invalid sort key: %s\n",
+                                 argv[argi]);
+                    std::exit(1);
+                }
+            } else if (!arg.empty() && arg[0] != '-' && !pid) {
+                pid = std::strtoul(argv[argi], nullptr, 10);
+            } else {
+                std::fprintf(stderr, "error: invalid argument: %s\n",
+                             argv[argi]);
+                std::fprintf(stderr, usage, argv[0]);
+                std::exit(1);
+            }
+        }
+    }
+
+    int listProcesses() {
+        auto pids = listSegments();
+        if (pids.empty()) {
+            std::printf("No process with UR_LAYER_STATS enabled found\n");
+            return 0;
+        }
+        std::printf("%8s  %s\n", "PID", "COMMAND");
+        for (auto segmentPid : pids) {
+            std::printf("%8u  %s%s\n", segmentPid,
+                        processName(segmentPid).c_str(),
+                        processAlive(segmentPid) ? "" : " (exited)");
+        }
+        return 0;
+    }
+
+    void printRow(const char *name, const counters_snapshot_t &delta,
+                  uint64_t totalCalls, double seconds) {
+        std::printf("%-48.48s %10.0f %8.0f %9s %9s %9s %12" PRIu64 "\n",
+                    name, delta.calls / seconds, delta.errors / seconds,
+                    formatNs(delta.percentileNs(50)).c_str(),
+                    formatNs(delta.percentileNs(99)).c_str(),
+                    formatNs(delta.totalNs).c_str(), totalCalls);
+    }
+
+    void printHeader(const char *title) {
+        std::printf("\n%-48s %10s %8s %9s %9s %9s %12s\n", title, "CALLS/s",
+                    "ERR/s", "P50", "P99", "TIME", "TOTAL");
+    }
+
+    void print(const segment_t &segment, const snapshot_t &previous,
+               const snapshot_t &current, double seconds) {
+        if (!batch) {
+            // Move the cursor home and clear the screen.
+            std::printf("\033[H\033[2J");
+        }
+        auto uptime = std::chrono::duration_cast<std::chrono::seconds>(
+                          std::chrono::system_clock::now().time_since_epoch())
+                          .count() -
+                      static_cast<int64_t>(segment.createTimeNs / 1000000000);
+        std::printf("urtop - pid %u (%s), up %lds, %u threads, %zu queues\n",
+                    segment.pid, processName(segment.pid).c_str(),
+                    static_cast<long>(uptime), current.threadCount,
+                    current.queues.size());
+
+        std::vector<row_t> rows;
+        for (uint32_t f = 0; f < current.functions.size(); f++) {
+            auto &counters = current.functions[f];
+            if (counters.calls == 0) {
+                continue;
+            }
+            rows.push_back({functionName(f), counters - previous.functions[f],
+                            counters.calls});
+        }
+        auto key = [&](const row_t &row) {
+            switch (sortBy) {
+            case sort_key::errors:
+                return row.delta.errors;
+            case sort_key::time:
+                return row.delta.totalNs;
+            case sort_key::p99:
+                return row.delta.percentileNs(99);
+            default:
+                return row.delta.calls;
+            }
+        };
+        std::stable_sort(rows.begin(), rows.end(),
+                         [&](const row_t &a, const row_t &b) {
+                             auto keyA = key(a);
+                             auto keyB = key(b);
+                             return keyA != keyB ? keyA > keyB
+                                                 : a.totalCalls > b.totalCalls;
+                         });
+
+        printHeader("FUNCTION");
+        for (size_t i = 0; i < rows.size() && i < limit; i++) {
+            printRow(rows[i].name.c_str(), rows[i].delta, rows[i].totalCalls,
+                     seconds);
+        }
+
+        if (!current.queues.empty()) {
+            printHeader("QUEUE");
+            for (auto &queue : current.queues) {
+                counters_snapshot_t delta = queue.counters;
+                for (auto &old : previous.queues) {
+                    if (old.handle == queue.handle) {
+                        delta = queue.counters - old.counters;
+                        break;
+                    }
+                }
+                char name[64];
+                std::snprintf(name, sizeof(name), "0x%" PRIx64 " (%s)",
+                              queue.handle, backendName(queue.backend).c_str());
+                printRow(name, delta, queue.counters.calls, seconds);
+            }
+
+            printHeader("ADAPTER");
+            for (uint32_t b = 0; b < current.backends.size(); b++) {
+                auto &counters = current.backends[b];
+                if (counters.calls == 0) {
+                    continue;
+                }
+                auto name =
+                    backendName(static_cast<ur_platform_backend_t>(b));
+                printRow(name.c_str(), counters - previous.backends[b],
+                         counters.calls, seconds);
+            }
+        }
+        std::fflush(stdout);
+    }
+
+    int run() {
+        if (!pid) {
+            return listProcesses();
+        }
+
+        // Attaching only maps the segment, the process is not notified.
+        auto mapping = segment_mapping_t::attach(pid);
+        if (!mapping) {
+            std::fprintf(stderr,
+                         "error: no stats segment for pid %u, is "
+                         "UR_LAYER_STATS enabled?\n",
+                         pid);
+            return 1;
+        }
+        const segment_t &segment = *mapping.get();
+
+        auto previous = snapshot_t::read(segment);
+        auto previousTime = std::chrono::steady_clock::now();
+        for (long i = 0; iterations < 0 || i < iterations; i++) {
+            std::this_thread::sleep_for(
+                std::chrono::duration<double>(interval));
+            auto current = snapshot_t::read(segment);
+            auto currentTime = std::chrono::steady_clock::now();
+            double seconds =
+                std::chrono::duration<double>(currentTime - previousTime)
+                    .count();
+            print(segment, previous, current, seconds);
+            if (!processAlive(pid)) {
+                std::printf("\nProcess %u exited\n", pid);
+                break;
+            }
+            previous = std::move(current);
+            previousTime = currentTime;
+        }
+        return 0;
+    }
+};
+} // namespace urtop
+
+int main(int argc, const char **argv) {
+    auto app = urtop::app{argc, argv};
+    return app.run();
+}
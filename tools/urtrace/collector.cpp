@@ -12,11 +12,19 @@
  * execution time.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <random>
 #include <regex>
 #include <sstream>
 #include <stack>
@@ -24,14 +32,20 @@
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "logger/ur_logger.hpp"
 #include "ur_api.h"
+#include "ur_lib_loader.hpp"
 #include "ur_print.hpp"
 #include "ur_util.hpp"
 #include "xpti/xpti_trace_framework.h"
 
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
 constexpr uint16_t TRACE_FN_BEGIN =
     static_cast<uint16_t>(xpti::trace_point_type_t::function_with_args_begin);
 constexpr uint16_t TRACE_FN_END =
@@ -113,6 +127,9 @@ const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json"};
  * - "time_unit:<auto,ns, ...>"
  * - "filter:<regex>"
  * - "json"
+ * - "callsites"
+ * - "top:<N>"
+ * - "folded:<file>"
  */
 static class cli_args {
     std::optional<std::string>
@@ -137,6 +154,9 @@ static class cli_args {
         filter = std::nullopt;
         filter_str = std::nullopt;
         output_format = OUTPUT_HUMAN_READABLE;
+        callsites = false;
+        top_callsites = 10;
+        folded_file = std::nullopt;
         if (auto args = getenv_to_map(ARGS_ENV, false)) {
             for (auto [arg_name, arg_values] : *args) {
                 if (arg_name == "print_begin") {
@@ -147,6 +167,18 @@ static class cli_args {
                     profiling = true;
                 } else if (arg_name == "no_args") {
                     no_args = true;
+                } else if (arg_name == "callsites") {
+                    callsites = true;
+                } else if (auto top =
+                               arg_with_value("top", arg_name, arg_values)) {
+                    try {
+                        top_callsites = std::stoul(*top);
+                    } catch (const std::exception &) {
+                        out.warn("invalid top value {}", *top);
+                    }
+                } else if (auto file = arg_with_value("folded", arg_name,
+                                                      arg_values)) {
+                    folded_file = file;
                 } else if (auto unit = arg_with_value("time_unit", arg_name,
                                                       arg_values)) {
                     for (int i = 0; i < MAX_TIME_UNIT; ++i) {
@@ -183,6 +215,13 @@ static class cli_args {
     std::optional<std::string>
         filter_str; //the filter_str is kept primarily for printing.
     std::optional<std::regex> filter;
+    bool callsites;
+    size_t top_callsites;
+    std::optional<std::string> folded_file;
+
+    bool aggregate_callsites() const {
+        return callsites || folded_file.has_value();
+    }
 } cli_args;
 
 typedef std::chrono::steady_clock Clock;
@@ -288,15 +327,670 @@ static std::unique_ptr<TraceWriter> &writer() {
     return writer;
 }
 
+/*
+ * Aggregates the time spent in each UR function per call site, as reported
+ * by the code location callback set through
+ * urLoaderConfigSetCodeLocationCallback. Calls made without a code location
+ * are attributed to an unknown call site. The results are written out when
+ * the collector is unloaded.
+ */
+class CallSiteStats {
+    // Number of durations kept per call site for percentile estimation.
+    static constexpr size_t RESERVOIR_SIZE = 1024;
+
+    struct stats {
+        uint64_t calls = 0;
+        uint64_t total_ns = 0;
+        std::vector<uint64_t> reservoir;
+    };
+
+    using key_t = std::pair<const xpti::payload_t *, std::string_view>;
+
+    std::mutex mutex;
+    std::map<key_t, stats> sites;
+    std::minstd_rand rng;
+
+    static std::string callsite_str(const xpti::payload_t *payload) {
+        if (payload == nullptr || payload->name == nullptr) {
+            return "<unknown>";
+        }
+        std::ostringstream str;
+        str << payload->name;
+        if (payload->source_file) {
+            str << " (" << payload->source_file << ":" << payload->line_no
+                << ")";
+        }
+        return str.str();
+    }
+
+    static uint64_t percentile(std::vector<uint64_t> &sorted, double p) {
+        if (sorted.empty()) {
+            return 0;
+        }
+        size_t idx = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+        return sorted[idx];
+    }
+
+    void write_folded() {
+        std::ofstream file(*cli_args.folded_file);
+        if (!file) {
+            out.error("unable to open {} for writing",
+                      *cli_args.folded_file);
+            return;
+        }
+        for (auto &[key, site] : sites) {
+            std::string frame = callsite_str(key.first);
+            std::replace(frame.begin(), frame.end(), ';', ':');
+            file << frame << ";" << key.second << " " << site.total_ns
+                 << "\n";
+        }
+    }
+
+    void print_top() {
+        std::vector<std::pair<key_t, stats *>> sorted;
+        for (auto &[key, site] : sites) {
+            sorted.emplace_back(key, &site);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](auto &lhs, auto &rhs) {
+            return lhs.second->total_ns > rhs.second->total_ns;
+        });
+        if (sorted.size() > cli_args.top_callsites) {
+            sorted.resize(cli_args.top_callsites);
+        }
+
+        auto time_str = [](uint64_t ns) {
+            return time_to_str(std::chrono::nanoseconds(ns),
+                               cli_args.time_unit);
+        };
+
+        out.info("Top {} call sites by total time:", sorted.size());
+        std::ostringstream header;
+        header << std::left << std::setw(12) << "total" << std::setw(10)
+               << "calls" << std::setw(12) << "p50" << std::setw(12) << "p99"
+               << std::setw(32) << "function"
+               << "call site";
+        out.info("{}", header.str());
+        for (auto &[key, site] : sorted) {
+            std::sort(site->reservoir.begin(), site->reservoir.end());
+            std::ostringstream line;
+            line << std::left << std::setw(12) << time_str(site->total_ns)
+                 << std::setw(10) << site->calls << std::setw(12)
+                 << time_str(percentile(site->reservoir, 0.5))
+                 << std::setw(12)
+                 << time_str(percentile(site->reservoir, 0.99))
+                 << std::setw(32) << key.second << callsite_str(key.first);
+            out.info("{}", line.str());
+        }
+    }
+
+  public:
+    ~CallSiteStats() {
+        try {
+            std::scoped_lock<std::mutex> lock(mutex);
+            if (cli_args.folded_file) {
+                write_folded();
+            }
+            if (cli_args.callsites) {
+                print_top();
+            }
+        } catch (...) {
+            // not much we can do here...
+        }
+    }
+
+    void record(const xpti::payload_t *payload, const char *fname,
+                std::chrono::nanoseconds dur) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        auto &site = sites[key_t{payload, fname}];
+        uint64_t ns = dur.count();
+        site.calls++;
+        site.total_ns += ns;
+        if (site.reservoir.size() < RESERVOIR_SIZE) {
+            site.reservoir.push_back(ns);
+        } else {
+            // Reservoir sampling keeps a uniform sample of all durations.
+            auto idx = std::uniform_int_distribution<uint64_t>(
+                0, site.calls - 1)(rng);
+            if (idx < RESERVOIR_SIZE) {
+                site.reservoir[idx] = ns;
+            }
+        }
+    }
+};
+
+static CallSiteStats &callsite_stats() {
+    static CallSiteStats stats;
+
+    return stats;
+}
+
+/*
+ * Set on threads while they run UR calls made by the collector itself, so that
+ * those calls are not traced.
+ */
+static thread_local bool collector_call = false;
+
+struct collector_call_scope {
+    collector_call_scope() { collector_call = true; }
+    ~collector_call_scope() { collector_call = false; }
+};
+
+/*
+ * Looks up a function of the loader already loaded in the traced application.
+ * The collector doesn't link the loader, which could otherwise bring in a
+ * second copy of it, with its own adapters and handles.
+ */
+template <typename T> static T find_loader_function(const char *name) {
+#if defined(_WIN32)
+    HMODULE loader = GetModuleHandleA("ur_loader.dll");
+    if (loader == nullptr) {
+        return nullptr;
+    }
+#else
+    HMODULE loader = RTLD_DEFAULT;
+#endif
+    return reinterpret_cast<T>(
+        ur_loader::LibLoader::getFunctionPtr(loader, name));
+}
+
+/*
+ * Places the commands submitted to profiling-enabled queues on a device
+ * timeline in the JSON output. Events returned by enqueue functions are
+ * retained at the end of the call and handed to a background thread, which
+ * waits for them to complete, reads their timestamps with
+ * urEventGetProfilingInfo and writes a span on the device track of the queue,
+ * with a flow arrow from the submitting call. Adapters reporting hardware
+ * counters of commands (UR_PROFILING_COUNTERS_EXTENSION_STRING_EXP) add the
+ * instructions per cycle and last level cache misses per thousand
+ * instructions of the command to the span's args.
+ *
+ * Only queues created with urQueueCreate and UR_QUEUE_FLAG_PROFILING_ENABLE
+ * are tracked, and only commands for which the application asked for an
+ * event. A queue stops being tracked once the application releases its last
+ * reference to it, its commands still pending are written nevertheless.
+ * Commands still pending when an adapter is released are dropped, as the
+ * adapter may be unloaded afterwards. No queue is tracked if the loader
+ * functions used to query the events can't be found.
+ */
+class DeviceTimeline {
+    // Interval at which incomplete events are polled.
+    static constexpr auto POLL_INTERVAL = std::chrono::milliseconds(1);
+
+    struct queue_info {
+        ur_device_handle_t device;
+        uint64_t track;
+        // Host steady clock time minus device time, in nanoseconds.
+        std::optional<int64_t> clock_offset;
+        // References held by the application.
+        uint32_t refs = 1;
+        // Cleared once the adapter fails to report the counters of a command.
+        bool counters = true;
+    };
+
+    struct command {
+        ur_event_handle_t event;
+        std::shared_ptr<queue_info> queue;
+        const char *fname;
+        std::thread::id tid;
+        Timepoint submitted;
+        uint64_t flow;
+    };
+
+    struct loader_functions {
+        decltype(&urEventGetInfo) pfnEventGetInfo;
+        decltype(&urEventGetProfilingInfo) pfnEventGetProfilingInfo;
+        decltype(&urEventRetain) pfnEventRetain;
+        decltype(&urEventRelease) pfnEventRelease;
+        decltype(&urDeviceGetGlobalTimestamps) pfnDeviceGetGlobalTimestamps;
+    };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::unordered_map<ur_queue_handle_t, std::shared_ptr<queue_info>> queues;
+    std::deque<command> pending;
+    uint64_t next_track = 1;
+    std::atomic<uint64_t> next_flow = 1;
+    bool stopping = false;
+
+    // Looked up when the first profiling queue is created, and only used
+    // for the commands of tracked queues afterwards.
+    std::optional<loader_functions> loader;
+    bool loader_looked_up = false;
+
+    // Held while the commands taken from pending are being resolved.
+    std::mutex resolve_mutex;
+    std::thread thread;
+
+    static std::string us_str(int64_t ns) {
+        std::ostringstream str;
+        str << ns / 1000 << "." << std::setw(3) << std::setfill('0')
+            << std::abs(ns % 1000);
+        return str.str();
+    }
+
+    static int64_t ns_since_epoch(Timepoint tp) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   tp.time_since_epoch())
+            .count();
+    }
+
+    // Returns whether the loader functions were found. Called with mutex held.
+    bool lookup_loader_functions() {
+        if (loader_looked_up) {
+            return loader.has_value();
+        }
+        loader_looked_up = true;
+
+        loader_functions functions = {
+            find_loader_function<decltype(&urEventGetInfo)>("urEventGetInfo"),
+            find_loader_function<decltype(&urEventGetProfilingInfo)>(
+                "urEventGetProfilingInfo"),
+            find_loader_function<decltype(&urEventRetain)>("urEventRetain"),
+            find_loader_function<decltype(&urEventRelease)>("urEventRelease"),
+            find_loader_function<decltype(&urDeviceGetGlobalTimestamps)>(
+                "urDeviceGetGlobalTimestamps"),
+        };
+        if (!functions.pfnEventGetInfo || !functions.pfnEventGetProfilingInfo ||
+            !functions.pfnEventRetain || !functions.pfnEventRelease ||
+            !functions.pfnDeviceGetGlobalTimestamps) {
+            out.warn("UR loader functions not found in the process, device "
+                     "execution of commands won't be traced.");
+            return false;
+        }
+        loader = functions;
+        return true;
+    }
+
+    std::optional<int64_t> clock_offset(queue_info &queue,
+                                        const command &cmd) {
+        if (queue.clock_offset) {
+            return queue.clock_offset;
+        }
+        uint64_t device_ts = 0;
+        auto host_ts = ns_since_epoch(Clock::now());
+        if (loader->pfnDeviceGetGlobalTimestamps(queue.device, &device_ts,
+                                                 nullptr) ==
+            UR_RESULT_SUCCESS) {
+            queue.clock_offset = host_ts - static_cast<int64_t>(device_ts);
+        } else {
+            // Assume the first command was queued on the device as the
+            // enqueue call returned.
+            uint64_t queued_ts = 0;
+            if (loader->pfnEventGetProfilingInfo(
+                    cmd.event, UR_PROFILING_INFO_COMMAND_QUEUED,
+                    sizeof(queued_ts), &queued_ts,
+                    nullptr) != UR_RESULT_SUCCESS) {
+                return std::nullopt;
+            }
+            queue.clock_offset = ns_since_epoch(cmd.submitted) -
+                                 static_cast<int64_t>(queued_ts);
+        }
+        return queue.clock_offset;
+    }
+
+    // Returns false if the command hasn't completed yet, unless drop is true.
+    bool resolve(const command &cmd, bool drop) {
+        ur_event_status_t status = UR_EVENT_STATUS_QUEUED;
+        auto result = loader->pfnEventGetInfo(
+            cmd.event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS, sizeof(status),
+            &status, nullptr);
+        if (result == UR_RESULT_SUCCESS && status == UR_EVENT_STATUS_COMPLETE) {
+            write(cmd);
+        } else if (result == UR_RESULT_SUCCESS && !drop) {
+            return false;
+        }
+        loader->pfnEventRelease(cmd.event);
+        return true;
+    }
+
+    // Returns the span args computed from the hardware counters of the
+    // command, or std::nullopt if the adapter doesn't report them.
+    std::optional<std::string> counter_args(const command &cmd) {
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        uint64_t llc_misses = 0;
+        if (loader->pfnEventGetProfilingInfo(
+                cmd.event, UR_PROFILING_INFO_CYCLES_EXP, sizeof(cycles),
+                &cycles, nullptr) != UR_RESULT_SUCCESS ||
+            loader->pfnEventGetProfilingInfo(
+                cmd.event, UR_PROFILING_INFO_INSTRUCTIONS_EXP,
+                sizeof(instructions), &instructions,
+                nullptr) != UR_RESULT_SUCCESS ||
+            loader->pfnEventGetProfilingInfo(
+                cmd.event, UR_PROFILING_INFO_LLC_MISSES_EXP,
+                sizeof(llc_misses), &llc_misses,
+                nullptr) != UR_RESULT_SUCCESS) {
+            return std::nullopt;
+        }
+
+        std::ostringstream args;
+        args << std::fixed << std::setprecision(3) << ", \"args\": {\"ipc\": "
+             << (cycles ? double(instructions) / cycles : 0.0)
+             << ", \"llc_mpki\": "
+             << (instructions ? 1000.0 * llc_misses / instructions : 0.0)
+             << "}";
+        return args.str();
+    }
+
+    void write(const command &cmd) {
+        uint64_t start = 0;
+        uint64_t end = 0;
+        if (loader->pfnEventGetProfilingInfo(
+                cmd.event, UR_PROFILING_INFO_COMMAND_START, sizeof(start),
+                &start, nullptr) != UR_RESULT_SUCCESS ||
+            loader->pfnEventGetProfilingInfo(
+                cmd.event, UR_PROFILING_INFO_COMMAND_END, sizeof(end), &end,
+                nullptr) != UR_RESULT_SUCCESS) {
+            return;
+        }
+
+        uint64_t track = cmd.queue->track;
+        std::optional<int64_t> offset;
+        bool counters = false;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            offset = clock_offset(*cmd.queue, cmd);
+            counters = cmd.queue->counters;
+        }
+        if (!offset) {
+            return;
+        }
+        std::string args;
+        if (counters) {
+            if (auto counter_span_args = counter_args(cmd)) {
+                args = std::move(*counter_span_args);
+            } else {
+                std::scoped_lock<std::mutex> lock(mutex);
+                cmd.queue->counters = false;
+            }
+        }
+        int64_t host_start = static_cast<int64_t>(start) + *offset;
+        int64_t dur = static_cast<int64_t>(end - std::min(start, end));
+
+        // The flow starts in the span of the call, whose timestamp is the one
+        // written by JsonWriter.
+        auto submit_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                             cmd.submitted.time_since_epoch())
+                             .count();
+        out.info("{{\"cat\": \"UR\", \"ph\": \"s\", \"pid\": {}, "
+                 "\"tid\": {}, \"ts\": {}, \"id\": {}, \"name\": \"{}\"}},",
+                 ur_getpid(), cmd.tid, submit_us, cmd.flow, cmd.fname);
+        out.info("{{\"cat\": \"UR\", \"ph\": \"X\", \"pid\": {}, "
+                 "\"tid\": {}, \"ts\": {}, \"dur\": {}, \"name\": \"{}\"{}}},",
+                 ur_getpid(), track, us_str(host_start), us_str(dur),
+                 cmd.fname, args);
+        out.info("{{\"cat\": \"UR\", \"ph\": \"f\", \"bp\": \"e\", "
+                 "\"pid\": {}, \"tid\": {}, \"ts\": {}, \"id\": {}, "
+                 "\"name\": \"{}\"}},",
+                 ur_getpid(), track, us_str(host_start), cmd.flow,
+                 cmd.fname);
+    }
+
+    // Resolves the completed commands, dropping the others if drop is true.
+    void resolve_pending(bool drop) {
+        std::scoped_lock<std::mutex> resolve_lock(resolve_mutex);
+        std::deque<command> commands;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            commands.swap(pending);
+        }
+
+        std::deque<command> incomplete;
+        for (auto &cmd : commands) {
+            if (!resolve(cmd, drop)) {
+                incomplete.push_back(cmd);
+            }
+        }
+
+        std::scoped_lock<std::mutex> lock(mutex);
+        pending.insert(pending.begin(), incomplete.begin(), incomplete.end());
+    }
+
+    void run() {
+        collector_call_scope scope;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (stopping) {
+                return;
+            }
+            lock.unlock();
+            resolve_pending(false);
+            lock.lock();
+            cv.wait_for(lock, POLL_INTERVAL, [this] { return stopping; });
+        }
+    }
+
+  public:
+    ~DeviceTimeline() {
+        // The loader may be gone by now, commands still pending are dropped
+        // without querying them.
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    void queue_created(const ur_queue_create_params_t *params) {
+        auto properties = *params->ppProperties;
+        if (!properties ||
+            !(properties->flags & UR_QUEUE_FLAG_PROFILING_ENABLE)) {
+            return;
+        }
+        auto queue = **params->pphQueue;
+
+        std::scoped_lock<std::mutex> lock(mutex);
+        if (!lookup_loader_functions()) {
+            return;
+        }
+        auto track = next_track++;
+        queues[queue] = std::make_shared<queue_info>(
+            queue_info{*params->phDevice, track, std::nullopt});
+        out.info("{{\"ph\": \"M\", \"pid\": {}, \"tid\": {}, "
+                 "\"name\": \"thread_name\", "
+                 "\"args\": {{\"name\": \"device (queue {})\"}}}},",
+                 ur_getpid(), track, queue);
+    }
+
+    void queue_retained(ur_queue_handle_t queue) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        auto it = queues.find(queue);
+        if (it != queues.end()) {
+            it->second->refs++;
+        }
+    }
+
+    void queue_released(ur_queue_handle_t queue) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        auto it = queues.find(queue);
+        if (it != queues.end() && --it->second->refs == 0) {
+            queues.erase(it);
+        }
+    }
+
+    void submitted(ur_queue_handle_t hQueue, ur_event_handle_t event,
+                   const char *fname, Timepoint tp) {
+        std::shared_ptr<queue_info> queue;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            auto it = queues.find(hQueue);
+            if (stopping || it == queues.end()) {
+                return;
+            }
+            queue = it->second;
+        }
+
+        {
+            collector_call_scope scope;
+            if (loader->pfnEventRetain(event) != UR_RESULT_SUCCESS) {
+                return;
+            }
+        }
+
+        std::scoped_lock<std::mutex> lock(mutex);
+        pending.push_back(command{event, std::move(queue), fname,
+                                  std::this_thread::get_id(), tp,
+                                  next_flow++});
+        if (!thread.joinable()) {
+            thread = std::thread([this] { run(); });
+        }
+        cv.notify_one();
+    }
+
+    // Resolves the completed commands and drops the others.
+    void flush() {
+        collector_call_scope scope;
+        resolve_pending(true);
+    }
+};
+
+static DeviceTimeline &device_timeline() {
+    static DeviceTimeline timeline;
+
+    return timeline;
+}
+
+/*
+ * Returns the queue and the output event of enqueue functions, or std::nullopt
+ * if the call didn't return an event.
+ */
+static std::optional<std::pair<ur_queue_handle_t, ur_event_handle_t>>
+enqueued_event(ur_function_t function_id, const void *params) {
+#define ENQUEUE_FUNCTION(id, params_t)                                         \
+    case id: {                                                                 \
+        auto p = static_cast<const params_t *>(params);                        \
+        if (*p->pphEvent == nullptr) {                                         \
+            return std::nullopt;                                               \
+        }                                                                      \
+        return std::make_pair(*p->phQueue, **p->pphEvent);                     \
+    }
+
+    switch (function_id) {
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH,
+                         ur_enqueue_kernel_launch_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_EVENTS_WAIT,
+                         ur_enqueue_events_wait_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
+                         ur_enqueue_events_wait_with_barrier_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ,
+                         ur_enqueue_mem_buffer_read_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
+                         ur_enqueue_mem_buffer_write_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
+                         ur_enqueue_mem_buffer_read_rect_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
+                         ur_enqueue_mem_buffer_write_rect_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY,
+                         ur_enqueue_mem_buffer_copy_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
+                         ur_enqueue_mem_buffer_copy_rect_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL,
+                         ur_enqueue_mem_buffer_fill_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ,
+                         ur_enqueue_mem_image_read_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE,
+                         ur_enqueue_mem_image_write_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY,
+                         ur_enqueue_mem_image_copy_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP,
+                         ur_enqueue_mem_buffer_map_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_MEM_UNMAP,
+                         ur_enqueue_mem_unmap_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_USM_FILL,
+                         ur_enqueue_usm_fill_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_USM_MEMCPY,
+                         ur_enqueue_usm_memcpy_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_USM_PREFETCH,
+                         ur_enqueue_usm_prefetch_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_USM_ADVISE,
+                         ur_enqueue_usm_advise_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_USM_FILL_2D,
+                         ur_enqueue_usm_fill_2d_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D,
+                         ur_enqueue_usm_memcpy_2d_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
+                         ur_enqueue_device_global_variable_write_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
+                         ur_enqueue_device_global_variable_read_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE,
+                         ur_enqueue_read_host_pipe_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE,
+                         ur_enqueue_write_host_pipe_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
+                         ur_enqueue_cooperative_kernel_launch_exp_params_t)
+        ENQUEUE_FUNCTION(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP,
+                         ur_command_buffer_enqueue_exp_params_t)
+    default:
+        return std::nullopt;
+    }
+#undef ENQUEUE_FUNCTION
+}
+
+/*
+ * Tracks the queues and adapters of the device timeline, regardless of the
+ * filter.
+ */
+static void track_device_timeline(uint16_t trace_type,
+                                  const xpti::function_with_args_t *args) {
+    auto function_id = static_cast<ur_function_t>(args->function_id);
+    if (trace_type == TRACE_FN_BEGIN) {
+        if (function_id == UR_FUNCTION_ADAPTER_RELEASE) {
+            // Events of the adapter can't be queried once it's gone.
+            device_timeline().flush();
+        }
+        return;
+    }
+    if (*static_cast<const ur_result_t *>(args->ret_data) !=
+        UR_RESULT_SUCCESS) {
+        return;
+    }
+    switch (function_id) {
+    case UR_FUNCTION_QUEUE_CREATE:
+        device_timeline().queue_created(
+            static_cast<const ur_queue_create_params_t *>(args->args_data));
+        break;
+    case UR_FUNCTION_QUEUE_RETAIN:
+        device_timeline().queue_retained(
+            *static_cast<const ur_queue_retain_params_t *>(args->args_data)
+                 ->phQueue);
+        break;
+    case UR_FUNCTION_QUEUE_RELEASE:
+        device_timeline().queue_released(
+            *static_cast<const ur_queue_release_params_t *>(args->args_data)
+                 ->phQueue);
+        break;
+    default:
+        break;
+    }
+}
+
+static void submit_device_command(const xpti::function_with_args_t *args,
+                                  Timepoint tp) {
+    if (*static_cast<const ur_result_t *>(args->ret_data) !=
+        UR_RESULT_SUCCESS) {
+        return;
+    }
+    auto function_id = static_cast<ur_function_t>(args->function_id);
+    if (auto enqueued = enqueued_event(function_id, args->args_data)) {
+        device_timeline().submitted(enqueued->first, enqueued->second,
+                                    args->function_name, tp);
+    }
+}
+
 struct fn_context {
     uint64_t instance;
     std::optional<Timepoint> start;
+    const xpti::payload_t *callsite;
 };
 
 static thread_local std::stack<fn_context> instance_data;
 
 fn_context *push_instance_data(uint64_t instance) {
-    instance_data.push(fn_context{instance, std::nullopt});
+    instance_data.push(fn_context{instance, std::nullopt, nullptr});
     return &instance_data.top();
 }
 
@@ -313,12 +1007,19 @@ std::optional<fn_context> pop_instance_data(uint64_t instance) {
 }
 
 XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
-                                xpti::trace_event_data_t *, uint64_t instance,
-                                const void *user_data) {
+                                xpti::trace_event_data_t *child,
+                                uint64_t instance, const void *user_data) {
     // stop the the clock as the very first thing, only used for TRACE_FN_END
     auto time_for_end = Clock::now();
+    if (collector_call) {
+        return;
+    }
     auto *args = static_cast<const xpti::function_with_args_t *>(user_data);
 
+    if (cli_args.output_format == OUTPUT_JSON) {
+        track_device_timeline(trace_type, args);
+    }
+
     if (auto regex = cli_args.filter) {
         if (!std::regex_match(args->function_name, *regex)) {
             out.debug("function {} does not match regex filter, skipping...",
@@ -337,6 +1038,9 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
 
     if (trace_type == TRACE_FN_BEGIN) {
         auto ctx = push_instance_data(instance);
+        if (cli_args.aggregate_callsites() && child) {
+            ctx->callsite = xptiQueryPayload(child);
+        }
         ctx->start = std::optional(Clock::now());
 
         writer()->begin(instance, args->function_name, args_str.str());
@@ -352,6 +1056,17 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
 
         writer()->end(instance, args->function_name, args_str.str(),
                       time_for_end, *ctx->start, resultp);
+
+        if (cli_args.output_format == OUTPUT_JSON) {
+            submit_device_command(args, time_for_end);
+        }
+
+        if (cli_args.aggregate_callsites()) {
+            callsite_stats().record(
+                ctx->callsite, args->function_name,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    time_for_end - *ctx->start));
+        }
     } else {
         out.warn("unsupported trace type");
     }
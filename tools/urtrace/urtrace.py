@@ -48,12 +48,15 @@ parser.add_argument("--profiling", help="Measure function execution time.", acti
 parser.add_argument("--filter", help="Only trace functions that match the provided regex filter.")
 parser.add_argument("--null", help="Force the use of the null adapter.", action="store_true")
 parser.add_argument("--adapter", help="Force the use of the provided adapter.", action="append", default=[])
-parser.add_argument("--json", help="Write output in a JSON Trace Event Format.", action="store_true")
+parser.add_argument("--json", help="Write output in a JSON Trace Event Format. Commands submitted to profiling-enabled queues are also shown on device tracks.", action="store_true")
 group = parser.add_mutually_exclusive_group()
 group.add_argument("--file", help="Write trace output to a file with the given name instead of stderr.")
 group.add_argument("--stdout", help="Write trace output to stdout instead of stderr.", action="store_true")
 parser.add_argument("--no-args", help="Don't pretty print traced functions arguments.", action="store_true")
 parser.add_argument("--print-begin", help="Print on function begin.", action="store_true")
+parser.add_argument("--callsites", help="Report the slowest call sites, as set by the code location callback, with their p50 and p99 latencies.", action="store_true")
+parser.add_argument("--top", type=int, default=10, help="Number of call sites reported by --callsites.")
+parser.add_argument("--folded", help="Write time per call site and function in a folded stack format, usable for flame graphs, to a file with the given name.")
 parser.add_argument("--time-unit", choices=['ns', 'us', 'ms', 's', 'auto'], default='auto', help="Use a specific unit of time for profiling.")
 parser.add_argument("--libpath", default=['.', '../lib/', '/lib/', '/usr/local/lib/', '/usr/lib/'], action="append", help="Search path for adapters and xpti libraries.")
 parser.add_argument("--recursive", help="Use recursive library search.", action="store_true")
@@ -78,6 +81,11 @@ if args.no_args:
     collector_args += "no_args;"
 if args.json:
     collector_args += "json;"
+if args.callsites:
+    collector_args += "callsites;"
+    collector_args += "top:" + str(args.top) + ";"
+if args.folded:
+    collector_args += "folded:" + args.folded + ";"
 env['UR_COLLECTOR_ARGS'] = collector_args
 
 log_collector = ""